@@ -25,17 +25,21 @@
 //------------------------------------------------------------------------------
 static int CeedInit_Avx(const char *resource, Ceed ceed) {
   int ierr;
-  if (strcmp(resource, "/cpu/self") && strcmp(resource, "/cpu/self/avx")
-      && strcmp(resource, "/cpu/self/avx/blocked"))
+  char *resourceroot;
+  ierr = CeedGetResourceRoot(ceed, resource, &resourceroot); CeedChk(ierr);
+  if (strcmp(resourceroot, "/cpu/self")
+      && strcmp(resourceroot, "/cpu/self/avx")
+      && strcmp(resourceroot, "/cpu/self/avx/blocked"))
     // LCOV_EXCL_START
     return CeedError(ceed, 1, "AVX backend cannot use resource: %s", resource);
   // LCOV_EXCL_STOP
+  ierr = CeedFree(&resourceroot); CeedChk(ierr);
   ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
 
   // Create reference CEED that implementation will be dispatched
   //   through unless overridden
   Ceed ceedref;
-  CeedInit("/cpu/self/opt/blocked", &ceedref);
+  CeedInitDelegate("/cpu/self/opt/blocked", resource, &ceedref);
   ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate",
@@ -47,6 +51,9 @@ static int CeedInit_Avx(const char *resource, Ceed ceed) {
 // Backend Register
 //------------------------------------------------------------------------------
 CEED_INTERN int CeedRegister_Avx_Blocked(void) {
+  // Only offer the backend when the running CPU reports AVX2 and FMA
+  if (!CeedAvxSupported())
+    return 0;
   return CeedRegister("/cpu/self/avx/blocked", CeedInit_Avx, 30);
 }
 //------------------------------------------------------------------------------
@@ -25,17 +25,20 @@
 //------------------------------------------------------------------------------
 static int CeedInit_Avx(const char *resource, Ceed ceed) {
   int ierr;
-  if (strcmp(resource, "/cpu/self")
-      && strcmp(resource, "/cpu/self/avx/serial"))
+  char *resourceroot;
+  ierr = CeedGetResourceRoot(ceed, resource, &resourceroot); CeedChk(ierr);
+  if (strcmp(resourceroot, "/cpu/self")
+      && strcmp(resourceroot, "/cpu/self/avx/serial"))
     // LCOV_EXCL_START
     return CeedError(ceed, 1, "AVX backend cannot use resource: %s", resource);
   // LCOV_EXCL_STOP
+  ierr = CeedFree(&resourceroot); CeedChk(ierr);
   ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
 
   // Create reference CEED that implementation will be dispatched
   //   through unless overridden
   Ceed ceedref;
-  CeedInit("/cpu/self/opt/serial", &ceedref);
+  CeedInitDelegate("/cpu/self/opt/serial", resource, &ceedref);
   ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
 
 
@@ -48,6 +51,9 @@ static int CeedInit_Avx(const char *resource, Ceed ceed) {
 // Backend Register
 //------------------------------------------------------------------------------
 CEED_INTERN int CeedRegister_Avx_Serial(void) {
+  // Only offer the backend when the running CPU reports AVX2 and FMA
+  if (!CeedAvxSupported())
+    return 0;
   return CeedRegister("/cpu/self/avx/serial", CeedInit_Avx, 35);
 }
 //------------------------------------------------------------------------------
@@ -30,7 +30,10 @@
 //------------------------------------------------------------------------------
 // Blocked Tensor Contract
 //------------------------------------------------------------------------------
-static inline int CeedTensorContract_Avx_Blocked(CeedTensorContract contract,
+// The output tile only stays in registers when JJ and CC are constants, so
+//   the kernel is inlined into each of its fixed size callers
+static inline __attribute__((always_inline))
+int CeedTensorContract_Avx_Blocked(CeedTensorContract contract,
     CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
     CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
     CeedScalar *restrict v, const CeedInt JJ, const CeedInt CC) {
@@ -238,6 +241,79 @@ static inline int CeedTensorContract_Avx_Single(CeedTensorContract contract,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Lane mask for the first n of 4 doubles
+//------------------------------------------------------------------------------
+static inline __m256i CeedMask_Avx(CeedInt n) {
+  return _mm256_cmpgt_epi64(_mm256_set1_epi64x(n),
+                            _mm256_setr_epi64x(0, 1, 2, 3));
+}
+
+//------------------------------------------------------------------------------
+// Serial Non-Tensor Contract C=1
+//------------------------------------------------------------------------------
+// Non-tensor bases contract the full interpolation or gradient matrix with a
+//   single element; rows of t are contiguous, so v = t u is taken as dot
+//   products of JJ rows at a time and the transpose as axpys of columns
+static inline int CeedTensorContract_Avx_NonTensorSingle(
+  CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+  const CeedScalar *restrict t, CeedTransposeMode tmode, const CeedInt Add,
+  const CeedScalar *restrict u, CeedScalar *restrict v, const CeedInt JJ) {
+  if (tmode == CEED_TRANSPOSE) {
+    // v_a += sum_b t[b][:] u_a[b], with t stored B x J
+    for (CeedInt a=0; a<A; a++)
+      for (CeedInt j=0; j<J; j+=4*JJ) {
+        __m256i mask[JJ];
+        __m256d vv[JJ]; // Output tile to be held in registers
+        for (CeedInt jj=0; jj<JJ; jj++) {
+          mask[jj] = CeedMask_Avx(J-j-jj*4);
+          vv[jj] = _mm256_maskload_pd(&v[a*J+j+jj*4], mask[jj]);
+        }
+        for (CeedInt b=0; b<B; b++) {
+          __m256d tqu = _mm256_set1_pd(u[a*B+b]);
+          for (CeedInt jj=0; jj<JJ; jj++) // unroll
+            fmadd(vv[jj], tqu, _mm256_maskload_pd(&t[b*J+j+jj*4], mask[jj]));
+        }
+        for (CeedInt jj=0; jj<JJ; jj++)
+          _mm256_maskstore_pd(&v[a*J+j+jj*4], mask[jj], vv[jj]);
+      }
+    return 0;
+  }
+
+  // v_a[j] += t[j][:] . u_a, with t stored J x B
+  const __m256i bmask = CeedMask_Avx(B%4);
+  for (CeedInt a=0; a<A; a++) {
+    const CeedScalar *restrict ua = &u[a*B];
+    for (CeedInt j=0; j<J; j+=4) {
+      const CeedInt nj = J-j < 4 ? J-j : 4;
+      __m256d dot[4] = {_mm256_setzero_pd(), _mm256_setzero_pd(),
+                        _mm256_setzero_pd(), _mm256_setzero_pd()
+                       };
+      CeedInt b=0;
+      for (; b+4<=B; b+=4) {
+        __m256d ub = _mm256_loadu_pd(&ua[b]);
+        for (CeedInt jj=0; jj<nj; jj++)
+          fmadd(dot[jj], ub, _mm256_loadu_pd(&t[(j+jj)*B+b]));
+      }
+      if (b < B) {
+        __m256d ub = _mm256_maskload_pd(&ua[b], bmask);
+        for (CeedInt jj=0; jj<nj; jj++)
+          fmadd(dot[jj], ub, _mm256_maskload_pd(&t[(j+jj)*B+b], bmask));
+      }
+      // Reduce the four dot products into one vector
+      __m256d s01 = _mm256_hadd_pd(dot[0], dot[1]),
+              s23 = _mm256_hadd_pd(dot[2], dot[3]);
+      __m256d sum = _mm256_add_pd(_mm256_permute2f128_pd(s01, s23, 0x20),
+                                  _mm256_permute2f128_pd(s01, s23, 0x31));
+      const __m256i jmask = CeedMask_Avx(nj);
+      _mm256_maskstore_pd(&v[a*J+j], jmask,
+                          _mm256_add_pd(_mm256_maskload_pd(&v[a*J+j], jmask),
+                                        sum));
+    }
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract - Common Sizes
 //------------------------------------------------------------------------------
@@ -255,6 +331,20 @@ static int CeedTensorContract_Avx_Remainder_8_8(CeedTensorContract contract,
   return CeedTensorContract_Avx_Remainder(contract, A, B, C, J, t, tmode, Add,
                                           u, v, 8, 8);
 }
+static int CeedTensorContract_Avx_NonTensorSingle_4(
+  CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+  const CeedScalar *restrict t, CeedTransposeMode tmode, const CeedInt Add,
+  const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_NonTensorSingle(contract, A, B, C, J, t, tmode,
+         Add, u, v, 4);
+}
+static int CeedTensorContract_Avx_Blocked_6_8(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, tmode, Add, u,
+                                        v, 6, 8);
+}
 static int CeedTensorContract_Avx_Single_4_8(CeedTensorContract contract,
     CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
     CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
@@ -297,6 +387,39 @@ static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Non-Tensor Contract Apply
+//------------------------------------------------------------------------------
+// Non-tensor bases contract all nodes with all quadrature points at once,
+//   with C being the number of elements rather than a slab of the tensor
+static int CeedTensorContractApplyNonTensor_Avx(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  const CeedInt blksize = 8, rows = 6;
+
+  // Short columns of t are better served by the tensor kernels
+  if (C != 1 && (C % blksize || J < rows))
+    return CeedTensorContractApply_Avx(contract, A, B, C, J, t, tmode, Add,
+                                       u, v);
+
+  if (!Add)
+    for (CeedInt q=0; q<A*J*C; q++)
+      v[q] = (CeedScalar) 0.0;
+
+  if (C == 1) {
+    // Serial C=1 Case
+    CeedTensorContract_Avx_NonTensorSingle_4(contract, A, B, C, J, t, tmode,
+        true, u, v);
+  } else {
+    // Blocks of 8 columns, the long rows of t allow taller tiles
+    CeedTensorContract_Avx_Blocked_6_8(contract, A, B, C, J, t, tmode, true,
+                                       u, v);
+  }
+
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Destroy
 //------------------------------------------------------------------------------
@@ -311,9 +434,17 @@ int CeedTensorContractCreate_Avx(CeedBasis basis, CeedTensorContract contract) {
   int ierr;
   Ceed ceed;
   ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChk(ierr);
+  bool istensor;
+  ierr = CeedBasisIsTensor(basis, &istensor); CeedChk(ierr);
 
-  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
-                                CeedTensorContractApply_Avx); CeedChk(ierr);
+  if (istensor) {
+    ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
+                                  CeedTensorContractApply_Avx); CeedChk(ierr);
+  } else {
+    ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
+                                  CeedTensorContractApplyNonTensor_Avx);
+    CeedChk(ierr);
+  }
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy",
                                 CeedTensorContractDestroy_Avx); CeedChk(ierr);
 
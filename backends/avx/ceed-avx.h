@@ -19,6 +19,18 @@
 
 #include <ceed.h>
 #include <ceed-backend.h>
+#include <stdbool.h>
+
+// The kernels are compiled for AVX2 and FMA regardless of the host, so the
+//   backends only register when the running CPU reports support
+static inline bool CeedAvxSupported(void) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+  return false;
+#endif
+}
 
 CEED_INTERN int CeedTensorContractCreate_Avx(CeedBasis basis,
     CeedTensorContract contract);
@@ -0,0 +1,60 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ceed-avx512.h"
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Avx512(const char *resource, Ceed ceed) {
+  int ierr;
+  char *resourceroot;
+  ierr = CeedGetResourceRoot(ceed, resource, &resourceroot); CeedChk(ierr);
+  if (strcmp(resourceroot, "/cpu/self")
+      && strcmp(resourceroot, "/cpu/self/avx512/serial"))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "AVX-512 backend cannot use resource: %s",
+                     resource);
+  // LCOV_EXCL_STOP
+  ierr = CeedFree(&resourceroot); CeedChk(ierr);
+  ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
+
+  // Create reference CEED that implementation will be dispatched
+  //   through unless overridden
+  Ceed ceedref;
+  CeedInitDelegate("/cpu/self/opt/serial", resource, &ceedref);
+  ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate",
+                                CeedTensorContractCreate_Avx512); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+CEED_INTERN int CeedRegister_Avx512_Serial(void) {
+  // Only offer the backend when the running CPU reports AVX-512F
+  if (!CeedAvx512Supported())
+    return 0;
+  return CeedRegister("/cpu/self/avx512/serial", CeedInit_Avx512, 32);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,382 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <immintrin.h>
+#include <stdbool.h>
+#include "ceed-avx512.h"
+
+// c += a * b
+#define fmadd(c,a,b) (c) = _mm512_fmadd_pd((a), (b), (c))
+
+//------------------------------------------------------------------------------
+// Lane mask for the first n of 8 doubles
+//------------------------------------------------------------------------------
+static inline __mmask8 CeedMask_Avx512(CeedInt n) {
+  return n >= 8 ? (__mmask8)0xFF : (__mmask8)((1u << (n > 0 ? n : 0)) - 1);
+}
+
+//------------------------------------------------------------------------------
+// Masked load of 8 entries of t with stride
+//------------------------------------------------------------------------------
+static inline __m512d CeedLoadStrided_Avx512(const CeedScalar *t,
+    CeedInt stride, __m256i index, __mmask8 mask) {
+  if (stride == 1)
+    return _mm512_maskz_loadu_pd(mask, t);
+  return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, index, t, 8);
+}
+
+//------------------------------------------------------------------------------
+// Blocked Tensor Contract
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx512_Blocked(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v, const CeedInt JJ, const CeedInt CC) {
+  CeedInt tstride0 = B, tstride1 = 1;
+  if (tmode == CEED_TRANSPOSE) {
+    tstride0 = 1; tstride1 = J;
+  }
+
+  for (CeedInt a=0; a<A; a++) {
+    // Blocks of JJ rows
+    for (CeedInt j=0; j<(J/JJ)*JJ; j+=JJ) {
+      for (CeedInt c=0; c<(C/CC)*CC; c+=CC) {
+        __m512d vv[JJ][CC/8]; // Output tile to be held in registers
+        for (CeedInt jj=0; jj<JJ; jj++)
+          for (CeedInt cc=0; cc<CC/8; cc++)
+            vv[jj][cc] = _mm512_loadu_pd(&v[(a*J+j+jj)*C+c+cc*8]);
+
+        for (CeedInt b=0; b<B; b++) {
+          for (CeedInt jj=0; jj<JJ; jj++) { // unroll
+            __m512d tqv = _mm512_set1_pd(t[(j+jj)*tstride0 + b*tstride1]);
+            for (CeedInt cc=0; cc<CC/8; cc++) // unroll
+              fmadd(vv[jj][cc], tqv, _mm512_loadu_pd(&u[(a*B+b)*C+c+cc*8]));
+          }
+        }
+        for (CeedInt jj=0; jj<JJ; jj++)
+          for (CeedInt cc=0; cc<CC/8; cc++)
+            _mm512_storeu_pd(&v[(a*J+j+jj)*C+c+cc*8], vv[jj][cc]);
+      }
+    }
+    // Remainder of rows
+    CeedInt j=(J/JJ)*JJ;
+    if (j < J) {
+      for (CeedInt c=0; c<(C/CC)*CC; c+=CC) {
+        __m512d vv[JJ][CC/8]; // Output tile to be held in registers
+        for (CeedInt jj=0; jj<J-j; jj++)
+          for (CeedInt cc=0; cc<CC/8; cc++)
+            vv[jj][cc] = _mm512_loadu_pd(&v[(a*J+j+jj)*C+c+cc*8]);
+
+        for (CeedInt b=0; b<B; b++) {
+          for (CeedInt jj=0; jj<J-j; jj++) { // doesn't unroll
+            __m512d tqv = _mm512_set1_pd(t[(j+jj)*tstride0 + b*tstride1]);
+            for (CeedInt cc=0; cc<CC/8; cc++) // unroll
+              fmadd(vv[jj][cc], tqv, _mm512_loadu_pd(&u[(a*B+b)*C+c+cc*8]));
+          }
+        }
+        for (CeedInt jj=0; jj<J-j; jj++)
+          for (CeedInt cc=0; cc<CC/8; cc++)
+            _mm512_storeu_pd(&v[(a*J+j+jj)*C+c+cc*8], vv[jj][cc]);
+      }
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Serial Tensor Contract Remainder
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx512_Remainder(
+  CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+  const CeedScalar *restrict t, CeedTransposeMode tmode, const CeedInt Add,
+  const CeedScalar *restrict u, CeedScalar *restrict v, const CeedInt JJ,
+  const CeedInt CC) {
+  CeedInt tstride0 = B, tstride1 = 1;
+  if (tmode == CEED_TRANSPOSE) {
+    tstride0 = 1; tstride1 = J;
+  }
+
+  for (CeedInt a=0; a<A; a++) {
+    // Blocks of 8 columns, the last one masked
+    for (CeedInt c=(C/CC)*CC; c<C; c+=8) {
+      const __mmask8 mask = CeedMask_Avx512(C-c);
+      // Blocks of JJ rows
+      for (CeedInt j=0; j<(J/JJ)*JJ; j+=JJ) {
+        __m512d vv[JJ]; // Output tile to be held in registers
+        for (CeedInt jj=0; jj<JJ; jj++)
+          vv[jj] = _mm512_maskz_loadu_pd(mask, &v[(a*J+j+jj)*C+c]);
+
+        for (CeedInt b=0; b<B; b++) {
+          __m512d tqu = _mm512_maskz_loadu_pd(mask, &u[(a*B+b)*C+c]);
+          for (CeedInt jj=0; jj<JJ; jj++) // unroll
+            fmadd(vv[jj], tqu, _mm512_set1_pd(t[(j+jj)*tstride0 + b*tstride1]));
+        }
+        for (CeedInt jj=0; jj<JJ; jj++)
+          _mm512_mask_storeu_pd(&v[(a*J+j+jj)*C+c], mask, vv[jj]);
+      }
+      // Remainder of rows
+      for (CeedInt j=(J/JJ)*JJ; j<J; j++) {
+        __m512d vv = _mm512_maskz_loadu_pd(mask, &v[(a*J+j)*C+c]);
+        for (CeedInt b=0; b<B; b++)
+          fmadd(vv, _mm512_maskz_loadu_pd(mask, &u[(a*B+b)*C+c]),
+                _mm512_set1_pd(t[j*tstride0 + b*tstride1]));
+        _mm512_mask_storeu_pd(&v[(a*J+j)*C+c], mask, vv);
+      }
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Serial Tensor Contract C=1
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx512_Single(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v, const CeedInt AA, const CeedInt JJ) {
+  CeedInt tstride0 = B, tstride1 = 1;
+  if (tmode == CEED_TRANSPOSE) {
+    tstride0 = 1; tstride1 = J;
+  }
+  // Gather offsets for 8 consecutive rows of t
+  const __m256i index = _mm256_mullo_epi32(_mm256_set1_epi32(tstride0),
+                        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+  // Blocks of JJ columns, the last ones masked
+  for (CeedInt j=0; j<J; j+=JJ) {
+    __mmask8 mask[JJ/8];
+    for (CeedInt jj=0; jj<JJ/8; jj++)
+      mask[jj] = CeedMask_Avx512(J-j-jj*8);
+
+    // Blocks of AA rows
+    for (CeedInt a=0; a<(A/AA)*AA; a+=AA) {
+      __m512d vv[AA][JJ/8]; // Output tile to be held in registers
+      for (CeedInt aa=0; aa<AA; aa++)
+        for (CeedInt jj=0; jj<JJ/8; jj++)
+          vv[aa][jj] = _mm512_maskz_loadu_pd(mask[jj], &v[(a+aa)*J+j+jj*8]);
+
+      for (CeedInt b=0; b<B; b++) {
+        for (CeedInt jj=0; jj<JJ/8; jj++) { // unroll
+          __m512d tqv = CeedLoadStrided_Avx512(&t[(j+jj*8)*tstride0 +
+                                                   b*tstride1],
+                                               tstride0, index, mask[jj]);
+          for (CeedInt aa=0; aa<AA; aa++) // unroll
+            fmadd(vv[aa][jj], tqv, _mm512_set1_pd(u[(a+aa)*B+b]));
+        }
+      }
+      for (CeedInt aa=0; aa<AA; aa++)
+        for (CeedInt jj=0; jj<JJ/8; jj++)
+          _mm512_mask_storeu_pd(&v[(a+aa)*J+j+jj*8], mask[jj], vv[aa][jj]);
+    }
+    // Remainder of rows
+    for (CeedInt a=(A/AA)*AA; a<A; a++) {
+      __m512d vv[JJ/8]; // Output tile to be held in registers
+      for (CeedInt jj=0; jj<JJ/8; jj++)
+        vv[jj] = _mm512_maskz_loadu_pd(mask[jj], &v[a*J+j+jj*8]);
+
+      for (CeedInt b=0; b<B; b++) {
+        __m512d tqu = _mm512_set1_pd(u[a*B+b]);
+        for (CeedInt jj=0; jj<JJ/8; jj++) // unroll
+          fmadd(vv[jj], tqu,
+                CeedLoadStrided_Avx512(&t[(j+jj*8)*tstride0 + b*tstride1],
+                                       tstride0, index, mask[jj]));
+      }
+      for (CeedInt jj=0; jj<JJ/8; jj++)
+        _mm512_mask_storeu_pd(&v[a*J+j+jj*8], mask[jj], vv[jj]);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Serial Non-Tensor Contract C=1
+//------------------------------------------------------------------------------
+// As for AVX, v = t u is taken as dot products of JJ rows of t at a time and
+//   the transpose as axpys of its contiguous rows
+static inline int CeedTensorContract_Avx512_NonTensorSingle(
+  CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+  const CeedScalar *restrict t, CeedTransposeMode tmode, const CeedInt Add,
+  const CeedScalar *restrict u, CeedScalar *restrict v, const CeedInt JJ) {
+  if (tmode == CEED_TRANSPOSE) {
+    // v_a += sum_b t[b][:] u_a[b], with t stored B x J
+    for (CeedInt a=0; a<A; a++)
+      for (CeedInt j=0; j<J; j+=8*JJ) {
+        __mmask8 mask[JJ];
+        __m512d vv[JJ]; // Output tile to be held in registers
+        for (CeedInt jj=0; jj<JJ; jj++) {
+          mask[jj] = CeedMask_Avx512(J-j-jj*8);
+          vv[jj] = _mm512_maskz_loadu_pd(mask[jj], &v[a*J+j+jj*8]);
+        }
+        for (CeedInt b=0; b<B; b++) {
+          __m512d tqu = _mm512_set1_pd(u[a*B+b]);
+          for (CeedInt jj=0; jj<JJ; jj++) // unroll
+            fmadd(vv[jj], tqu,
+                  _mm512_maskz_loadu_pd(mask[jj], &t[b*J+j+jj*8]));
+        }
+        for (CeedInt jj=0; jj<JJ; jj++)
+          _mm512_mask_storeu_pd(&v[a*J+j+jj*8], mask[jj], vv[jj]);
+      }
+    return 0;
+  }
+
+  // v_a[j] += t[j][:] . u_a, with t stored J x B
+  const __mmask8 bmask = CeedMask_Avx512(B%8);
+  for (CeedInt a=0; a<A; a++) {
+    const CeedScalar *restrict ua = &u[a*B];
+    for (CeedInt j=0; j<J; j+=JJ) {
+      const CeedInt nj = J-j < JJ ? J-j : JJ;
+      __m512d dot[JJ];
+      for (CeedInt jj=0; jj<JJ; jj++)
+        dot[jj] = _mm512_setzero_pd();
+      CeedInt b=0;
+      for (; b+8<=B; b+=8) {
+        __m512d ub = _mm512_loadu_pd(&ua[b]);
+        for (CeedInt jj=0; jj<nj; jj++)
+          fmadd(dot[jj], ub, _mm512_loadu_pd(&t[(j+jj)*B+b]));
+      }
+      if (b < B) {
+        __m512d ub = _mm512_maskz_loadu_pd(bmask, &ua[b]);
+        for (CeedInt jj=0; jj<nj; jj++)
+          fmadd(dot[jj], ub, _mm512_maskz_loadu_pd(bmask, &t[(j+jj)*B+b]));
+      }
+      for (CeedInt jj=0; jj<nj; jj++)
+        v[a*J+j+jj] += _mm512_reduce_add_pd(dot[jj]);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract - Common Sizes
+//------------------------------------------------------------------------------
+static int CeedTensorContract_Avx512_Blocked_4_16(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  return CeedTensorContract_Avx512_Blocked(contract, A, B, C, J, t, tmode, Add,
+         u, v, 4, 16);
+}
+static int CeedTensorContract_Avx512_Remainder_8_16(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  return CeedTensorContract_Avx512_Remainder(contract, A, B, C, J, t, tmode,
+         Add, u, v, 8, 16);
+}
+static int CeedTensorContract_Avx512_NonTensorSingle_4(
+  CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+  const CeedScalar *restrict t, CeedTransposeMode tmode, const CeedInt Add,
+  const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx512_NonTensorSingle(contract, A, B, C, J, t,
+         tmode, Add, u, v, 4);
+}
+static int CeedTensorContract_Avx512_Single_4_16(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  return CeedTensorContract_Avx512_Single(contract, A, B, C, J, t, tmode, Add,
+                                          u, v, 4, 16);
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Avx512(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  const CeedInt blksize = 16;
+
+  if (!Add)
+    for (CeedInt q=0; q<A*J*C; q++)
+      v[q] = (CeedScalar) 0.0;
+
+  if (C == 1) {
+    // Serial C=1 Case
+    CeedTensorContract_Avx512_Single_4_16(contract, A, B, C, J, t, tmode, true,
+                                          u, v);
+  } else {
+    // Blocks of 16 columns
+    if (C >= blksize)
+      CeedTensorContract_Avx512_Blocked_4_16(contract, A, B, C, J, t, tmode,
+                                             true, u, v);
+    // Remainder of columns, masked
+    if (C % blksize)
+      CeedTensorContract_Avx512_Remainder_8_16(contract, A, B, C, J, t, tmode,
+          true, u, v);
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Non-Tensor Contract Apply
+//------------------------------------------------------------------------------
+// Only single elements take the dot product kernel, element batches map onto
+//   the masked tensor kernels as well as any tile tried
+static int CeedTensorContractApplyNonTensor_Avx512(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  // Matrices narrower than two vectors are better served by the tensor kernels
+  if (C != 1 || B < 16 || J < 16)
+    return CeedTensorContractApply_Avx512(contract, A, B, C, J, t, tmode, Add,
+                                          u, v);
+
+  if (!Add)
+    for (CeedInt q=0; q<A*J; q++)
+      v[q] = (CeedScalar) 0.0;
+
+  CeedTensorContract_Avx512_NonTensorSingle_4(contract, A, B, C, J, t, tmode,
+      true, u, v);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Destroy
+//------------------------------------------------------------------------------
+static int CeedTensorContractDestroy_Avx512(CeedTensorContract contract) {
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Create
+//------------------------------------------------------------------------------
+int CeedTensorContractCreate_Avx512(CeedBasis basis,
+                                    CeedTensorContract contract) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChk(ierr);
+  bool istensor;
+  ierr = CeedBasisIsTensor(basis, &istensor); CeedChk(ierr);
+
+  if (istensor) {
+    ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
+                                  CeedTensorContractApply_Avx512); CeedChk(ierr);
+  } else {
+    ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
+                                  CeedTensorContractApplyNonTensor_Avx512);
+    CeedChk(ierr);
+  }
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy",
+                                CeedTensorContractDestroy_Avx512); CeedChk(ierr);
+
+  return 0;
+}
+//------------------------------------------------------------------------------
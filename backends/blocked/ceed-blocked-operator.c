@@ -26,14 +26,11 @@
 //------------------------------------------------------------------------------
 static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
     CeedOperator op, bool inOrOut,
-    CeedElemRestriction *blkrestr,
-    CeedVector *fullevecs, CeedVector *evecs,
-    CeedVector *qvecs, CeedInt starte,
-    CeedInt numfields, CeedInt Q) {
-  CeedInt dim, ierr, ncomp, size, P;
+    CeedElemRestriction *blkrestr, CeedInt starte,
+    CeedInt numfields) {
+  CeedInt ierr, ncomp;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  CeedBasis basis;
   CeedElemRestriction r;
   CeedOperatorField *opfields;
   CeedQFunctionField *qffields;
@@ -48,7 +45,9 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
     ierr = CeedQFunctionGetFields(qf, &qffields, NULL);
     CeedChk(ierr);
   }
-  const CeedInt blksize = 8;
+  CeedOperator_Blocked *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  const CeedInt blksize = impl->blksize;
 
   // Loop over fields
   for (CeedInt i=0; i<numfields; i++) {
@@ -59,20 +58,34 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
       ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &r);
       CeedChk(ierr);
       ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
-      CeedInt nelem, elemsize, lsize, compstride;
+      CeedInt nelem, elemsize, compstride;
+      CeedSize lsize;
       ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
       ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
       ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
       ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
 
-      bool strided;
+      bool strided, hasoffsets64;
       ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChk(ierr);
+      ierr = CeedElemRestrictionHasOffsets64(r, &hasoffsets64); CeedChk(ierr);
       if (strided) {
         CeedInt strides[3];
         ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
         ierr = CeedElemRestrictionCreateBlockedStrided(ceed, nelem, elemsize,
                blksize, ncomp, lsize, strides, &blkrestr[i+starte]);
         CeedChk(ierr);
+      } else if (hasoffsets64) {
+        const CeedSize *offsets = NULL;
+        ierr = CeedElemRestrictionGetOffsets64(r, CEED_MEM_HOST, &offsets);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+        ierr = CeedElemRestrictionCreateBlocked64(ceed, nelem, elemsize,
+                                                  blksize, ncomp, compstride,
+                                                  lsize, CEED_MEM_HOST,
+                                                  CEED_COPY_VALUES, offsets,
+                                                  &blkrestr[i+starte]);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionRestoreOffsets64(r, &offsets); CeedChk(ierr);
       } else {
         const CeedInt *offsets = NULL;
         ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
@@ -86,10 +99,42 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
         CeedChk(ierr);
         ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
       }
-      ierr = CeedElemRestrictionCreateVector(blkrestr[i+starte], NULL,
-                                             &fullevecs[i+starte]);
-      CeedChk(ierr);
     }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Input/Output E-vectors and Q-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFieldVectors_Blocked(CeedQFunction qf,
+    CeedOperator op, bool inOrOut, const CeedInt blksize,
+    CeedElemRestriction *blkrestr, CeedVector *evecs,
+    CeedVector *qvecs, CeedInt starte,
+    CeedInt numfields, CeedInt Q) {
+  CeedInt dim, ierr, size, P;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedBasis basis;
+  CeedOperatorField *opfields;
+  CeedQFunctionField *qffields;
+  if (inOrOut) {
+    ierr = CeedOperatorGetFields(op, NULL, &opfields);
+    CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, NULL, &qffields);
+    CeedChk(ierr);
+  } else {
+    ierr = CeedOperatorGetFields(op, &opfields, NULL);
+    CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, &qffields, NULL);
+    CeedChk(ierr);
+  }
+
+  // Loop over fields
+  for (CeedInt i=0; i<numfields; i++) {
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+    CeedElemRestriction r = blkrestr[i+starte];
 
     switch(emode) {
     case CEED_EVAL_NONE:
@@ -129,6 +174,72 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Setup Scratch E-vectors and Q-vectors
+//------------------------------------------------------------------------------
+// Single block E- and Q-vectors; a CeedOperatorWorkspace gets its own,
+//   sharing the blocked restrictions of the operator
+static int CeedOperatorSetupScratch_Blocked(CeedOperator op,
+    CeedOperator_Blocked *impl) {
+  int ierr;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt Q;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  const CeedInt numinputfields = impl->numein,
+                numoutputfields = impl->numeout;
+
+  // Allocate
+  ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+
+  // Infields
+  ierr = CeedOperatorSetupFieldVectors_Blocked(qf, op, 0, impl->blksize,
+         impl->blkrestr, impl->evecsin, impl->qvecsin, 0, numinputfields, Q);
+  CeedChk(ierr);
+  // Outfields
+  ierr = CeedOperatorSetupFieldVectors_Blocked(qf, op, 1, impl->blksize,
+         impl->blkrestr, impl->evecsout, impl->qvecsout, numinputfields,
+         numoutputfields, Q);
+  CeedChk(ierr);
+
+  // Identity QFunctions
+  if (impl->identityqf) {
+    for (CeedInt i=0; i<numinputfields; i++) {
+      ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
+      impl->qvecsout[i] = impl->qvecsin[i];
+      ierr = CeedVectorAddReference(impl->qvecsin[i]); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Destroy Scratch E-vectors and Q-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyScratch_Blocked(CeedOperator_Blocked *impl) {
+  int ierr;
+  // The arrays are allocated together, qvecsout last
+  const bool allocated = impl->qvecsout;
+
+  for (CeedInt i=0; i<impl->numein && allocated; i++) {
+    ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->qvecsin[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->evecsin); CeedChk(ierr);
+  ierr = CeedFree(&impl->qvecsin); CeedChk(ierr);
+
+  for (CeedInt i=0; i<impl->numeout && allocated; i++) {
+    ierr = CeedVectorDestroy(&impl->evecsout[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->evecsout); CeedChk(ierr);
+  ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------
@@ -137,71 +248,33 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
   bool setupdone;
   ierr = CeedOperatorIsSetupDone(op, &setupdone); CeedChk(ierr);
   if (setupdone) return 0;
-  Ceed ceed;
-  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
   CeedOperator_Blocked *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
   CeedQFunction qf;
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
-  CeedInt Q, numinputfields, numoutputfields;
-  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
   ierr = CeedQFunctionIsIdentity(qf, &impl->identityqf); CeedChk(ierr);
   ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
   CeedChk(ierr);
-  CeedOperatorField *opinputfields, *opoutputfields;
-  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
-  CeedChk(ierr);
-  CeedQFunctionField *qfinputfields, *qfoutputfields;
-  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
-  CeedChk(ierr);
 
   // Allocate
   ierr = CeedCalloc(numinputfields + numoutputfields, &impl->blkrestr);
   CeedChk(ierr);
-  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->evecs);
-  CeedChk(ierr);
-  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
-  CeedChk(ierr);
-
-  ierr = CeedCalloc(16, &impl->inputstate); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
 
   impl->numein = numinputfields; impl->numeout = numoutputfields;
 
-  // Set up infield and outfield pointer arrays
+  // Set up blocked restrictions
   // Infields
-  ierr = CeedOperatorSetupFields_Blocked(qf, op, 0, impl->blkrestr,
-                                         impl->evecs, impl->evecsin,
-                                         impl->qvecsin, 0,
-                                         numinputfields, Q);
+  ierr = CeedOperatorSetupFields_Blocked(qf, op, 0, impl->blkrestr, 0,
+                                         numinputfields);
   CeedChk(ierr);
   // Outfields
   ierr = CeedOperatorSetupFields_Blocked(qf, op, 1, impl->blkrestr,
-                                         impl->evecs, impl->evecsout,
-                                         impl->qvecsout, numinputfields,
-                                         numoutputfields, Q);
+                                         numinputfields, numoutputfields);
   CeedChk(ierr);
 
-  // Identity QFunctions
-  if (impl->identityqf) {
-    CeedEvalMode inmode, outmode;
-    CeedQFunctionField *infields, *outfields;
-    ierr = CeedQFunctionGetFields(qf, &infields, &outfields); CeedChk(ierr);
-
-    for (CeedInt i=0; i<numinputfields; i++) {
-      ierr = CeedQFunctionFieldGetEvalMode(infields[i], &inmode);
-      CeedChk(ierr);
-      ierr = CeedQFunctionFieldGetEvalMode(outfields[i], &outmode);
-      CeedChk(ierr);
-
-      ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
-      impl->qvecsout[i] = impl->qvecsin[i];
-      ierr = CeedVectorAddReference(impl->qvecsin[i]); CeedChk(ierr);
-    }
-  }
+  // E-vectors and Q-vectors for the operator's own application
+  ierr = CeedOperatorSetupScratch_Blocked(op, impl); CeedChk(ierr);
 
   ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
 
@@ -209,16 +282,16 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
 }
 
 //------------------------------------------------------------------------------
-// Setup Operator Inputs
+// Input Restriction and Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorSetupInputs_Blocked(CeedInt numinputfields,
+static inline int CeedOperatorInputBasis_Blocked(CeedInt e,
     CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
-    CeedVector invec, bool skipactive, CeedOperator_Blocked *impl,
-    CeedRequest *request) {
+    CeedInt numinputfields, CeedInt blksize, CeedVector invec, bool skipactive,
+    CeedOperator_Blocked *impl, CeedRequest *request) {
   CeedInt ierr;
   CeedEvalMode emode;
+  CeedBasis basis;
   CeedVector vec;
-  uint64_t state;
 
   for (CeedInt i=0; i<numinputfields; i++) {
     // Get input vector
@@ -229,82 +302,29 @@ static inline int CeedOperatorSetupInputs_Blocked(CeedInt numinputfields,
       else
         vec = invec;
     }
-
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-    CeedChk(ierr);
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
-    } else {
-      // Restrict
-      ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
-      if (state != impl->inputstate[i] || vec == invec) {
-        ierr = CeedElemRestrictionApply(impl->blkrestr[i], CEED_NOTRANSPOSE,
-                                        vec, impl->evecs[i], request);
-        CeedChk(ierr);
-        impl->inputstate[i] = state;
-      }
-      // Get evec
-      ierr = CeedVectorGetArrayRead(impl->evecs[i], CEED_MEM_HOST,
-                                    (const CeedScalar **) &impl->edata[i]);
-      CeedChk(ierr);
-    }
-  }
-  return 0;
-}
-
-//------------------------------------------------------------------------------
-// Input Basis Action
-//------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
-    CeedInt numinputfields, CeedInt blksize, bool skipactive,
-    CeedOperator_Blocked *impl) {
-  CeedInt ierr;
-  CeedInt dim, elemsize, size;
-  CeedElemRestriction Erestrict;
-  CeedEvalMode emode;
-  CeedBasis basis;
-
-  for (CeedInt i=0; i<numinputfields; i++) {
-    // Skip active input
-    if (skipactive) {
-      CeedVector vec;
-      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-      if (vec == CEED_VECTOR_ACTIVE)
-        continue;
-    }
-
-    // Get elemsize, emode, size
-    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
-    CeedChk(ierr);
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT)
+      continue;
+
+    // Restrict block
+    ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i], e/blksize,
+                                         CEED_NOTRANSPOSE, vec,
+                                         emode == CEED_EVAL_NONE ?
+                                         impl->qvecsin[i] : impl->evecsin[i],
+                                         request); CeedChk(ierr);
     // Basis action
     switch(emode) {
     case CEED_EVAL_NONE:
-      ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i][e*Q*size]); CeedChk(ierr);
-      break;
+      break;  // No action
     case CEED_EVAL_INTERP:
       ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i][e*elemsize*size]);
-      CeedChk(ierr);
       ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
                             CEED_EVAL_INTERP, impl->evecsin[i],
                             impl->qvecsin[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_GRAD:
       ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
-      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i][e*elemsize*size/dim]);
-      CeedChk(ierr);
       ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
                             CEED_EVAL_GRAD, impl->evecsin[i],
                             impl->qvecsin[i]); CeedChk(ierr);
@@ -327,27 +347,21 @@ static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q,
 }
 
 //------------------------------------------------------------------------------
-// Output Basis Action
+// Output Basis Action and Restriction
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q,
+static inline int CeedOperatorOutputBasis_Blocked(CeedInt e,
     CeedQFunctionField *qfoutputfields, CeedOperatorField *opoutputfields,
     CeedInt blksize, CeedInt numinputfields, CeedInt numoutputfields,
-    CeedOperator op, CeedOperator_Blocked *impl) {
+    CeedVector outvec, CeedOperator op, CeedOperator_Blocked *impl,
+    CeedRequest *request) {
   CeedInt ierr;
-  CeedInt dim, elemsize, size;
-  CeedElemRestriction Erestrict;
   CeedEvalMode emode;
   CeedBasis basis;
+  CeedVector vec;
 
   for (CeedInt i=0; i<numoutputfields; i++) {
-    // Get elemsize, emode, size
-    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
-    CeedChk(ierr);
     ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
     CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size); CeedChk(ierr);
     // Basis action
     switch(emode) {
     case CEED_EVAL_NONE:
@@ -355,10 +369,6 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q,
     case CEED_EVAL_INTERP:
       ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
       CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsout[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i + numinputfields][e*elemsize*size]);
-      CeedChk(ierr);
       ierr = CeedBasisApply(basis, blksize, CEED_TRANSPOSE,
                             CEED_EVAL_INTERP, impl->qvecsout[i],
                             impl->evecsout[i]); CeedChk(ierr);
@@ -366,11 +376,6 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q,
     case CEED_EVAL_GRAD:
       ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
       CeedChk(ierr);
-      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsout[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i + numinputfields][e*elemsize*size/dim]);
-      CeedChk(ierr);
       ierr = CeedBasisApply(basis, blksize, CEED_TRANSPOSE,
                             CEED_EVAL_GRAD, impl->qvecsout[i],
                             impl->evecsout[i]); CeedChk(ierr);
@@ -390,50 +395,32 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q,
       // LCOV_EXCL_STOP
     }
     }
-  }
-  return 0;
-}
 
-//------------------------------------------------------------------------------
-// Restore Input Vectors
-//------------------------------------------------------------------------------
-static inline int CeedOperatorRestoreInputs_Blocked(CeedInt numinputfields,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
-    bool skipactive, CeedOperator_Blocked *impl) {
-  CeedInt ierr;
-  CeedEvalMode emode;
-
-  for (CeedInt i=0; i<numinputfields; i++) {
-    // Skip active inputs
-    if (skipactive) {
-      CeedVector vec;
-      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-      if (vec == CEED_VECTOR_ACTIVE)
-        continue;
-    }
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-    CeedChk(ierr);
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
-    } else {
-      ierr = CeedVectorRestoreArrayRead(impl->evecs[i],
-                                        (const CeedScalar **) &impl->edata[i]);
-      CeedChk(ierr);
-    }
+    // Get output vector
+    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE)
+      vec = outvec;
+    // Scatter block, directly from the Q-vector for CEED_EVAL_NONE
+    ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i+numinputfields],
+                                         e/blksize, CEED_TRANSPOSE,
+                                         emode == CEED_EVAL_NONE ?
+                                         impl->qvecsout[i] : impl->evecsout[i],
+                                         vec, request); CeedChk(ierr);
   }
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Apply Element Blocks
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector invec,
-                                        CeedVector outvec,
-                                        CeedRequest *request) {
+// The scratch vectors in impl are those of the operator or of one of its
+//   CeedOperatorWorkspaces
+static int CeedOperatorApplyAddBlocks_Blocked(CeedOperator op,
+    CeedOperator_Blocked *impl, CeedVector invec, CeedVector outvec,
+    CeedRequest *request) {
   int ierr;
-  CeedOperator_Blocked *impl;
-  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
-  const CeedInt blksize = 8;
-  CeedInt Q, numinputfields, numoutputfields, numelements, size;
+  const CeedInt blksize = impl->blksize;
+  CeedInt Q, numinputfields, numoutputfields, numelements;
   ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
   ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
   CeedInt nblks = (numelements/blksize) + !!(numelements%blksize);
@@ -447,43 +434,13 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector invec,
   CeedQFunctionField *qfinputfields, *qfoutputfields;
   ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
   CeedChk(ierr);
-  CeedEvalMode emode;
-  CeedVector vec;
-
-  // Setup
-  ierr = CeedOperatorSetup_Blocked(op); CeedChk(ierr);
-
-  // Input Evecs and Restriction
-  ierr = CeedOperatorSetupInputs_Blocked(numinputfields, qfinputfields,
-                                         opinputfields, invec, false, impl,
-                                         request); CeedChk(ierr);
-
-  // Output Evecs
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    ierr = CeedVectorGetArray(impl->evecs[i+impl->numein], CEED_MEM_HOST,
-                              &impl->edata[i + numinputfields]); CeedChk(ierr);
-  }
 
   // Loop through elements
   for (CeedInt e=0; e<nblks*blksize; e+=blksize) {
-    // Output pointers
-    for (CeedInt i=0; i<numoutputfields; i++) {
-      ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
-      CeedChk(ierr);
-      if (emode == CEED_EVAL_NONE) {
-        ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size);
-        CeedChk(ierr);
-        ierr = CeedVectorSetArray(impl->qvecsout[i], CEED_MEM_HOST,
-                                  CEED_USE_POINTER,
-                                  &impl->edata[i + numinputfields][e*Q*size]);
-        CeedChk(ierr);
-      }
-    }
-
-    // Input basis apply
-    ierr = CeedOperatorInputBasis_Blocked(e, Q, qfinputfields, opinputfields,
-                                          numinputfields, blksize, false, impl);
-    CeedChk(ierr);
+    // Input restriction and basis apply
+    ierr = CeedOperatorInputBasis_Blocked(e, qfinputfields, opinputfields,
+                                          numinputfields, blksize, invec, false,
+                                          impl, request); CeedChk(ierr);
 
     // Q function
     if (!impl->identityqf) {
@@ -491,34 +448,79 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector invec,
       CeedChk(ierr);
     }
 
-    // Output basis apply
-    ierr = CeedOperatorOutputBasis_Blocked(e, Q, qfoutputfields, opoutputfields,
+    // Output basis apply and restriction
+    ierr = CeedOperatorOutputBasis_Blocked(e, qfoutputfields, opoutputfields,
                                            blksize, numinputfields,
-                                           numoutputfields, op, impl);
-    CeedChk(ierr);
+                                           numoutputfields, outvec, op, impl,
+                                           request); CeedChk(ierr);
   }
 
-  // Output restriction
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    // Restore evec
-    ierr = CeedVectorRestoreArray(impl->evecs[i+impl->numein],
-                                  &impl->edata[i + numinputfields]); CeedChk(ierr);
-    // Get output vector
-    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
-    // Active
-    if (vec == CEED_VECTOR_ACTIVE)
-      vec = outvec;
-    // Restrict
-    ierr = CeedElemRestrictionApply(impl->blkrestr[i+impl->numein],
-                                    CEED_TRANSPOSE, impl->evecs[i+impl->numein],
-                                    vec, request); CeedChk(ierr);
+  return 0;
+}
 
-  }
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector invec,
+                                        CeedVector outvec,
+                                        CeedRequest *request) {
+  int ierr;
+  CeedOperator_Blocked *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  // Setup
+  ierr = CeedOperatorSetup_Blocked(op); CeedChk(ierr);
 
-  // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Blocked(numinputfields, qfinputfields,
-         opinputfields, false, impl); CeedChk(ierr);
+  return CeedOperatorApplyAddBlocks_Blocked(op, impl, invec, outvec, request);
+}
 
+//------------------------------------------------------------------------------
+// Workspace Create
+//------------------------------------------------------------------------------
+// The workspace shares the blocked restrictions of the operator and owns only
+//   its E-vectors and Q-vectors
+static int CeedOperatorWorkspaceCreate_Blocked(CeedOperator op,
+    CeedOperatorWorkspace ws) {
+  int ierr;
+  CeedOperator_Blocked *impl, *wsimpl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  ierr = CeedCalloc(1, &wsimpl); CeedChk(ierr);
+  ierr = CeedOperatorWorkspaceSetData(ws, wsimpl); CeedChk(ierr);
+  wsimpl->identityqf = impl->identityqf;
+  wsimpl->blksize = impl->blksize;
+  wsimpl->blkrestr = impl->blkrestr;
+  wsimpl->numein = impl->numein;
+  wsimpl->numeout = impl->numeout;
+  ierr = CeedOperatorSetupScratch_Blocked(op, wsimpl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Workspace Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorWorkspaceApplyAdd_Blocked(CeedOperatorWorkspace ws,
+    CeedVector invec, CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  CeedOperator op;
+  ierr = CeedOperatorWorkspaceGetOperator(ws, &op); CeedChk(ierr);
+  CeedOperator_Blocked *wsimpl;
+  ierr = CeedOperatorWorkspaceGetData(ws, &wsimpl); CeedChk(ierr);
+
+  return CeedOperatorApplyAddBlocks_Blocked(op, wsimpl, invec, outvec,
+         request);
+}
+
+//------------------------------------------------------------------------------
+// Workspace Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorWorkspaceDestroy_Blocked(CeedOperatorWorkspace ws) {
+  int ierr;
+  CeedOperator_Blocked *wsimpl;
+  ierr = CeedOperatorWorkspaceGetData(ws, &wsimpl); CeedChk(ierr);
+
+  ierr = CeedOperatorDestroyScratch_Blocked(wsimpl); CeedChk(ierr);
+  ierr = CeedFree(&wsimpl); CeedChk(ierr);
   return 0;
 }
 
@@ -530,7 +532,7 @@ static int CeedOperatorLinearAssembleQFunction_Blocked(CeedOperator op,
   int ierr;
   CeedOperator_Blocked *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
-  const CeedInt blksize = 8;
+  const CeedInt blksize = impl->blksize;
   CeedInt Q, numinputfields, numoutputfields, numelements, size;
   ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
   ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
@@ -561,11 +563,6 @@ static int CeedOperatorLinearAssembleQFunction_Blocked(CeedOperator op,
     return CeedError(ceed, 1, "Assembling identity qfunctions not supported");
   // LCOV_EXCL_STOP
 
-  // Input Evecs and Restriction
-  ierr = CeedOperatorSetupInputs_Blocked(numinputfields, qfinputfields,
-                                         opinputfields, NULL, true, impl,
-                                         request); CeedChk(ierr);
-
   // Count number of active input fields
   for (CeedInt i=0; i<numinputfields; i++) {
     // Get input vector
@@ -615,19 +612,20 @@ static int CeedOperatorLinearAssembleQFunction_Blocked(CeedOperator op,
   // Create output restriction
   CeedInt strides[3] = {1, Q, numactivein *numactiveout*Q};
   ierr = CeedElemRestrictionCreateStrided(ceed, numelements, Q,
-                                          numactivein*numactiveout,
-                                          numactivein*numactiveout*numelements*Q,
-                                          strides, rstr); CeedChk(ierr);
+         numactivein*numactiveout,
+         (CeedSize)numactivein*numactiveout*numelements*Q,
+         strides, rstr); CeedChk(ierr);
   // Create assembled vector
-  ierr = CeedVectorCreate(ceed, numelements*Q*numactivein*numactiveout,
+  ierr = CeedVectorCreate(ceed,
+                          (CeedSize)numelements*Q*numactivein*numactiveout,
                           assembled); CeedChk(ierr);
 
   // Loop through elements
   for (CeedInt e=0; e<nblks*blksize; e+=blksize) {
-    // Input basis apply
-    ierr = CeedOperatorInputBasis_Blocked(e, Q, qfinputfields, opinputfields,
-                                          numinputfields, blksize, true, impl);
-    CeedChk(ierr);
+    // Input restriction and basis apply
+    ierr = CeedOperatorInputBasis_Blocked(e, qfinputfields, opinputfields,
+                                          numinputfields, blksize, NULL, true,
+                                          impl, request); CeedChk(ierr);
 
     // Assemble QFunction
     for (CeedInt in=0; in<numactivein; in++) {
@@ -669,16 +667,13 @@ static int CeedOperatorLinearAssembleQFunction_Blocked(CeedOperator op,
     }
   }
 
-  // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Blocked(numinputfields, qfinputfields,
-         opinputfields, true, impl); CeedChk(ierr);
-
   // Output blocked restriction
   ierr = CeedVectorRestoreArray(lvec, &a); CeedChk(ierr);
   ierr = CeedVectorSetValue(*assembled, 0.0); CeedChk(ierr);
   CeedElemRestriction blkrstr;
   ierr = CeedElemRestrictionCreateBlockedStrided(ceed, numelements, Q, blksize,
-         numactivein*numactiveout, numactivein*numactiveout*numelements*Q,
+         numactivein*numactiveout,
+         (CeedSize)numactivein*numactiveout*numelements*Q,
          strides, &blkrstr); CeedChk(ierr);
   ierr = CeedElemRestrictionApply(blkrstr, CEED_TRANSPOSE, lvec, *assembled,
                                   request); CeedChk(ierr);
@@ -694,6 +689,39 @@ static int CeedOperatorLinearAssembleQFunction_Blocked(CeedOperator op,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Operator Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedOperatorGetMemoryUsage_Blocked(CeedOperator op,
+    CeedSize *bytes) {
+  int ierr;
+  CeedOperator_Blocked *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedSize objbytes;
+
+  *bytes = 0;
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    ierr = CeedElemRestrictionGetMemoryUsage(impl->blkrestr[i], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+  }
+  for (CeedInt i=0; i<impl->numein; i++) {
+    ierr = CeedVectorGetMemoryUsage(impl->evecsin[i], &objbytes); CeedChk(ierr);
+    *bytes += objbytes;
+    ierr = CeedVectorGetMemoryUsage(impl->qvecsin[i], &objbytes); CeedChk(ierr);
+    *bytes += objbytes;
+  }
+  for (CeedInt i=0; i<impl->numeout; i++) {
+    ierr = CeedVectorGetMemoryUsage(impl->evecsout[i], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+    ierr = CeedVectorGetMemoryUsage(impl->qvecsout[i], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -704,26 +732,10 @@ static int CeedOperatorDestroy_Blocked(CeedOperator op) {
 
   for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
     ierr = CeedElemRestrictionDestroy(&impl->blkrestr[i]); CeedChk(ierr);
-    ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
   }
   ierr = CeedFree(&impl->blkrestr); CeedChk(ierr);
-  ierr = CeedFree(&impl->evecs); CeedChk(ierr);
-  ierr = CeedFree(&impl->edata); CeedChk(ierr);
-  ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
 
-  for (CeedInt i=0; i<impl->numein; i++) {
-    ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
-    ierr = CeedVectorDestroy(&impl->qvecsin[i]); CeedChk(ierr);
-  }
-  ierr = CeedFree(&impl->evecsin); CeedChk(ierr);
-  ierr = CeedFree(&impl->qvecsin); CeedChk(ierr);
-
-  for (CeedInt i=0; i<impl->numeout; i++) {
-    ierr = CeedVectorDestroy(&impl->evecsout[i]); CeedChk(ierr);
-    ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
-  }
-  ierr = CeedFree(&impl->evecsout); CeedChk(ierr);
-  ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+  ierr = CeedOperatorDestroyScratch_Blocked(impl); CeedChk(ierr);
 
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
@@ -736,16 +748,33 @@ int CeedOperatorCreate_Blocked(CeedOperator op) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Blocked *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
   CeedOperator_Blocked *impl;
 
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  impl->blksize = ceedimpl->blksize;
   ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction",
                                 CeedOperatorLinearAssembleQFunction_Blocked);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Setup",
+                                CeedOperatorSetup_Blocked); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Blocked); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "GetMemoryUsage",
+                                CeedOperatorGetMemoryUsage_Blocked);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceCreate",
+                                CeedOperatorWorkspaceCreate_Blocked);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceApplyAdd",
+                                CeedOperatorWorkspaceApplyAdd_Blocked);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceDestroy",
+                                CeedOperatorWorkspaceDestroy_Blocked);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Blocked); CeedChk(ierr);
   return 0;
@@ -19,17 +19,33 @@
 #include <stdbool.h>
 #include <string.h>
 #include "ceed-blocked.h"
+#include "../ref/ceed-ref.h"
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Blocked(Ceed ceed) {
+  int ierr;
+  Ceed_Blocked *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedFree(&data); CeedChk(ierr);
+
+  return 0;
+}
 
 //------------------------------------------------------------------------------
 // Backend Init
 //------------------------------------------------------------------------------
 CEED_INTERN int CeedInit_Blocked(const char *resource, Ceed ceed) {
   int ierr;
-  if (strcmp(resource, "/cpu/self")
-      && strcmp(resource, "/cpu/self/ref/blocked"))
+  char *resourceroot;
+  ierr = CeedGetResourceRoot(ceed, resource, &resourceroot); CeedChk(ierr);
+  if (strcmp(resourceroot, "/cpu/self")
+      && strcmp(resourceroot, "/cpu/self/ref/blocked"))
     // LCOV_EXCL_START
     return CeedError(ceed, 1, "Blocked backend cannot use resource: %s", resource);
   // LCOV_EXCL_STOP
+  ierr = CeedFree(&resourceroot); CeedChk(ierr);
   ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
 
   // Create reference CEED that implementation will be dispatched
@@ -38,9 +54,24 @@ CEED_INTERN int CeedInit_Blocked(const char *resource, Ceed ceed) {
   CeedInit("/cpu/self/ref/serial", &ceedref);
   ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
 
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
+                                CeedDestroy_Blocked); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate",
                                 CeedOperatorCreate_Blocked); CeedChk(ierr);
 
+  // Set blocksize, default 8 unless given as resource option
+  Ceed_Blocked *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+  data->blksize = 8;
+  ierr = CeedGetBlockSizeOption_Ref(ceed, resource, &data->blksize, NULL);
+  if (ierr) {
+    // LCOV_EXCL_START
+    CeedFree(&data);
+    return ierr;
+    // LCOV_EXCL_STOP
+  }
+  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+
   return 0;
 }
 
@@ -22,19 +22,20 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+typedef struct {
+  CeedInt blksize;
+} Ceed_Blocked;
+
 typedef struct {
   CeedScalar *colograd1d;
 } CeedBasis_Blocked;
 
 typedef struct {
   bool identityqf;
+  CeedInt blksize;               /// Element block size
   CeedElemRestriction *blkrestr; /// Blocked versions of restrictions
-  CeedVector
-  *evecs;   /// E-vectors needed to apply operator (input followed by outputs)
-  CeedScalar **edata;
-  uint64_t *inputstate;  /// State counter of inputs
-  CeedVector *evecsin;   /// Input E-vectors needed to apply operator
-  CeedVector *evecsout;  /// Output E-vectors needed to apply operator
+  CeedVector *evecsin;   /// Single block input E-vectors
+  CeedVector *evecsout;  /// Single block output E-vectors
   CeedVector *qvecsin;   /// Input Q-vectors needed to apply operator
   CeedVector *qvecsout;  /// Output Q-vectors needed to apply operator
   CeedInt    numein;
@@ -7,6 +7,8 @@
 
 MACRO(CeedRegister_Avx_Blocked)
 MACRO(CeedRegister_Avx_Serial)
+MACRO(CeedRegister_Avx512_Blocked)
+MACRO(CeedRegister_Avx512_Serial)
 MACRO(CeedRegister_Cuda)
 MACRO(CeedRegister_Cuda_Gen)
 MACRO(CeedRegister_Cuda_Shared)
@@ -18,6 +20,8 @@ MACRO(CeedRegister_Magma_Det)
 MACRO(CeedRegister_Memcheck_Blocked)
 MACRO(CeedRegister_Memcheck_Serial)
 MACRO(CeedRegister_Occa)
+MACRO(CeedRegister_Omp_Blocked)
+MACRO(CeedRegister_Omp_Serial)
 MACRO(CeedRegister_Opt_Blocked)
 MACRO(CeedRegister_Opt_Serial)
 MACRO(CeedRegister_Ref)
@@ -765,7 +765,8 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
   ierr = CeedQFunctionGetData(qf, &qf_data); CeedChk(ierr);
   CeedInt Q, P1d, Q1d = 0, numelements, elemsize, numinputfields,
-          numoutputfields, ncomp, dim = 0, lsize;
+          numoutputfields, ncomp, dim = 0;
+  CeedSize lsize;
   ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
   ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
   ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
@@ -19,6 +19,7 @@
 #include <cublas_v2.h>
 #include <cuda_runtime.h>
 #include <math.h>
+#include <stdint.h>
 #include <string.h>
 #include "ceed-cuda.h"
 
@@ -27,7 +28,7 @@
 //------------------------------------------------------------------------------
 static inline size_t bytes(const CeedVector vec) {
   int ierr;
-  CeedInt length;
+  CeedSize length;
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
   return length * sizeof(CeedScalar);
 }
@@ -74,7 +75,7 @@ static int CeedVectorSetArrayHost_Cuda(const CeedVector vec,
 
   switch (cmode) {
   case CEED_COPY_VALUES: {
-    CeedInt length;
+    CeedSize length;
     if(!data->h_array) {
       ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
       ierr = CeedMalloc(length, &data->h_array_allocated); CeedChk(ierr);
@@ -216,7 +217,7 @@ static int CeedVectorSetValue_Cuda(CeedVector vec, CeedScalar val) {
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Cuda *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
-  CeedInt length;
+  CeedSize length;
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
 
   // Set value for synced device/host array
@@ -266,7 +267,7 @@ static int CeedVectorGetArrayRead_Cuda(const CeedVector vec,
   switch (mtype) {
   case CEED_MEM_HOST:
     if(data->h_array==NULL) {
-      CeedInt length;
+      CeedSize length;
       ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
       ierr = CeedMalloc(length, &data->h_array_allocated);
       CeedChk(ierr);
@@ -312,7 +313,7 @@ static int CeedVectorGetArray_Cuda(const CeedVector vec,
   switch (mtype) {
   case CEED_MEM_HOST:
     if(data->h_array==NULL) {
-      CeedInt length;
+      CeedSize length;
       ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
       ierr = CeedMalloc(length, &data->h_array_allocated);
       CeedChk(ierr);
@@ -364,7 +365,7 @@ static int CeedVectorNorm_Cuda(CeedVector vec, CeedNormType type,
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Cuda *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
-  CeedInt length;
+  CeedSize length;
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
   cublasHandle_t handle;
   ierr = CeedCudaGetCublasHandle(ceed, &handle); CeedChk(ierr);
@@ -423,7 +424,7 @@ static int CeedVectorReciprocal_Cuda(CeedVector vec) {
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Cuda *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
-  CeedInt length;
+  CeedSize length;
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
 
   // Set value for synced device/host array
@@ -465,11 +466,17 @@ static int CeedVectorDestroy_Cuda(const CeedVector vec) {
 //------------------------------------------------------------------------------
 // Create a vector of the specified length (does not allocate memory)
 //------------------------------------------------------------------------------
-int CeedVectorCreate_Cuda(CeedInt n, CeedVector vec) {
+int CeedVectorCreate_Cuda(CeedSize n, CeedVector vec) {
   CeedVector_Cuda *data;
   int ierr;
   Ceed ceed;
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  // The kernels index vectors with int
+  if (n > INT32_MAX)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Vector length %ld exceeds the range supported "
+                     "by the CUDA backends", (long)n);
+  // LCOV_EXCL_STOP
 
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetArray",
                                 CeedVectorSetArray_Cuda); CeedChk(ierr);
@@ -858,7 +858,7 @@ int CeedBasisApplyTensor_Hip_shared(CeedBasis basis, const CeedInt nelem,
 
   // Clear v for transpose mode
   if (tmode == CEED_TRANSPOSE) {
-    CeedInt length;
+    CeedSize length;
     ierr = CeedVectorGetLength(v, &length); CeedChk(ierr);
     ierr = hipMemset(d_v, 0, length * sizeof(CeedScalar)); CeedChk(ierr);
   }
@@ -363,7 +363,7 @@ int CeedBasisApply_Hip(CeedBasis basis, const CeedInt nelem,
 
   // Clear v for transpose operation
   if (tmode == CEED_TRANSPOSE) {
-    CeedInt length;
+    CeedSize length;
     ierr = CeedVectorGetLength(v, &length); CeedChk(ierr);
     ierr = hipMemset(d_v, 0, length * sizeof(CeedScalar));
     CeedChk_Hip(ceed,ierr);
@@ -455,7 +455,7 @@ int CeedBasisApplyNonTensor_Hip(CeedBasis basis, const CeedInt nelem,
 
   // Clear v for transpose operation
   if (tmode == CEED_TRANSPOSE) {
-    CeedInt length;
+    CeedSize length;
     ierr = CeedVectorGetLength(v, &length); CeedChk(ierr);
     ierr = hipMemset(d_v, 0, length * sizeof(CeedScalar));
     CeedChk_Hip(ceed, ierr);
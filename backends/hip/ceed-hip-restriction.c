@@ -257,7 +257,8 @@ static int CeedElemRestrictionOffset_Hip(const CeedElemRestriction r,
   ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
   CeedElemRestriction_Hip *impl;
   ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
-  CeedInt nelem, elemsize, lsize, ncomp;
+  CeedInt nelem, elemsize, ncomp;
+  CeedSize lsize;
   ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
   ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
   ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
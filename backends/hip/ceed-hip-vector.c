@@ -19,6 +19,7 @@
 #include <hip/hip_runtime.h>
 #include <hipblas.h>
 #include <math.h>
+#include <stdint.h>
 #include <string.h>
 #include "ceed-hip.h"
 
@@ -27,7 +28,7 @@
 //------------------------------------------------------------------------------
 static inline size_t bytes(const CeedVector vec) {
   int ierr;
-  CeedInt length;
+  CeedSize length;
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
   return length * sizeof(CeedScalar);
 }
@@ -74,7 +75,7 @@ static int CeedVectorSetArrayHost_Hip(const CeedVector vec,
 
   switch (cmode) {
   case CEED_COPY_VALUES: {
-    CeedInt length;
+    CeedSize length;
     if(!data->h_array) {
       ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
       ierr = CeedMalloc(length, &data->h_array_allocated); CeedChk(ierr);
@@ -215,7 +216,7 @@ static int CeedVectorSetValue_Hip(CeedVector vec, CeedScalar val) {
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Hip *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
-  CeedInt length;
+  CeedSize length;
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
 
   // Set value for synced device/host array
@@ -265,7 +266,7 @@ static int CeedVectorGetArrayRead_Hip(const CeedVector vec,
   switch (mtype) {
   case CEED_MEM_HOST:
     if(data->h_array==NULL) {
-      CeedInt length;
+      CeedSize length;
       ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
       ierr = CeedMalloc(length, &data->h_array_allocated);
       CeedChk(ierr);
@@ -311,7 +312,7 @@ static int CeedVectorGetArray_Hip(const CeedVector vec,
   switch (mtype) {
   case CEED_MEM_HOST:
     if(data->h_array==NULL) {
-      CeedInt length;
+      CeedSize length;
       ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
       ierr = CeedMalloc(length, &data->h_array_allocated);
       CeedChk(ierr);
@@ -363,7 +364,7 @@ static int CeedVectorNorm_Hip(CeedVector vec, CeedNormType type,
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Hip *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
-  CeedInt length;
+  CeedSize length;
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
   hipblasHandle_t handle;
   ierr = CeedHipGetHipblasHandle(ceed, &handle); CeedChk(ierr);
@@ -422,7 +423,7 @@ static int CeedVectorReciprocal_Hip(CeedVector vec) {
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Hip *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
-  CeedInt length;
+  CeedSize length;
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
 
   // Set value for synced device/host array
@@ -464,11 +465,17 @@ static int CeedVectorDestroy_Hip(const CeedVector vec) {
 //------------------------------------------------------------------------------
 // Create a vector of the specified length (does not allocate memory)
 //------------------------------------------------------------------------------
-int CeedVectorCreate_Hip(CeedInt n, CeedVector vec) {
+int CeedVectorCreate_Hip(CeedSize n, CeedVector vec) {
   CeedVector_Hip *data;
   int ierr;
   Ceed ceed;
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  // The kernels index vectors with int
+  if (n > INT32_MAX)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Vector length %ld exceeds the range supported "
+                     "by the HIP backends", (long)n);
+  // LCOV_EXCL_STOP
 
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetArray",
                                 CeedVectorSetArray_Hip); CeedChk(ierr);
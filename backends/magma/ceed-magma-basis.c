@@ -58,7 +58,7 @@ int CeedBasisApply_Magma(CeedBasis basis, CeedInt nelem,
             ncomp*CeedIntPow(P1d, dim), ncomp);
 
   if (tmode == CEED_TRANSPOSE) {
-    CeedInt length;
+    CeedSize length;
     ierr = CeedVectorGetLength(V, &length); CeedChk(ierr);
     magmablas_dlaset(MagmaFull, length, 1, 0., 0., v, length, data->queue);
     ceed_magma_queue_sync( data->queue );
@@ -241,7 +241,7 @@ int CeedBasisApplyNonTensor_Magma(CeedBasis basis, CeedInt nelem,
             ncomp*ndof, ncomp);
 
   if (tmode == CEED_TRANSPOSE) {
-    CeedInt length;
+    CeedSize length;
     ierr = CeedVectorGetLength(V, &length);
     magmablas_dlaset(MagmaFull, length, 1, 0., 0., dv, length, data->queue);
     ceed_magma_queue_sync( data->queue );
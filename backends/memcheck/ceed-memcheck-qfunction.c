@@ -32,7 +32,7 @@ static int CeedQFunctionApply_Memcheck(CeedQFunction qf, CeedInt Q,
   ierr = CeedQFunctionGetContext(qf, &ctx); CeedChk(ierr);
   void *ctxData = NULL;
   if (ctx) {
-    ierr = CeedQFunctionContextGetData(ctx, CEED_MEM_HOST, &ctxData);
+    ierr = CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, &ctxData);
     CeedChk(ierr);
   }
 
@@ -49,7 +49,7 @@ static int CeedQFunctionApply_Memcheck(CeedQFunction qf, CeedInt Q,
   for (int i = 0; i<nOut; i++) {
     ierr = CeedVectorGetArray(V[i], CEED_MEM_HOST, &impl->outputs[i]);
     CeedChk(ierr);
-    CeedInt len;
+    CeedSize len;
     ierr = CeedVectorGetLength(V[i], &len); CeedChk(ierr);
     VALGRIND_MAKE_MEM_UNDEFINED(impl->outputs[i], len);
   }
@@ -63,7 +63,7 @@ static int CeedQFunctionApply_Memcheck(CeedQFunction qf, CeedInt Q,
     ierr = CeedVectorRestoreArray(V[i], &impl->outputs[i]); CeedChk(ierr);
   }
   if (ctx) {
-    ierr = CeedQFunctionContextRestoreData(ctx, &ctxData); CeedChk(ierr);
+    ierr = CeedQFunctionContextRestoreDataRead(ctx, &ctxData); CeedChk(ierr);
   }
 
   return 0;
@@ -109,7 +109,7 @@ namespace ceed {
       }
 
       CeedInt nodeCount = 0;
-      for (CeedInt i = 0; i < ceedLVectorSize; ++i) {
+      for (CeedSize i = 0; i < ceedLVectorSize; ++i) {
         nodeCount += indexIsUsed[i];
       }
 
@@ -123,7 +123,7 @@ namespace ceed {
 
       // Compute ids
       CeedInt offsetId = 0;
-      for (CeedInt i = 0; i < ceedLVectorSize; ++i) {
+      for (CeedSize i = 0; i < ceedLVectorSize; ++i) {
         if (indexIsUsed[i]) {
           transposeQuadIndices_h[offsetId] = i;
           quadIndexToDofOffset[i] = offsetId++;
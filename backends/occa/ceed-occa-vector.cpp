@@ -328,7 +328,7 @@ namespace ceed {
       return CeedSetBackendFunction(ceed, "Vector", vec, fname, f);
     }
 
-    int Vector::ceedCreate(CeedInt length, CeedVector vec) {
+    int Vector::ceedCreate(CeedSize length, CeedVector vec) {
       int ierr;
 
       Ceed ceed;
@@ -39,7 +39,7 @@ namespace ceed {
     class Vector : public CeedObject {
      public:
       // Owned resources
-      CeedInt length;
+      CeedSize length;
       ::occa::memory memory;
       CeedInt hostBufferLength;
       CeedScalar *hostBuffer;
@@ -106,7 +106,7 @@ namespace ceed {
       static int registerCeedFunction(Ceed ceed, CeedVector vec,
                                       const char *fname, ceed::occa::ceedFunction f);
 
-      static int ceedCreate(CeedInt length, CeedVector vec);
+      static int ceedCreate(CeedSize length, CeedVector vec);
 
       static int ceedSetValue(CeedVector vec, CeedScalar value);
 
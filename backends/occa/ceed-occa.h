@@ -169,4 +169,4 @@ CEED_INTERN int CeedElemRestrictionCreateBlocked_Occa(const CeedMemType mtype,
     const CeedElemRestriction res);
 
 // *****************************************************************************
-CEED_INTERN int CeedVectorCreate_Occa(CeedInt n, CeedVector vec);
+CEED_INTERN int CeedVectorCreate_Occa(CeedSize n, CeedVector vec);
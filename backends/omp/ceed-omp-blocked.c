@@ -0,0 +1,92 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ceed-omp.h"
+#include "../opt/ceed-opt.h"
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Omp(Ceed ceed) {
+  int ierr;
+  Ceed_Omp *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedFree(&data); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Omp_Blocked(const char *resource, Ceed ceed) {
+  int ierr;
+  char *resourceroot;
+  ierr = CeedGetResourceRoot(ceed, resource, &resourceroot); CeedChk(ierr);
+  if (strcmp(resourceroot, "/cpu/self/omp")
+      && strcmp(resourceroot, "/cpu/self/omp/blocked"))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "OpenMP backend cannot use resource: %s",
+                     resource);
+  // LCOV_EXCL_STOP
+  ierr = CeedFree(&resourceroot); CeedChk(ierr);
+  ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
+
+  // Create optimized CEED that implementation will be dispatched
+  //   through unless overridden
+  Ceed ceedopt;
+  CeedInitDelegate("/cpu/self/opt/blocked", resource, &ceedopt);
+  ierr = CeedSetDelegate(ceed, ceedopt); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
+                                CeedDestroy_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ElemRestrictionCreate",
+                                CeedElemRestrictionCreate_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed,
+                                "ElemRestrictionCreateBlocked",
+                                CeedElemRestrictionCreate_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate",
+                                CeedOperatorCreate_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "CompositeOperatorCreate",
+                                CeedCompositeOperatorCreate_Omp); CeedChk(ierr);
+
+  // Set blocksize, as read from the resource options by the delegate; tuning
+  //   times the opt element loop, not the threaded one
+  Ceed_Opt *optdata;
+  ierr = CeedGetData(ceedopt, &optdata); CeedChk(ierr);
+  if (optdata->autotune)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "OpenMP backend cannot use blocksize: auto");
+  // LCOV_EXCL_STOP
+  Ceed_Omp *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+  data->blksize = optdata->blksize;
+  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+CEED_INTERN int CeedRegister_Omp_Blocked(void) {
+  return CeedRegister("/cpu/self/omp/blocked", CeedInit_Omp_Blocked, 57);
+}
+//------------------------------------------------------------------------------
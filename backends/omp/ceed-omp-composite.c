@@ -0,0 +1,465 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdbool.h>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
+#include "ceed-omp.h"
+
+// Suboperators with fewer element blocks than this per thread cannot keep the
+//   threads busy and are run concurrently, one thread each
+#define CEED_OMP_TASK_BLOCKS_PER_THREAD 4
+
+//------------------------------------------------------------------------------
+// Mark L-vector entries written by the active outputs of a suboperator
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorMarkOutputs_Omp(CeedOperator subop,
+    CeedInt sub, CeedInt *owner, bool *isprivate) {
+  int ierr;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(subop, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opoutputfields;
+  ierr = CeedOperatorGetFields(subop, NULL, &opoutputfields); CeedChk(ierr);
+
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+    if (vec != CEED_VECTOR_ACTIVE)
+      continue;
+    CeedElemRestriction rstr;
+    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &rstr);
+    CeedChk(ierr);
+    bool isstrided, hasoffsets64;
+    ierr = CeedElemRestrictionIsStrided(rstr, &isstrided); CeedChk(ierr);
+    ierr = CeedElemRestrictionHasOffsets64(rstr, &hasoffsets64); CeedChk(ierr);
+    if (isstrided || hasoffsets64) {
+      // No 32-bit offsets to prove disjointness with
+      isprivate[sub] = true;
+      continue;
+    }
+    CeedInt nelem, elemsize, ncomp, compstride;
+    ierr = CeedElemRestrictionGetNumElements(rstr, &nelem); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(rstr, &elemsize); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(rstr, &ncomp); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetCompStride(rstr, &compstride); CeedChk(ierr);
+    const CeedInt *offsets;
+    ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+    for (CeedSize j=0; j<(CeedSize)nelem*elemsize; j++)
+      for (CeedInt k=0; k<ncomp; k++) {
+        CeedSize l = offsets[j] + (CeedSize)k*compstride;
+        if (owner[l] == -1) {
+          owner[l] = sub;
+        } else if (owner[l] != sub) {
+          isprivate[owner[l]] = true;
+          isprivate[sub] = true;
+        }
+      }
+    ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup schedule for an active output of the given length
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorSetupSchedule_Omp(CeedOperator op,
+    CeedSize outlength) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Omp *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+  CeedCompositeOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedInt numsub;
+  ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+  CeedOperator *subops;
+  ierr = CeedOperatorGetSubList(op, &subops); CeedChk(ierr);
+  const CeedInt blksize = ceedimpl->blksize;
+
+  // Suboperators are set up here, in order, rather than inside the tasks
+  for (CeedInt i=0; i<numsub; i++) {
+    ierr = CeedOperatorSetup(subops[i]); CeedChk(ierr);
+  }
+
+  // Clear previous schedule
+  for (CeedInt i=0; i<impl->numsub; i++) {
+    ierr = CeedVectorDestroy(&impl->outvecs[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->istask); CeedChk(ierr);
+  ierr = CeedFree(&impl->isprivate); CeedChk(ierr);
+  ierr = CeedFree(&impl->outvecs); CeedChk(ierr);
+  impl->numsub = numsub;
+  impl->outlength = outlength;
+  ierr = CeedCalloc(numsub, &impl->istask); CeedChk(ierr);
+  ierr = CeedCalloc(numsub, &impl->isprivate); CeedChk(ierr);
+  ierr = CeedCalloc(numsub, &impl->outvecs); CeedChk(ierr);
+#ifdef _OPENMP
+  impl->numthreads = omp_get_max_threads();
+#else
+  impl->numthreads = 1;
+#endif
+
+  // Passive outputs may be shared between suboperators
+  impl->serial = impl->numthreads == 1 || outlength == 0;
+  for (CeedInt i=0; i<numsub && !impl->serial; i++) {
+    bool iscomposite;
+    ierr = CeedOperatorIsComposite(subops[i], &iscomposite); CeedChk(ierr);
+    if (iscomposite) {
+      impl->serial = true;
+      break;
+    }
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(subops[i], &qf); CeedChk(ierr);
+    CeedInt numinputfields, numoutputfields;
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    CeedOperatorField *opoutputfields;
+    ierr = CeedOperatorGetFields(subops[i], NULL, &opoutputfields);
+    CeedChk(ierr);
+    for (CeedInt j=0; j<numoutputfields; j++) {
+      CeedVector vec;
+      ierr = CeedOperatorFieldGetVector(opoutputfields[j], &vec); CeedChk(ierr);
+      if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE)
+        impl->serial = true;
+    }
+  }
+  if (impl->serial)
+    return 0;
+
+  // Small suboperators run as tasks
+  CeedInt numtasks = 0;
+  for (CeedInt i=0; i<numsub; i++) {
+    CeedInt nelem;
+    ierr = CeedOperatorGetNumElements(subops[i], &nelem); CeedChk(ierr);
+    const CeedInt numblks = (nelem/blksize) + !!(nelem%blksize);
+    impl->istask[i] = numblks < CEED_OMP_TASK_BLOCKS_PER_THREAD*impl->numthreads;
+    numtasks += impl->istask[i];
+  }
+  if (numtasks < 2) {
+    for (CeedInt i=0; i<numsub; i++)
+      impl->istask[i] = false;
+    return 0;
+  }
+
+  // Tasks with overlapping outputs write to private buffers
+  CeedInt *owner;
+  ierr = CeedMalloc(outlength, &owner); CeedChk(ierr);
+  for (CeedSize l=0; l<outlength; l++)
+    owner[l] = -1;
+  for (CeedInt i=0; i<numsub; i++)
+    if (impl->istask[i]) {
+      ierr = CeedCompositeOperatorMarkOutputs_Omp(subops[i], i, owner,
+             impl->isprivate); CeedChk(ierr);
+    }
+  ierr = CeedFree(&owner); CeedChk(ierr);
+
+  for (CeedInt i=0; i<numsub; i++)
+    if (impl->istask[i]) {
+      ierr = CeedVectorCreate(ceed, outlength, &impl->outvecs[i]);
+      CeedChk(ierr);
+    }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup for the active output of the suboperators
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorSetup_Omp(CeedOperator op) {
+  int ierr;
+  CeedInt numsub;
+  ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+  CeedOperator *subops;
+  ierr = CeedOperatorGetSubList(op, &subops); CeedChk(ierr);
+
+  CeedSize outlength = 0;
+  for (CeedInt i=0; i<numsub && !outlength; i++) {
+    bool iscomposite;
+    ierr = CeedOperatorIsComposite(subops[i], &iscomposite); CeedChk(ierr);
+    if (iscomposite)
+      continue;
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(subops[i], &qf); CeedChk(ierr);
+    CeedInt numinputfields, numoutputfields;
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    CeedOperatorField *opoutputfields;
+    ierr = CeedOperatorGetFields(subops[i], NULL, &opoutputfields);
+    CeedChk(ierr);
+    for (CeedInt j=0; j<numoutputfields; j++) {
+      CeedVector vec;
+      ierr = CeedOperatorFieldGetVector(opoutputfields[j], &vec); CeedChk(ierr);
+      if (vec == CEED_VECTOR_ACTIVE) {
+        CeedElemRestriction rstr;
+        ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[j], &rstr);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionGetLVectorSize(rstr, &outlength);
+        CeedChk(ierr);
+        break;
+      }
+    }
+  }
+  ierr = CeedCompositeOperatorSetupSchedule_Omp(op, outlength); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply Add
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorApplyAdd_Omp(CeedOperator op, CeedVector invec,
+    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  CeedCompositeOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedInt numsub;
+  CeedSize outlength = 0;
+  ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+  CeedOperator *subops;
+  ierr = CeedOperatorGetSubList(op, &subops); CeedChk(ierr);
+  if (outvec != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetLength(outvec, &outlength); CeedChk(ierr);
+  }
+
+  // Setup
+  if (numsub != impl->numsub || outlength != impl->outlength || !impl->istask) {
+    ierr = CeedCompositeOperatorSetupSchedule_Omp(op, outlength); CeedChk(ierr);
+  }
+
+  // Large suboperators thread their own element loops
+  for (CeedInt i=0; i<numsub; i++)
+    if (!impl->istask[i]) {
+      ierr = CeedOperatorApplyAdd(subops[i], invec, outvec, request);
+      CeedChk(ierr);
+    }
+  if (impl->serial)
+    return 0;
+
+  // Task outputs
+  CeedScalar *outarray;
+  bool hastasks = false;
+  for (CeedInt i=0; i<numsub; i++)
+    hastasks = hastasks || impl->istask[i];
+  if (!hastasks)
+    return 0;
+  ierr = CeedVectorGetArray(outvec, CEED_MEM_HOST, &outarray); CeedChk(ierr);
+  for (CeedInt i=0; i<numsub; i++)
+    if (impl->istask[i]) {
+      if (impl->isprivate[i]) {
+        ierr = CeedVectorSetValue(impl->outvecs[i], 0.0); CeedChk(ierr);
+      } else {
+        ierr = CeedVectorSetArray(impl->outvecs[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER, outarray); CeedChk(ierr);
+      }
+    }
+
+  // Small suboperators run concurrently
+  int taskierr = 0;
+  #pragma omp parallel num_threads(impl->numthreads)
+  #pragma omp single
+  for (CeedInt i=0; i<numsub; i++)
+    if (impl->istask[i]) {
+      #pragma omp task firstprivate(i) shared(taskierr)
+      {
+        int subierr = CeedOperatorApplyAdd(subops[i], invec, impl->outvecs[i],
+                                           request);
+        if (subierr) {
+          #pragma omp atomic write
+          taskierr = subierr;
+        }
+      }
+    }
+  if (taskierr) {
+    ierr = CeedVectorRestoreArray(outvec, &outarray); CeedChk(ierr);
+    return taskierr;
+  }
+
+  // Reduce private outputs in suboperator order
+  for (CeedInt i=0; i<numsub; i++)
+    if (impl->istask[i] && impl->isprivate[i]) {
+      const CeedScalar *subarray;
+      ierr = CeedVectorGetArrayRead(impl->outvecs[i], CEED_MEM_HOST, &subarray);
+      CeedChk(ierr);
+      #pragma omp parallel for num_threads(impl->numthreads)
+      for (CeedSize l=0; l<outlength; l++)
+        outarray[l] += subarray[l];
+      ierr = CeedVectorRestoreArrayRead(impl->outvecs[i], &subarray);
+      CeedChk(ierr);
+    }
+  ierr = CeedVectorRestoreArray(outvec, &outarray); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorApply_Omp(CeedOperator op, CeedVector invec,
+    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  CeedInt numsub;
+  ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+  CeedOperator *subops;
+  ierr = CeedOperatorGetSubList(op, &subops); CeedChk(ierr);
+
+  // Zero all output vectors
+  if (outvec != CEED_VECTOR_NONE) {
+    ierr = CeedVectorSetValue(outvec, 0.0); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<numsub; i++) {
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(subops[i], &qf); CeedChk(ierr);
+    CeedInt numinputfields, numoutputfields;
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    CeedOperatorField *opoutputfields;
+    ierr = CeedOperatorGetFields(subops[i], NULL, &opoutputfields);
+    CeedChk(ierr);
+    for (CeedInt j=0; j<numoutputfields; j++) {
+      CeedVector vec;
+      ierr = CeedOperatorFieldGetVector(opoutputfields[j], &vec); CeedChk(ierr);
+      if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) {
+        ierr = CeedVectorSetValue(vec, 0.0); CeedChk(ierr);
+      }
+    }
+  }
+
+  // Apply
+  ierr = CeedCompositeOperatorApplyAdd_Omp(op, invec, outvec, request);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Assemble Linear Diagonal
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorLinearAssembleAddDiagonal_Omp(CeedOperator op,
+    CeedVector assembled, CeedRequest *request) {
+  int ierr;
+  CeedInt numsub;
+  ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+  CeedOperator *subops;
+  ierr = CeedOperatorGetSubList(op, &subops); CeedChk(ierr);
+
+  for (CeedInt i=0; i<numsub; i++) {
+    ierr = CeedOperatorLinearAssembleAddDiagonal(subops[i], assembled, request);
+    CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Assemble Linear Point Block Diagonal
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorLinearAssembleAddPointBlockDiagonal_Omp(
+  CeedOperator op, CeedVector assembled, CeedRequest *request) {
+  int ierr;
+  CeedInt numsub;
+  ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+  CeedOperator *subops;
+  ierr = CeedOperatorGetSubList(op, &subops); CeedChk(ierr);
+
+  for (CeedInt i=0; i<numsub; i++) {
+    ierr = CeedOperatorLinearAssembleAddPointBlockDiagonal(subops[i], assembled,
+           request); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorGetMemoryUsage_Omp(CeedOperator op,
+    CeedSize *bytes) {
+  int ierr;
+  CeedCompositeOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  // Private task outputs, the suboperators report their own data
+  *bytes = 0;
+  for (CeedInt i=0; i<impl->numsub; i++) {
+    CeedSize vecbytes;
+    ierr = CeedVectorGetMemoryUsage(impl->outvecs[i], &vecbytes);
+    CeedChk(ierr);
+    *bytes += vecbytes;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedCompositeOperatorDestroy_Omp(CeedOperator op) {
+  int ierr;
+  CeedCompositeOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  for (CeedInt i=0; i<impl->numsub; i++) {
+    ierr = CeedVectorDestroy(&impl->outvecs[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->istask); CeedChk(ierr);
+  ierr = CeedFree(&impl->isprivate); CeedChk(ierr);
+  ierr = CeedFree(&impl->outvecs); CeedChk(ierr);
+
+  ierr = CeedFree(&impl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Create
+//------------------------------------------------------------------------------
+int CeedCompositeOperatorCreate_Omp(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedCompositeOperator_Omp *impl;
+
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Setup",
+                                CeedCompositeOperatorSetup_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyComposite",
+                                CeedCompositeOperatorApply_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite",
+                                CeedCompositeOperatorApplyAdd_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal",
+                                CeedCompositeOperatorLinearAssembleAddDiagonal_Omp);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op,
+                                "LinearAssembleAddPointBlockDiagonal",
+                                CeedCompositeOperatorLinearAssembleAddPointBlockDiagonal_Omp);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "GetMemoryUsage",
+                                CeedCompositeOperatorGetMemoryUsage_Omp);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
+                                CeedCompositeOperatorDestroy_Omp); CeedChk(ierr);
+  return 0;
+}
+//------------------------------------------------------------------------------
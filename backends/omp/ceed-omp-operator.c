@@ -0,0 +1,970 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
+#include "ceed-omp.h"
+
+//------------------------------------------------------------------------------
+// Setup Blocked Restrictions and Full E-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFields_Omp(CeedQFunction qf, CeedOperator op,
+                                       bool inOrOut, const CeedInt blksize,
+                                       CeedElemRestriction *blkrestr,
+                                       CeedVector *fullevecs, CeedInt starte,
+                                       CeedInt numfields, bool fuseoutput) {
+  CeedInt ierr, ncomp;
+  CeedElemRestriction r;
+  CeedOperatorField *opfields;
+  CeedQFunctionField *qffields;
+  CeedVector vec;
+  if (inOrOut) {
+    ierr = CeedOperatorGetFields(op, NULL, &opfields);
+    CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, NULL, &qffields);
+    CeedChk(ierr);
+  } else {
+    ierr = CeedOperatorGetFields(op, &opfields, NULL);
+    CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, &qffields, NULL);
+    CeedChk(ierr);
+  }
+
+  // Loop over fields
+  for (CeedInt i=0; i<numfields; i++) {
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT)
+      continue;
+
+    ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &r);
+    CeedChk(ierr);
+    Ceed ceed;
+    ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+    CeedInt nelem, elemsize, compstride;
+    CeedSize lsize;
+    ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
+
+    bool strided, hasoffsets64;
+    ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChk(ierr);
+    ierr = CeedElemRestrictionHasOffsets64(r, &hasoffsets64); CeedChk(ierr);
+    if (strided) {
+      CeedInt strides[3];
+      ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
+      ierr = CeedElemRestrictionCreateBlockedStrided(ceed, nelem, elemsize,
+             blksize, ncomp, lsize, strides, &blkrestr[i+starte]);
+      CeedChk(ierr);
+    } else if (hasoffsets64) {
+      const CeedSize *offsets = NULL;
+      ierr = CeedElemRestrictionGetOffsets64(r, CEED_MEM_HOST, &offsets);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+      ierr = CeedElemRestrictionCreateBlocked64(ceed, nelem, elemsize,
+                                                blksize, ncomp, compstride,
+                                                lsize, CEED_MEM_HOST,
+                                                CEED_COPY_VALUES, offsets,
+                                                &blkrestr[i+starte]);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionRestoreOffsets64(r, &offsets); CeedChk(ierr);
+    } else {
+      const CeedInt *offsets = NULL;
+      ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+      ierr = CeedElemRestrictionCreateBlocked(ceed, nelem, elemsize,
+                                              blksize, ncomp, compstride,
+                                              lsize, CEED_MEM_HOST,
+                                              CEED_COPY_VALUES, offsets,
+                                              &blkrestr[i+starte]);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
+    }
+
+    // Active inputs are restricted block by block, so only passive inputs
+    //   and unfused outputs need a full E-vector
+    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+    if ((inOrOut && !fuseoutput) || (!inOrOut && vec != CEED_VECTOR_ACTIVE)) {
+      ierr = CeedElemRestrictionCreateVector(blkrestr[i+starte], NULL,
+                                             &fullevecs[i+starte]);
+      CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Per-Thread Block E-vectors and Q-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupThreadFields_Omp(CeedQFunction qf, CeedOperator op,
+    bool inOrOut, const CeedInt blksize, CeedVector *evecs, CeedVector *qvecs,
+    CeedInt numfields, CeedInt Q) {
+  CeedInt dim, ierr, size, P;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedBasis basis;
+  CeedElemRestriction r;
+  CeedOperatorField *opfields;
+  CeedQFunctionField *qffields;
+  if (inOrOut) {
+    ierr = CeedOperatorGetFields(op, NULL, &opfields);
+    CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, NULL, &qffields);
+    CeedChk(ierr);
+  } else {
+    ierr = CeedOperatorGetFields(op, &opfields, NULL);
+    CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, &qffields, NULL);
+    CeedChk(ierr);
+  }
+
+  // Loop over fields
+  for (CeedInt i=0; i<numfields; i++) {
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+    if (emode != CEED_EVAL_WEIGHT) {
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &r);
+      CeedChk(ierr);
+    }
+
+    switch(emode) {
+    case CEED_EVAL_NONE:
+      // Q-data is read from and written to the E-vector directly
+      ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, Q*size*blksize, &evecs[i]); CeedChk(ierr);
+      break;
+    case CEED_EVAL_INTERP:
+      ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetElementSize(r, &P);
+      CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, P*size*blksize, &evecs[i]); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
+      break;
+    case CEED_EVAL_GRAD:
+      ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
+      ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
+      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetElementSize(r, &P);
+      CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, P*size/dim*blksize, &evecs[i]); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
+      break;
+    case CEED_EVAL_WEIGHT: // Only on input fields
+      ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, Q*blksize, &qvecs[i]); CeedChk(ierr);
+      ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
+                            CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, qvecs[i]);
+      CeedChk(ierr);
+      break;
+    case CEED_EVAL_DIV:
+      break; // Not implemented
+    case CEED_EVAL_CURL:
+      break; // Not implemented
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Block Scratch of One Thread
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupThread_Omp(CeedOperator op, CeedOperator_Omp *impl,
+                                       CeedOperatorThread_Omp *thread) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Omp *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+  const CeedInt blksize = ceedimpl->blksize;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt Q;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  const CeedInt numinputfields = impl->numein, numoutputfields = impl->numeout;
+
+  CeedSize inlength = -1;
+  CeedOperatorField *opinputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, NULL); CeedChk(ierr);
+  for (CeedInt i=0; i<numinputfields; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      CeedElemRestriction rstr;
+      ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &rstr);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionGetLVectorSize(rstr, &inlength); CeedChk(ierr);
+    }
+  }
+  ierr = CeedCalloc(16, &thread->evecsin); CeedChk(ierr);
+  ierr = CeedCalloc(16, &thread->evecsout); CeedChk(ierr);
+  ierr = CeedCalloc(16, &thread->qvecsin); CeedChk(ierr);
+  ierr = CeedCalloc(16, &thread->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(16, &thread->lvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(16, &thread->qin); CeedChk(ierr);
+  ierr = CeedCalloc(16, &thread->qout); CeedChk(ierr);
+  ierr = CeedOperatorSetupThreadFields_Omp(qf, op, 0, blksize,
+         thread->evecsin, thread->qvecsin, numinputfields, Q);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetupThreadFields_Omp(qf, op, 1, blksize,
+         thread->evecsout, thread->qvecsout, numoutputfields, Q);
+  CeedChk(ierr);
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    CeedSize lsize;
+    ierr = CeedElemRestrictionGetLVectorSize(impl->blkrestr[i+numinputfields],
+           &lsize); CeedChk(ierr);
+    ierr = CeedVectorCreate(ceed, lsize, &thread->lvecsout[i]); CeedChk(ierr);
+  }
+  if (inlength >= 0) {
+    ierr = CeedVectorCreate(ceed, inlength, &thread->invec); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Destroy Block Scratch of One Thread
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyThread_Omp(CeedOperator_Omp *impl,
+    CeedOperatorThread_Omp *thread) {
+  int ierr;
+  // The arrays are allocated together, qout last
+  const bool allocated = thread->qout;
+
+  ierr = CeedVectorDestroy(&thread->invec); CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numein && allocated; i++) {
+    ierr = CeedVectorDestroy(&thread->evecsin[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&thread->qvecsin[i]); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<impl->numeout && allocated; i++) {
+    ierr = CeedVectorDestroy(&thread->evecsout[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&thread->qvecsout[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&thread->lvecsout[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&thread->evecsin); CeedChk(ierr);
+  ierr = CeedFree(&thread->evecsout); CeedChk(ierr);
+  ierr = CeedFree(&thread->qvecsin); CeedChk(ierr);
+  ierr = CeedFree(&thread->qvecsout); CeedChk(ierr);
+  ierr = CeedFree(&thread->lvecsout); CeedChk(ierr);
+  ierr = CeedFree(&thread->qin); CeedChk(ierr);
+  ierr = CeedFree(&thread->qout); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Operator
+//------------------------------------------------------------------------------
+static int CeedOperatorSetup_Omp(CeedOperator op) {
+  int ierr;
+  bool setupdone;
+  ierr = CeedOperatorIsSetupDone(op, &setupdone); CeedChk(ierr);
+  if (setupdone) return 0;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Omp *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+  const CeedInt blksize = ceedimpl->blksize;
+  CeedOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt Q, numinputfields, numoutputfields;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+
+  // Allocate
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->blkrestr);
+  CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->evecs);
+  CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
+  CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->inputstate); CeedChk(ierr);
+
+  impl->numein = numinputfields; impl->numeout = numoutputfields;
+  // With a single output, each block restricts its own output and the
+  //   block loop is scheduled by the colors of the output restriction
+  impl->fuseoutput = numoutputfields == 1;
+
+  // Blocked restrictions and full E-vectors
+  ierr = CeedOperatorSetupFields_Omp(qf, op, 0, blksize, impl->blkrestr,
+                                     impl->evecs, 0, numinputfields,
+                                     impl->fuseoutput);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetupFields_Omp(qf, op, 1, blksize, impl->blkrestr,
+                                     impl->evecs, numinputfields,
+                                     numoutputfields, impl->fuseoutput);
+  CeedChk(ierr);
+
+  // Block schedule
+  if (impl->fuseoutput) {
+    ierr = CeedElemRestrictionGetColoring(impl->blkrestr[numinputfields],
+                                          &impl->numcolors,
+                                          &impl->coloroffsets,
+                                          &impl->colorblks); CeedChk(ierr);
+  } else {
+    CeedInt numelements, nblks;
+    ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+    nblks = (numelements/blksize) + !!(numelements%blksize);
+    ierr = CeedMalloc(nblks+2, &impl->blkschedule); CeedChk(ierr);
+    impl->blkschedule[0] = 0;
+    impl->blkschedule[1] = nblks;
+    for (CeedInt b=0; b<nblks; b++)
+      impl->blkschedule[b+2] = b;
+    impl->numcolors = 1;
+    impl->coloroffsets = impl->blkschedule;
+    impl->colorblks = &impl->blkschedule[2];
+  }
+
+  // Per-thread scratch
+#ifdef _OPENMP
+  impl->numthreads = omp_get_max_threads();
+#else
+  impl->numthreads = 1;
+#endif
+  ierr = CeedCalloc(impl->numthreads, &impl->threads); CeedChk(ierr);
+  for (CeedInt t=0; t<impl->numthreads; t++) {
+    ierr = CeedOperatorSetupThread_Omp(op, impl, &impl->threads[t]);
+    CeedChk(ierr);
+  }
+
+  ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Input Fields
+//------------------------------------------------------------------------------
+// The passive input E-vectors of the operator, shared, are also read by its
+//   CeedOperatorWorkspaces, so they are restricted under a lock
+static inline int CeedOperatorSetupInputs_Omp(CeedInt numinputfields,
+    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
+    CeedVector invec, CeedOperator_Omp *shared, CeedOperator_Omp *impl,
+    CeedRequest *request) {
+  CeedInt ierr;
+  CeedEvalMode emode;
+  CeedVector vec;
+  uint64_t state;
+
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT || vec == CEED_VECTOR_ACTIVE) { // Skip
+    } else {
+      // Restrict passive input
+      ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+      CeedSpinLock(shared->inputlock);
+      if (state != shared->inputstate[i]) {
+        ierr = CeedElemRestrictionApply(shared->blkrestr[i], CEED_NOTRANSPOSE,
+                                        vec, shared->evecs[i], request);
+        if (!ierr)
+          shared->inputstate[i] = state;
+      }
+      CeedSpinUnlock(shared->inputlock);
+      CeedChk(ierr);
+      // Get evec
+      ierr = CeedVectorGetArrayRead(shared->evecs[i], CEED_MEM_HOST,
+                                    (const CeedScalar **) &impl->edata[i]);
+      CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Restore Input Vectors
+//------------------------------------------------------------------------------
+static inline int CeedOperatorRestoreInputs_Omp(CeedInt numinputfields,
+    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
+    CeedOperator_Omp *shared, CeedOperator_Omp *impl) {
+  CeedInt ierr;
+  CeedEvalMode emode;
+  CeedVector vec;
+
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT || vec == CEED_VECTOR_ACTIVE) { // Skip
+    } else {
+      ierr = CeedVectorRestoreArrayRead(shared->evecs[i],
+                                        (const CeedScalar **) &impl->edata[i]);
+      CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply Operator to One Block
+//   Only per-thread vectors are modified here; shared data is read only
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyBlock_Omp(CeedInt e, CeedInt Q, CeedInt blksize,
+                                      CeedQFunctionUser f, void *ctxdata,
+                                      CeedQFunctionField *qfinputfields,
+                                      CeedOperatorField *opinputfields,
+                                      CeedQFunctionField *qfoutputfields,
+                                      CeedOperatorField *opoutputfields,
+                                      CeedOperator_Omp *impl,
+                                      CeedOperatorThread_Omp *thread,
+                                      CeedRequest *request) {
+  CeedInt ierr;
+  CeedInt dim, elemsize, size;
+  CeedElemRestriction Erestrict;
+  CeedEvalMode emode;
+  CeedBasis basis;
+  CeedVector vec;
+  const CeedInt numinputfields = impl->numein;
+  const CeedInt numoutputfields = impl->numeout;
+
+  // Input restriction and basis action
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT)
+      continue;
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      // Restrict block of active input
+      ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i], e/blksize,
+                                           CEED_NOTRANSPOSE, thread->invec,
+                                           thread->evecsin[i], request);
+      CeedChk(ierr);
+    } else {
+      // Point at block of passive input
+      dim = 1;
+      if (emode == CEED_EVAL_GRAD) {
+        ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
+        CeedChk(ierr);
+        ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+      }
+      ierr = CeedVectorSetArray(thread->evecsin[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER,
+                                &impl->edata[i][e*elemsize*size/dim]);
+      CeedChk(ierr);
+    }
+    // Basis action
+    switch(emode) {
+    case CEED_EVAL_NONE:
+      break; // No action
+    case CEED_EVAL_INTERP:
+    case CEED_EVAL_GRAD:
+      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
+      CeedChk(ierr);
+      ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE, emode,
+                            thread->evecsin[i], thread->qvecsin[i]);
+      CeedChk(ierr);
+      break;
+    case CEED_EVAL_WEIGHT:
+      break; // Excluded above
+    // LCOV_EXCL_START
+    case CEED_EVAL_DIV:
+    case CEED_EVAL_CURL: {
+      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
+      CeedChk(ierr);
+      Ceed ceed;
+      ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+      return CeedError(ceed, 1, "Ceed evaluation mode not implemented");
+      // LCOV_EXCL_STOP
+    }
+    }
+  }
+
+  // Unfused output E-vectors point into the full output E-vectors
+  for (CeedInt i=0; i<numoutputfields && !impl->fuseoutput; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size); CeedChk(ierr);
+    dim = 1;
+    if (emode == CEED_EVAL_GRAD) {
+      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
+      CeedChk(ierr);
+      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+    }
+    ierr = CeedVectorSetArray(thread->evecsout[i], CEED_MEM_HOST,
+                              CEED_USE_POINTER,
+                              &impl->edata[i+numinputfields][e*elemsize*size/dim]);
+    CeedChk(ierr);
+  }
+
+  // Q function
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    vec = emode == CEED_EVAL_NONE ? thread->evecsin[i] : thread->qvecsin[i];
+    ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &thread->qin[i]);
+    CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    vec = emode == CEED_EVAL_NONE ? thread->evecsout[i] : thread->qvecsout[i];
+    ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &thread->qout[i]);
+    CeedChk(ierr);
+  }
+  ierr = f(ctxdata, Q*blksize, thread->qin, thread->qout); CeedChk(ierr);
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    vec = emode == CEED_EVAL_NONE ? thread->evecsin[i] : thread->qvecsin[i];
+    ierr = CeedVectorRestoreArrayRead(vec, &thread->qin[i]); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    vec = emode == CEED_EVAL_NONE ? thread->evecsout[i] : thread->qvecsout[i];
+    ierr = CeedVectorRestoreArray(vec, &thread->qout[i]); CeedChk(ierr);
+  }
+
+  // Output basis action
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    switch(emode) {
+    case CEED_EVAL_NONE:
+      break; // No action
+    case CEED_EVAL_INTERP:
+    case CEED_EVAL_GRAD:
+      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
+      CeedChk(ierr);
+      ierr = CeedBasisApply(basis, blksize, CEED_TRANSPOSE, emode,
+                            thread->qvecsout[i], thread->evecsout[i]);
+      CeedChk(ierr);
+      break;
+    // LCOV_EXCL_START
+    case CEED_EVAL_WEIGHT: {
+      Ceed ceed;
+      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
+      CeedChk(ierr);
+      ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+      return CeedError(ceed, 1, "CEED_EVAL_WEIGHT cannot be an output "
+                       "evaluation mode");
+    }
+    case CEED_EVAL_DIV:
+    case CEED_EVAL_CURL: {
+      Ceed ceed;
+      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
+      CeedChk(ierr);
+      ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+      return CeedError(ceed, 1, "Ceed evaluation mode not implemented");
+      // LCOV_EXCL_STOP
+    }
+    }
+    // Restrict output block, no other block of this color shares entries
+    if (impl->fuseoutput) {
+      ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i+numinputfields],
+                                           e/blksize, CEED_TRANSPOSE,
+                                           thread->evecsout[i],
+                                           thread->lvecsout[i], request);
+      CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get Output L-vector Views
+//------------------------------------------------------------------------------
+static inline int CeedOperatorGetOutputViews_Omp(CeedOperator_Omp *impl,
+    CeedInt i, CeedVector vec, CeedScalar **ldata) {
+  int ierr;
+  ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, ldata); CeedChk(ierr);
+  for (CeedInt t=0; t<impl->numthreads; t++) {
+    ierr = CeedVectorSetArray(impl->threads[t].lvecsout[i], CEED_MEM_HOST,
+                              CEED_USE_POINTER, *ldata); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Restrict Full Output E-vector by Color
+//------------------------------------------------------------------------------
+static int CeedOperatorRestrictOutput_Omp(CeedOperator_Omp *impl, CeedInt i,
+    CeedVector vec, CeedRequest *request) {
+  int ierr;
+  const CeedInt iout = i + impl->numein;
+  CeedSize blklen;
+  CeedInt numcolors;
+  const CeedInt *coloroffsets, *colorblks;
+  ierr = CeedVectorGetLength(impl->threads[0].evecsout[i], &blklen);
+  CeedChk(ierr);
+  ierr = CeedElemRestrictionGetColoring(impl->blkrestr[iout], &numcolors,
+                                        &coloroffsets, &colorblks);
+  CeedChk(ierr);
+  CeedScalar *ldata;
+  ierr = CeedOperatorGetOutputViews_Omp(impl, i, vec, &ldata); CeedChk(ierr);
+
+  int colorierr = 0;
+  for (CeedInt c=0; c<numcolors && !colorierr; c++) {
+    #pragma omp parallel for schedule(static) num_threads(impl->numthreads)
+    for (CeedInt j=coloroffsets[c]; j<coloroffsets[c+1]; j++) {
+      CeedInt t = 0;
+#ifdef _OPENMP
+      t = omp_get_thread_num();
+#endif
+      CeedOperatorThread_Omp *thread = &impl->threads[t];
+      const CeedInt b = colorblks[j];
+      int threadierr = CeedVectorSetArray(thread->evecsout[i], CEED_MEM_HOST,
+                                          CEED_USE_POINTER,
+                                          &impl->edata[iout][b*blklen]);
+      if (!threadierr)
+        threadierr = CeedElemRestrictionApplyBlock(impl->blkrestr[iout], b,
+                     CEED_TRANSPOSE, thread->evecsout[i], thread->lvecsout[i],
+                     request);
+      if (threadierr) {
+        #pragma omp atomic write
+        colorierr = threadierr;
+      }
+    }
+  }
+
+  // Return the output array before passing on an error from the colors
+  ierr = CeedVectorRestoreArray(vec, &ldata); CeedChk(ierr);
+  CeedChk(colorierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply Element Blocks
+//------------------------------------------------------------------------------
+// The scratch in impl is that of the operator, with one set per thread, or of
+//   one of its CeedOperatorWorkspaces, with a single set
+static int CeedOperatorApplyAddBlocks_Omp(CeedOperator op,
+    CeedOperator_Omp *impl, CeedVector invec, CeedVector outvec,
+    CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Omp *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+  const CeedInt blksize = ceedimpl->blksize;
+  CeedOperator_Omp *shared;
+  ierr = CeedOperatorGetData(op, &shared); CeedChk(ierr);
+  CeedInt Q, numinputfields, numoutputfields;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+  CeedVector vec = NULL;
+
+  // Passive input Evecs and restriction
+  ierr = CeedOperatorSetupInputs_Omp(numinputfields, qfinputfields,
+                                     opinputfields, invec, shared, impl,
+                                     request); CeedChk(ierr);
+
+  // Active input, viewed by each thread through its own vector
+  const CeedScalar *inarray = NULL;
+  if (invec != CEED_VECTOR_NONE && impl->threads[0].invec) {
+    ierr = CeedVectorGetArrayRead(invec, CEED_MEM_HOST, &inarray);
+    CeedChk(ierr);
+    for (CeedInt t=0; t<impl->numthreads; t++) {
+      ierr = CeedVectorSetArray(impl->threads[t].invec, CEED_MEM_HOST,
+                                CEED_USE_POINTER, (CeedScalar *)inarray);
+      CeedChk(ierr);
+    }
+  }
+
+  // Output Evecs or L-vector views
+  CeedScalar *ldata = NULL;
+  if (impl->fuseoutput) {
+    ierr = CeedOperatorFieldGetVector(opoutputfields[0], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE)
+      vec = outvec;
+    ierr = CeedOperatorGetOutputViews_Omp(impl, 0, vec, &ldata); CeedChk(ierr);
+  } else {
+    for (CeedInt i=0; i<numoutputfields; i++) {
+      ierr = CeedVectorGetArray(impl->evecs[i+numinputfields], CEED_MEM_HOST,
+                                &impl->edata[i+numinputfields]); CeedChk(ierr);
+    }
+  }
+
+  // QFunction user function and context
+  CeedQFunctionUser f = NULL;
+  ierr = CeedQFunctionGetUserFunction(qf, &f); CeedChk(ierr);
+  CeedQFunctionContext ctx;
+  ierr = CeedQFunctionGetContext(qf, &ctx); CeedChk(ierr);
+  void *ctxdata = NULL;
+  if (ctx) {
+    ierr = CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, &ctxdata);
+    CeedChk(ierr);
+  }
+
+  // Loop through element blocks in parallel, one color at a time
+  int blkierr = 0;
+  for (CeedInt c=0; c<impl->numcolors && !blkierr; c++) {
+    #pragma omp parallel for schedule(static) num_threads(impl->numthreads)
+    for (CeedInt j=impl->coloroffsets[c]; j<impl->coloroffsets[c+1]; j++) {
+      CeedInt t = 0;
+#ifdef _OPENMP
+      t = omp_get_thread_num();
+#endif
+      int threadierr = CeedOperatorApplyBlock_Omp(impl->colorblks[j]*blksize,
+                       Q, blksize, f, ctxdata, qfinputfields, opinputfields,
+                       qfoutputfields, opoutputfields, impl, &impl->threads[t],
+                       request);
+      if (threadierr) {
+        #pragma omp atomic write
+        blkierr = threadierr;
+      }
+    }
+  }
+
+  // Restore context and input arrays
+  if (ctx) {
+    ierr = CeedQFunctionContextRestoreDataRead(ctx, &ctxdata); CeedChk(ierr);
+  }
+  if (inarray) {
+    ierr = CeedVectorRestoreArrayRead(invec, &inarray); CeedChk(ierr);
+  }
+  ierr = CeedOperatorRestoreInputs_Omp(numinputfields, qfinputfields,
+                                       opinputfields, shared, impl);
+  CeedChk(ierr);
+
+  // Output restriction, skipped after an error in the element blocks
+  if (impl->fuseoutput) {
+    ierr = CeedVectorRestoreArray(vec, &ldata); CeedChk(ierr);
+  } else {
+    for (CeedInt i=0; i<numoutputfields; i++) {
+      if (!blkierr) {
+        ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec);
+        CeedChk(ierr);
+        if (vec == CEED_VECTOR_ACTIVE)
+          vec = outvec;
+        ierr = CeedOperatorRestrictOutput_Omp(impl, i, vec, request);
+        CeedChk(ierr);
+      }
+      ierr = CeedVectorRestoreArray(impl->evecs[i+numinputfields],
+                                    &impl->edata[i+numinputfields]);
+      CeedChk(ierr);
+    }
+  }
+  CeedChk(blkierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Omp(CeedOperator op, CeedVector invec,
+                                    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  CeedOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  // Setup
+  ierr = CeedOperatorSetup_Omp(op); CeedChk(ierr);
+
+  return CeedOperatorApplyAddBlocks_Omp(op, impl, invec, outvec, request);
+}
+
+//------------------------------------------------------------------------------
+// Workspace Create
+//------------------------------------------------------------------------------
+// The workspace shares the blocked restrictions, block schedule, and passive
+//   input E-vectors of the operator. It owns one set of block scratch, as
+//   workspaces are applied from threads of their own, and the full E-vectors
+//   of unfused outputs.
+static int CeedOperatorWorkspaceCreate_Omp(CeedOperator op,
+    CeedOperatorWorkspace ws) {
+  int ierr;
+  CeedOperator_Omp *impl, *wsimpl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  const CeedInt numfields = impl->numein + impl->numeout;
+
+  ierr = CeedCalloc(1, &wsimpl); CeedChk(ierr);
+  ierr = CeedOperatorWorkspaceSetData(ws, wsimpl); CeedChk(ierr);
+  wsimpl->blkrestr = impl->blkrestr;
+  wsimpl->numein = impl->numein;
+  wsimpl->numeout = impl->numeout;
+  wsimpl->fuseoutput = impl->fuseoutput;
+  wsimpl->numcolors = impl->numcolors;
+  wsimpl->coloroffsets = impl->coloroffsets;
+  wsimpl->colorblks = impl->colorblks;
+
+  ierr = CeedCalloc(numfields, &wsimpl->evecs); CeedChk(ierr);
+  ierr = CeedCalloc(numfields, &wsimpl->edata); CeedChk(ierr);
+  for (CeedInt i=impl->numein; i<numfields && !impl->fuseoutput; i++) {
+    ierr = CeedElemRestrictionCreateVector(impl->blkrestr[i], NULL,
+                                           &wsimpl->evecs[i]); CeedChk(ierr);
+  }
+  wsimpl->numthreads = 1;
+  ierr = CeedCalloc(1, &wsimpl->threads); CeedChk(ierr);
+  ierr = CeedOperatorSetupThread_Omp(op, wsimpl, &wsimpl->threads[0]);
+  CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Workspace Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorWorkspaceApplyAdd_Omp(CeedOperatorWorkspace ws,
+    CeedVector invec, CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  CeedOperator op;
+  ierr = CeedOperatorWorkspaceGetOperator(ws, &op); CeedChk(ierr);
+  CeedOperator_Omp *wsimpl;
+  ierr = CeedOperatorWorkspaceGetData(ws, &wsimpl); CeedChk(ierr);
+
+  return CeedOperatorApplyAddBlocks_Omp(op, wsimpl, invec, outvec, request);
+}
+
+//------------------------------------------------------------------------------
+// Workspace Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorWorkspaceDestroy_Omp(CeedOperatorWorkspace ws) {
+  int ierr;
+  CeedOperator_Omp *wsimpl;
+  ierr = CeedOperatorWorkspaceGetData(ws, &wsimpl); CeedChk(ierr);
+
+  for (CeedInt i=wsimpl->numein; i<wsimpl->numein+wsimpl->numeout &&
+       wsimpl->evecs; i++) {
+    ierr = CeedVectorDestroy(&wsimpl->evecs[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&wsimpl->evecs); CeedChk(ierr);
+  ierr = CeedFree(&wsimpl->edata); CeedChk(ierr);
+  if (wsimpl->threads) {
+    ierr = CeedOperatorDestroyThread_Omp(wsimpl, &wsimpl->threads[0]);
+    CeedChk(ierr);
+  }
+  ierr = CeedFree(&wsimpl->threads); CeedChk(ierr);
+  ierr = CeedFree(&wsimpl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedOperatorGetMemoryUsage_Omp(CeedOperator op, CeedSize *bytes) {
+  int ierr;
+  CeedOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedSize objbytes;
+
+  *bytes = 0;
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    ierr = CeedElemRestrictionGetMemoryUsage(impl->blkrestr[i], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+    ierr = CeedVectorGetMemoryUsage(impl->evecs[i], &objbytes); CeedChk(ierr);
+    *bytes += objbytes;
+  }
+  for (CeedInt t=0; t<impl->numthreads; t++) {
+    CeedOperatorThread_Omp *thread = &impl->threads[t];
+    for (CeedInt i=0; i<impl->numein; i++) {
+      ierr = CeedVectorGetMemoryUsage(thread->evecsin[i], &objbytes);
+      CeedChk(ierr);
+      *bytes += objbytes;
+      ierr = CeedVectorGetMemoryUsage(thread->qvecsin[i], &objbytes);
+      CeedChk(ierr);
+      *bytes += objbytes;
+    }
+    for (CeedInt i=0; i<impl->numeout; i++) {
+      ierr = CeedVectorGetMemoryUsage(thread->evecsout[i], &objbytes);
+      CeedChk(ierr);
+      *bytes += objbytes;
+      ierr = CeedVectorGetMemoryUsage(thread->qvecsout[i], &objbytes);
+      CeedChk(ierr);
+      *bytes += objbytes;
+    }
+  }
+  if (impl->blkschedule)
+    *bytes += (impl->coloroffsets[1] + 2)*sizeof(CeedInt);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Omp(CeedOperator op) {
+  int ierr;
+  CeedOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    ierr = CeedElemRestrictionDestroy(&impl->blkrestr[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->blkrestr); CeedChk(ierr);
+  ierr = CeedFree(&impl->evecs); CeedChk(ierr);
+  ierr = CeedFree(&impl->edata); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
+
+  for (CeedInt t=0; t<impl->numthreads; t++) {
+    ierr = CeedOperatorDestroyThread_Omp(impl, &impl->threads[t]);
+    CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->threads); CeedChk(ierr);
+  ierr = CeedFree(&impl->blkschedule); CeedChk(ierr);
+
+  ierr = CeedFree(&impl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Create
+//------------------------------------------------------------------------------
+int CeedOperatorCreate_Omp(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Omp *impl;
+
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Setup",
+                                CeedOperatorSetup_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
+                                CeedOperatorApplyAdd_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "GetMemoryUsage",
+                                CeedOperatorGetMemoryUsage_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceCreate",
+                                CeedOperatorWorkspaceCreate_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceApplyAdd",
+                                CeedOperatorWorkspaceApplyAdd_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceDestroy",
+                                CeedOperatorWorkspaceDestroy_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
+                                CeedOperatorDestroy_Omp); CeedChk(ierr);
+  return 0;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,80 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdbool.h>
+#include "ceed-omp.h"
+#include "../ref/ceed-ref.h"
+
+//------------------------------------------------------------------------------
+// ElemRestriction Apply
+//------------------------------------------------------------------------------
+// The transpose of a full restriction with offsets gathers the E-vector
+//   entries of each L-vector entry, so L-vector entries are split among
+//   threads without write conflicts. Other cases use the ref restriction.
+static int CeedElemRestrictionApply_Omp(CeedElemRestriction r,
+                                        CeedTransposeMode tmode, CeedVector u,
+                                        CeedVector v, CeedRequest *request) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+
+  if (tmode == CEED_TRANSPOSE && impl->offsets) {
+    ierr = CeedElemRestrictionSetupTransposeMap_Ref(r); CeedChk(ierr);
+  }
+  if (tmode != CEED_TRANSPOSE || !impl->offsets || !impl->ltoegather)
+    return CeedElemRestrictionApply_Ref(r, tmode, u, v, request);
+
+  CeedSize lsize;
+  ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+  const CeedInt *ltoeoffsets = impl->ltoeoffsets;
+  const CeedInt *ltoeindices = impl->ltoeindices;
+  const CeedScalar *uu;
+  CeedScalar *vv;
+  ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uu); CeedChk(ierr);
+  ierr = CeedVectorGetArray(v, CEED_MEM_HOST, &vv); CeedChk(ierr);
+  #pragma omp parallel for schedule(static)
+  for (CeedSize l = 0; l < lsize; l++) {
+    CeedScalar vl = vv[l];
+    for (CeedInt j = ltoeoffsets[l]; j < ltoeoffsets[l+1]; j++)
+      vl += uu[ltoeindices[j]];
+    vv[l] = vl;
+  }
+  ierr = CeedVectorRestoreArrayRead(u, &uu); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(v, &vv); CeedChk(ierr);
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Create
+//------------------------------------------------------------------------------
+int CeedElemRestrictionCreate_Omp(CeedMemType mtype, CeedCopyMode cmode,
+                                  const CeedInt *offsets,
+                                  CeedElemRestriction r) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+
+  ierr = CeedElemRestrictionCreate_Ref(mtype, cmode, offsets, r);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Apply",
+                                CeedElemRestrictionApply_Omp); CeedChk(ierr);
+  return 0;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,75 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#ifndef _ceed_omp_h
+#define _ceed_omp_h
+
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+  CeedInt blksize;
+} Ceed_Omp;
+
+typedef struct {
+  CeedVector invec;      /// View of the active input L-vector
+  CeedVector *evecsin;   /// Input E-vectors for one block
+  CeedVector *evecsout;  /// Output E-vectors for one block
+  CeedVector *qvecsin;   /// Input Q-vectors for one block
+  CeedVector *qvecsout;  /// Output Q-vectors for one block
+  CeedVector *lvecsout;  /// Views of the output L-vectors
+  const CeedScalar **qin; /// QFunction input arrays
+  CeedScalar **qout;     /// QFunction output arrays
+} CeedOperatorThread_Omp;
+
+typedef struct {
+  CeedElemRestriction *blkrestr; /// Blocked versions of restrictions
+  CeedVector
+  *evecs;   /// Full E-vectors for passive inputs and unfused outputs
+  CeedScalar **edata;
+  uint64_t *inputstate;  /// State counter of inputs
+  bool       inputlock;  /// Lock for restricting the passive inputs
+  CeedInt    numein;
+  CeedInt    numeout;
+  bool       fuseoutput; /// Blocks restrict their output directly
+  CeedInt    numcolors;  /// Block schedule, blocks of a color run concurrently
+  const CeedInt *coloroffsets;
+  const CeedInt *colorblks;
+  CeedInt   *blkschedule; /// Single color schedule if output is not fused
+  CeedInt    numthreads;
+  CeedOperatorThread_Omp *threads; /// Per-thread block scratch
+} CeedOperator_Omp;
+
+typedef struct {
+  CeedInt numsub;        /// Number of suboperators the schedule was built for
+  CeedSize outlength;    /// Active output length the schedule was built for
+  CeedInt numthreads;
+  bool    serial;        /// Suboperators share passive outputs, run in order
+  bool   *istask;        /// Suboperator is small and runs as a single task
+  bool   *isprivate;     /// Task output may overlap another task's output
+  CeedVector *outvecs;   /// Task outputs, views of the output or private buffers
+} CeedCompositeOperator_Omp;
+
+CEED_INTERN int CeedElemRestrictionCreate_Omp(CeedMemType mtype,
+    CeedCopyMode cmode, const CeedInt *offsets, CeedElemRestriction r);
+
+CEED_INTERN int CeedOperatorCreate_Omp(CeedOperator op);
+
+CEED_INTERN int CeedCompositeOperatorCreate_Omp(CeedOperator op);
+
+#endif // _ceed_omp_h
@@ -0,0 +1,153 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdbool.h>
+#include "ceed-opt.h"
+
+// Candidate block sizes, tried in increasing order when tuning
+static const CeedInt candidates[] = {1, 2, 4, 8, 16, 32};
+
+//------------------------------------------------------------------------------
+// Set Block Size
+//------------------------------------------------------------------------------
+// Resource option "blksize" selects the element block size, "blksize=auto"
+//   times operator application with candidate sizes for each basis shape on
+//   first use
+int CeedSetBlockSize_Opt(Ceed ceed, const char *resource,
+                         CeedInt defaultblksize) {
+  int ierr;
+  Ceed_Opt *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+  data->blksize = defaultblksize;
+
+  ierr = CeedGetBlockSizeOption_Ref(ceed, resource, &data->blksize,
+                                    &data->autotune);
+  if (ierr) {
+    // LCOV_EXCL_START
+    CeedFree(&data);
+    return ierr;
+    // LCOV_EXCL_STOP
+  }
+  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get Operator Block Size
+//------------------------------------------------------------------------------
+int CeedOperatorGetBlockSize_Opt(CeedOperator op, CeedInt *blksize) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Opt *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  *blksize = data->blksize;
+  if (!data->autotune)
+    return 0;
+
+  // Tuned sizes are cached by the shape of the basis that dominates the
+  //   element work, preferring active fields
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+  CeedBasis basis = NULL;
+  for (CeedInt i=0; i<numinputfields; i++) {
+    CeedEvalMode fieldemode;
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &fieldemode);
+    CeedChk(ierr);
+    if (fieldemode != CEED_EVAL_INTERP && fieldemode != CEED_EVAL_GRAD)
+      continue;
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    if (!basis || vec == CEED_VECTOR_ACTIVE) {
+      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
+      if (vec == CEED_VECTOR_ACTIVE)
+        break;
+    }
+  }
+  if (!basis)
+    return 0;
+
+  // Look for a block size tuned for this shape; operators on other threads
+  //   may be tuning and growing the cache at the same time
+  CeedInt dim, ncomp, P, Q;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &P); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &Q); CeedChk(ierr);
+  bool found = false;
+  CeedSpinLock(data->tunelock);
+  for (CeedInt i=0; i<data->numtuned && !found; i++) {
+    CeedBlockSizeTuning_Opt *tuned = &data->tuned[i];
+    if (tuned->P == P && tuned->Q == Q && tuned->ncomp == ncomp &&
+        tuned->dim == dim) {
+      *blksize = tuned->blksize;
+      found = true;
+    }
+  }
+  CeedSpinUnlock(data->tunelock);
+  if (found)
+    return 0;
+
+  // Time candidates, larger blocks than the number of elements only add work
+  CeedInt numelements;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  double best = -1;
+  const CeedInt numcandidates = sizeof(candidates)/sizeof(candidates[0]);
+  for (CeedInt i=0; i<numcandidates; i++) {
+    if (i > 0 && candidates[i-1] >= numelements)
+      break;
+    double time;
+    ierr = CeedOperatorTimeBlockSize_Opt(op, candidates[i], &time);
+    CeedChk(ierr);
+    if (best < 0 || time < best) {
+      best = time;
+      *blksize = candidates[i];
+    }
+  }
+
+  // Cache winner, unless an operator on another thread got there first
+  CeedSpinLock(data->tunelock);
+  for (CeedInt i=0; i<data->numtuned && !found; i++) {
+    CeedBlockSizeTuning_Opt *tuned = &data->tuned[i];
+    found = tuned->P == P && tuned->Q == Q && tuned->ncomp == ncomp &&
+            tuned->dim == dim;
+  }
+  ierr = 0;
+  if (!found)
+    ierr = CeedRealloc(data->numtuned+1, &data->tuned);
+  if (!found && !ierr) {
+    data->tuned[data->numtuned++] = (CeedBlockSizeTuning_Opt) {
+      .P = P, .Q = Q, .ncomp = ncomp, .dim = dim, .blksize = *blksize
+    };
+  }
+  CeedSpinUnlock(data->tunelock);
+  CeedChk(ierr);
+
+  return 0;
+}
+//------------------------------------------------------------------------------
@@ -14,26 +14,30 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#define _POSIX_C_SOURCE 200112
 #include <ceed.h>
 #include <ceed-backend.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include <time.h>
 #include "ceed-opt.h"
 
+// Elements and repetitions timed for each candidate block size when tuning
+#define CEED_OPT_TUNE_ELEMENTS 64
+#define CEED_OPT_TUNE_REPS 3
+
 //------------------------------------------------------------------------------
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
 static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
                                        bool inOrOut, const CeedInt blksize,
                                        CeedElemRestriction *blkrestr,
-                                       CeedVector *fullevecs, CeedVector *evecs,
-                                       CeedVector *qvecs, CeedInt starte,
-                                       CeedInt numfields, CeedInt Q) {
-  CeedInt dim, ierr, ncomp, size, P;
+                                       CeedOperatorFieldPlan_Opt *plan,
+                                       CeedInt starte, CeedInt numfields) {
+  CeedInt ierr, ncomp;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  CeedBasis basis;
   CeedElemRestriction r;
   CeedOperatorField *opfields;
   CeedQFunctionField *qffields;
@@ -53,26 +57,48 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
   for (CeedInt i=0; i<numfields; i++) {
     CeedEvalMode emode;
     ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetSize(qffields[i], &plan[i].size); CeedChk(ierr);
+    plan[i].emode = emode;
+    ierr = CeedOperatorFieldGetVector(opfields[i], &plan[i].vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetBasis(opfields[i], &plan[i].basis); CeedChk(ierr);
+    if (emode == CEED_EVAL_DIV || emode == CEED_EVAL_CURL)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Ceed evaluation mode not implemented");
+    // LCOV_EXCL_STOP
 
     if (emode != CEED_EVAL_WEIGHT) {
       ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &r);
       CeedChk(ierr);
       Ceed ceed;
       ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
-      CeedInt nelem, elemsize, lsize, compstride;
+      CeedInt nelem, elemsize, compstride;
+      CeedSize lsize;
       ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
       ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
       ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
       ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
 
-      bool strided;
+      bool strided, hasoffsets64;
       ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChk(ierr);
+      ierr = CeedElemRestrictionHasOffsets64(r, &hasoffsets64); CeedChk(ierr);
       if (strided) {
         CeedInt strides[3];
         ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
         ierr = CeedElemRestrictionCreateBlockedStrided(ceed, nelem, elemsize,
                blksize, ncomp, lsize, strides, &blkrestr[i+starte]);
         CeedChk(ierr);
+      } else if (hasoffsets64) {
+        const CeedSize *offsets = NULL;
+        ierr = CeedElemRestrictionGetOffsets64(r, CEED_MEM_HOST, &offsets);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+        ierr = CeedElemRestrictionCreateBlocked64(ceed, nelem, elemsize,
+                                                  blksize, ncomp, compstride,
+                                                  lsize, CEED_MEM_HOST,
+                                                  CEED_COPY_VALUES, offsets,
+                                                  &blkrestr[i+starte]);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionRestoreOffsets64(r, &offsets); CeedChk(ierr);
       } else {
         const CeedInt *offsets = NULL;
         ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
@@ -86,442 +112,1132 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
         CeedChk(ierr);
         ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
       }
-      ierr = CeedElemRestrictionCreateVector(blkrestr[i+starte], NULL,
-                                             &fullevecs[i+starte]);
-      CeedChk(ierr);
+      plan[i].rstr = blkrestr[i+starte];
     }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Input/Output E-vectors and Q-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFieldVectors_Opt(CeedOperator op, bool inOrOut,
+    const CeedInt blksize, const CeedOperatorFieldPlan_Opt *plan,
+    CeedVector *evecs, CeedVector *qvecs, CeedInt numfields, CeedInt Q) {
+  CeedInt dim, ierr, size, P;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
 
-    switch(emode) {
+  // Loop over fields
+  for (CeedInt i=0; i<numfields; i++) {
+    size = plan[i].size;
+    switch(plan[i].emode) {
     case CEED_EVAL_NONE:
-      ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, Q*size*blksize, &evecs[i]); CeedChk(ierr);
+      // Inputs are restricted directly into the Q-vector
+      if (inOrOut) {
+        ierr = CeedVectorCreate(ceed, Q*size*blksize, &evecs[i]); CeedChk(ierr);
+      }
       ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_INTERP:
-      ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
-      ierr = CeedElemRestrictionGetElementSize(r, &P);
+      ierr = CeedElemRestrictionGetElementSize(plan[i].rstr, &P);
       CeedChk(ierr);
       ierr = CeedVectorCreate(ceed, P*size*blksize, &evecs[i]); CeedChk(ierr);
       ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_GRAD:
-      ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
-      ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
-      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
-      ierr = CeedElemRestrictionGetElementSize(r, &P);
+      ierr = CeedBasisGetDimension(plan[i].basis, &dim); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetElementSize(plan[i].rstr, &P);
       CeedChk(ierr);
       ierr = CeedVectorCreate(ceed, P*size/dim*blksize, &evecs[i]); CeedChk(ierr);
       ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_WEIGHT: // Only on input fields
-      ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
       ierr = CeedVectorCreate(ceed, Q*blksize, &qvecs[i]); CeedChk(ierr);
-      ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
+      ierr = CeedBasisApply(plan[i].basis, blksize, CEED_NOTRANSPOSE,
                             CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, qvecs[i]);
       CeedChk(ierr);
-
       break;
     case CEED_EVAL_DIV:
-      break; // Not implemented
     case CEED_EVAL_CURL:
-      break; // Not implemented
+      break; // Refused at setup
     }
   }
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Setup Operator
+// Fuse Input Interpolation and Gradient
 //------------------------------------------------------------------------------
-static int CeedOperatorSetup_Opt(CeedOperator op) {
+static int CeedOperatorSetupFusedInputs_Opt(CeedOperator op,
+    CeedOperatorFieldPlan_Opt *plan, CeedInt numfields) {
+  int ierr;
+  CeedOperatorField *opfields;
+  ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
+
+  for (CeedInt i=0; i<numfields; i++)
+    plan[i].gradfield = -1;
+
+  // Pair interpolated inputs with gradients of the same field, so one
+  //   restriction and one basis evaluation serve both; each field holds its
+  //   own blocked restriction, so compare the user restrictions
+  for (CeedInt i=0; i<numfields; i++) {
+    if (plan[i].emode != CEED_EVAL_INTERP)
+      continue;
+    CeedElemRestriction rstri;
+    ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &rstri);
+    CeedChk(ierr);
+    for (CeedInt j=0; j<numfields; j++) {
+      if (plan[j].emode != CEED_EVAL_GRAD || plan[j].fused ||
+          plan[j].vec != plan[i].vec || plan[j].basis != plan[i].basis)
+        continue;
+      CeedElemRestriction rstrj;
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[j], &rstrj);
+      CeedChk(ierr);
+      if (rstrj != rstri)
+        continue;
+      plan[i].gradfield = j;
+      plan[j].fused = true;
+      break;
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Single Precision Basis Actions
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFP32_Opt(CeedOperator op, CeedOperator_Opt *impl) {
+  int ierr;
+  CeedScalarType prec;
+  ierr = CeedOperatorGetPrecision(op, &prec); CeedChk(ierr);
+  if (prec != CEED_SCALAR_FP32)
+    return 0;
+
+  // Interpolation and gradients with tensor bases run in single precision,
+  //   from the restriction up to the QFunction; other fields stay in double
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    CeedOperatorFieldPlan_Opt *field = i < impl->numein ? &impl->planin[i] :
+                                       &impl->planout[i-impl->numein];
+    if ((field->emode != CEED_EVAL_INTERP && field->emode != CEED_EVAL_GRAD) ||
+        field->fused)
+      continue;
+    bool tensor;
+    ierr = CeedBasisIsTensor(field->basis, &tensor); CeedChk(ierr);
+    if (!tensor)
+      continue;
+    ierr = CeedBasisCreateFP32_Opt(field->basis, &field->basisfp32);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Single Precision E-vectors and Q-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupDataFP32_Opt(CeedOperator_Opt *impl) {
+  int ierr;
+
+  size_t worksize = 0, datasize = 0;
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    const CeedOperatorFieldPlan_Opt *field = i < impl->numein ?
+        &impl->planin[i] : &impl->planout[i-impl->numein];
+    if (!field->basisfp32)
+      continue;
+    size_t size;
+    ierr = CeedBasisGetWorkSizeFP32_Opt(field->basisfp32, impl->blksize, &size);
+    CeedChk(ierr);
+    worksize = size > worksize ? size : worksize;
+    CeedInt elemsize, qsize = field->size*impl->numqpts;
+    ierr = CeedElemRestrictionGetElementSize(field->rstr, &elemsize);
+    CeedChk(ierr);
+    if (field->gradfield >= 0)
+      qsize *= 1 + field->basisfp32->dim;
+    datasize += (size_t)impl->blksize*(elemsize*field->ncomp + qsize);
+  }
+  if (!worksize)
+    return 0;
+  ierr = CeedMalloc(worksize, &impl->workfp32); CeedChk(ierr);
+  ierr = CeedMalloc(datasize, &impl->datafp32); CeedChk(ierr);
+  impl->sizefp32 = worksize + datasize;
+
+  // Single block E- and Q-vectors of each field
+  float *data = impl->datafp32;
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    CeedOperatorFieldPlan_Opt *field = i < impl->numein ? &impl->planin[i] :
+                                       &impl->planout[i-impl->numein];
+    if (!field->basisfp32)
+      continue;
+    CeedInt elemsize, qsize = field->size*impl->numqpts;
+    ierr = CeedElemRestrictionGetElementSize(field->rstr, &elemsize);
+    CeedChk(ierr);
+    if (field->gradfield >= 0)
+      qsize *= 1 + field->basisfp32->dim;
+    field->edatafp32 = data;
+    field->qdatafp32 = data + impl->blksize*elemsize*field->ncomp;
+    data = field->qdatafp32 + impl->blksize*qsize;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Reduced Precision Passive Inputs
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupPassive_Opt(CeedOperator op,
+                                        CeedOperator_Opt *impl, CeedInt Q) {
+  int ierr;
+  ierr = CeedOperatorGetPassivePrecision(op, &impl->passiveprecision);
+  CeedChk(ierr);
+  if (impl->passiveprecision == CEED_SCALAR_FP64)
+    return 0;
+
+  // Passive inputs without a basis are packed for all element blocks at once
+  CeedInt numelements;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  const CeedInt blksize = impl->blksize;
+  const CeedInt nblks = (numelements/blksize) + !!(numelements%blksize);
+  const size_t bytes = impl->passiveprecision == CEED_SCALAR_BF16 ?
+                       sizeof(uint16_t) : sizeof(float);
+  for (CeedInt i=0; i<impl->numein; i++) {
+    CeedOperatorFieldPlan_Opt *field = &impl->planin[i];
+    if (field->emode != CEED_EVAL_NONE || field->vec == CEED_VECTOR_ACTIVE)
+      continue;
+    ierr = CeedMalloc((size_t)nblks*blksize*Q*field->size*bytes,
+                      (char **)&field->packed); CeedChk(ierr);
+    field->packedstate = UINT64_MAX;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Pack Passive Inputs
+//------------------------------------------------------------------------------
+static int CeedOperatorPackPassiveFields_Opt(CeedOperator op,
+    CeedOperator_Opt *impl, const CeedOperator_Opt *scratch) {
+  int ierr;
+  CeedInt numelements;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  const CeedInt blksize = impl->blksize;
+  const CeedInt nblks = (numelements/blksize) + !!(numelements%blksize);
+  const size_t bytes = impl->passiveprecision == CEED_SCALAR_BF16 ?
+                       sizeof(uint16_t) : sizeof(float);
+
+  // Repack only when the passive vector has changed since the last pack
+  for (CeedInt i=0; i<impl->numein; i++) {
+    CeedOperatorFieldPlan_Opt *field = &impl->planin[i];
+    if (!field->packed)
+      continue;
+    uint64_t state;
+    ierr = CeedVectorGetState(field->vec, &state); CeedChk(ierr);
+    if (state == field->packedstate)
+      continue;
+    const CeedInt blkentries = blksize*impl->numqpts*field->size;
+    CeedScalar *qdata = scratch->planin[i].qdata;
+    const CeedScalar *l;
+    ierr = CeedVectorGetArrayRead(field->vec, CEED_MEM_HOST, &l); CeedChk(ierr);
+    for (CeedInt b=0; b<nblks; b++) {
+      ierr = field->rstrimpl->Apply(field->rstr, field->ncomp, blksize,
+                                    field->compstride, b, b+1,
+                                    CEED_NOTRANSPOSE, l, qdata);
+      CeedChk(ierr);
+      ierr = CeedScalarPack_Opt(impl->passiveprecision, blkentries, qdata,
+                                (char *)field->packed +
+                                (size_t)b*blkentries*bytes); CeedChk(ierr);
+    }
+    ierr = CeedVectorRestoreArrayRead(field->vec, &l); CeedChk(ierr);
+    field->packedstate = state;
+  }
+  return 0;
+}
+
+// The packed inputs of the operator are shared by its CeedOperatorWorkspaces,
+//   so they are packed under a lock, with the Q-vector arrays of the caller as
+//   scratch
+static int CeedOperatorPackPassive_Opt(CeedOperator op, CeedOperator_Opt *impl,
+                                       const CeedOperator_Opt *scratch) {
+  int ierr;
+  if (impl->passiveprecision == CEED_SCALAR_FP64)
+    return 0;
+
+  CeedSpinLock(impl->packlock);
+  ierr = CeedOperatorPackPassiveFields_Opt(op, impl, scratch);
+  CeedSpinUnlock(impl->packlock);
+  CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Resolve Restriction Kernels
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupPlanRestrictions_Opt(
+  CeedOperatorFieldPlan_Opt *plan, CeedInt numfields) {
+  int ierr;
+
+  for (CeedInt i=0; i<numfields; i++) {
+    if (!plan[i].rstr)
+      continue;
+    ierr = CeedElemRestrictionGetData(plan[i].rstr, &plan[i].rstrimpl);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(plan[i].rstr, &plan[i].ncomp);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetCompStride(plan[i].rstr, &plan[i].compstride);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Resolve Field Arrays
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupPlanArrays_Opt(CeedOperatorFieldPlan_Opt *plan,
+    CeedVector *evecs, CeedVector *qvecs, CeedInt numfields) {
+  int ierr;
+  CeedScalar *array;
+
+  // The single block E- and Q-vectors keep their arrays for the life of the
+  //   operator, so the element loop works on the arrays directly
+  for (CeedInt i=0; i<numfields; i++) {
+    if (evecs[i]) {
+      ierr = CeedVectorGetArray(evecs[i], CEED_MEM_HOST, &array); CeedChk(ierr);
+      plan[i].edata = array;
+      ierr = CeedVectorRestoreArray(evecs[i], &array); CeedChk(ierr);
+    }
+    if (qvecs[i]) {
+      ierr = CeedVectorGetArray(qvecs[i], CEED_MEM_HOST, &array); CeedChk(ierr);
+      plan[i].qdata = array;
+      ierr = CeedVectorRestoreArray(qvecs[i], &array); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Scratch E-vectors and Q-vectors
+//------------------------------------------------------------------------------
+// Single block E- and Q-vectors and their arrays in the execution plan; a
+//   CeedOperatorWorkspace sets up its own in a copy of the plan
+static int CeedOperatorSetupScratch_Opt(CeedOperator op,
+                                        CeedOperator_Opt *impl) {
   int ierr;
-  bool setupdone;
-  ierr = CeedOperatorIsSetupDone(op, &setupdone); CeedChk(ierr);
-  if (setupdone) return 0;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  Ceed_Opt *ceedimpl;
-  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
-  const CeedInt blksize = ceedimpl->blksize;
-  CeedOperator_Opt *impl;
-  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  const CeedInt blksize = impl->blksize, Q = impl->numqpts;
+  const CeedInt numinputfields = impl->numein, numoutputfields = impl->numeout;
+
+  // Allocate
+  ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+
+  // Infields
+  ierr = CeedOperatorSetupFieldVectors_Opt(op, 0, blksize, impl->planin,
+         impl->evecsin, impl->qvecsin, numinputfields, Q);
+  CeedChk(ierr);
+  // Outfields
+  ierr = CeedOperatorSetupFieldVectors_Opt(op, 1, blksize, impl->planout,
+         impl->evecsout, impl->qvecsout, numoutputfields, Q);
+  CeedChk(ierr);
+
+  // The QFunction reads both parts of a fused Q-vector in place
+  for (CeedInt i=0; i<numinputfields; i++) {
+    CeedOperatorFieldPlan_Opt *field = &impl->planin[i];
+    const CeedInt j = field->gradfield;
+    if (j < 0)
+      continue;
+    CeedScalar *q;
+    ierr = CeedVectorCreate(ceed, Q*blksize*(field->size +
+                                             impl->planin[j].size),
+                            &field->qvecfused); CeedChk(ierr);
+    ierr = CeedVectorGetArray(field->qvecfused, CEED_MEM_HOST, &q);
+    CeedChk(ierr);
+    ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                              q); CeedChk(ierr);
+    ierr = CeedVectorSetArray(impl->qvecsin[j], CEED_MEM_HOST, CEED_USE_POINTER,
+                              &q[Q*blksize*field->size]); CeedChk(ierr);
+    ierr = CeedVectorRestoreArray(field->qvecfused, &q); CeedChk(ierr);
+  }
+
+  // Identity QFunctions
+  if (impl->identityqf) {
+    for (CeedInt i=0; i<numinputfields; i++) {
+      ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
+      impl->qvecsout[i] = impl->qvecsin[i];
+      ierr = CeedVectorAddReference(impl->qvecsin[i]); CeedChk(ierr);
+    }
+  }
+
+  // Outputs without a basis action are written straight to the E-vector
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    if (impl->planout[i].emode == CEED_EVAL_NONE) {
+      CeedScalar *e;
+      ierr = CeedVectorGetArray(impl->evecsout[i], CEED_MEM_HOST, &e);
+      CeedChk(ierr);
+      ierr = CeedVectorSetArray(impl->qvecsout[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER, e); CeedChk(ierr);
+      ierr = CeedVectorRestoreArray(impl->evecsout[i], &e); CeedChk(ierr);
+    }
+  }
+
+  // Arrays used by the element loop
+  ierr = CeedOperatorSetupPlanArrays_Opt(impl->planin, impl->evecsin,
+                                         impl->qvecsin, numinputfields);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetupPlanArrays_Opt(impl->planout, impl->evecsout,
+                                         impl->qvecsout, numoutputfields);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetupDataFP32_Opt(impl); CeedChk(ierr);
+  for (CeedInt i=0; i<numinputfields; i++)
+    impl->qin[i] = impl->planin[i].qdata;
+  for (CeedInt i=0; i<numoutputfields; i++)
+    impl->qout[i] = impl->planout[i].qdata;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Destroy Scratch E-vectors and Q-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyScratch_Opt(CeedOperator_Opt *impl) {
+  int ierr;
+  // The arrays are allocated together, qvecsout last
+  const bool allocated = impl->qvecsout;
+
+  for (CeedInt i=0; i<impl->numein && allocated; i++) {
+    ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->qvecsin[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->planin[i].qvecfused); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->evecsin); CeedChk(ierr);
+  ierr = CeedFree(&impl->qvecsin); CeedChk(ierr);
+
+  for (CeedInt i=0; i<impl->numeout && allocated; i++) {
+    ierr = CeedVectorDestroy(&impl->evecsout[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->evecsout); CeedChk(ierr);
+  ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+
+  ierr = CeedFree(&impl->workfp32); CeedChk(ierr);
+  ierr = CeedFree(&impl->datafp32); CeedChk(ierr);
+  impl->sizefp32 = 0;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Element Blocks
+//------------------------------------------------------------------------------
+// Blocked restrictions, E- and Q-vectors, and execution plan for blocks of
+//   impl->blksize elements
+static int CeedOperatorSetupBlocks_Opt(CeedOperator op,
+                                       CeedOperator_Opt *impl) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  const CeedInt blksize = impl->blksize;
   CeedQFunction qf;
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
   CeedInt Q, numinputfields, numoutputfields;
   ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  impl->numqpts = Q;
   ierr = CeedQFunctionIsIdentity(qf, &impl->identityqf); CeedChk(ierr);
   ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
   CeedChk(ierr);
-  CeedOperatorField *opinputfields, *opoutputfields;
-  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
-  CeedChk(ierr);
-  CeedQFunctionField *qfinputfields, *qfoutputfields;
-  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
-  CeedChk(ierr);
 
   // Allocate
   ierr = CeedCalloc(numinputfields + numoutputfields, &impl->blkrestr);
   CeedChk(ierr);
-  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->evecs);
-  CeedChk(ierr);
   ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
   CeedChk(ierr);
 
-  ierr = CeedCalloc(16, &impl->inputstate); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->planin); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->planout); CeedChk(ierr);
 
   impl->numein = numinputfields; impl->numeout = numoutputfields;
 
-  // Set up infield and outfield pointer arrays
+  // Execution plan
   // Infields
   ierr = CeedOperatorSetupFields_Opt(qf, op, 0, blksize, impl->blkrestr,
-                                     impl->evecs, impl->evecsin,
-                                     impl->qvecsin, 0,
-                                     numinputfields, Q);
+                                     impl->planin, 0, numinputfields);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetupFusedInputs_Opt(op, impl->planin, numinputfields);
   CeedChk(ierr);
   // Outfields
   ierr = CeedOperatorSetupFields_Opt(qf, op, 1, blksize, impl->blkrestr,
-                                     impl->evecs, impl->evecsout,
-                                     impl->qvecsout, numinputfields,
-                                     numoutputfields, Q);
+                                     impl->planout, numinputfields,
+                                     numoutputfields);
   CeedChk(ierr);
+  ierr = CeedOperatorSetupPassive_Opt(op, impl, Q); CeedChk(ierr);
 
-  // Identity QFunctions
-  if (impl->identityqf) {
-    CeedEvalMode inmode, outmode;
-    CeedQFunctionField *infields, *outfields;
-    ierr = CeedQFunctionGetFields(qf, &infields, &outfields); CeedChk(ierr);
+  // Kernels used by the element loop
+  ierr = CeedOperatorSetupPlanRestrictions_Opt(impl->planin, numinputfields);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetupPlanRestrictions_Opt(impl->planout, numoutputfields);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetupFP32_Opt(op, impl); CeedChk(ierr);
+  if (!impl->identityqf) {
+    CeedInt vlength;
+    ierr = CeedQFunctionGetVectorLength(qf, &vlength); CeedChk(ierr);
+    if ((Q*blksize) % vlength)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 2, "Number of quadrature points %d must be a "
+                       "multiple of %d", Q*blksize, vlength);
+    // LCOV_EXCL_STOP
+  }
 
-    for (CeedInt i=0; i<numinputfields; i++) {
-      ierr = CeedQFunctionFieldGetEvalMode(infields[i], &inmode);
-      CeedChk(ierr);
-      ierr = CeedQFunctionFieldGetEvalMode(outfields[i], &outmode);
-      CeedChk(ierr);
+  // E-vectors and Q-vectors for the operator's own application
+  ierr = CeedOperatorSetupScratch_Opt(op, impl); CeedChk(ierr);
+  return 0;
+}
 
-      ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
-      impl->qvecsout[i] = impl->qvecsin[i];
-      ierr = CeedVectorAddReference(impl->qvecsin[i]); CeedChk(ierr);
-    }
+//------------------------------------------------------------------------------
+// Destroy Element Blocks
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyBlocks_Opt(CeedOperator_Opt *impl) {
+  int ierr;
+
+  ierr = CeedOperatorDestroyScratch_Opt(impl); CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    ierr = CeedElemRestrictionDestroy(&impl->blkrestr[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->blkrestr); CeedChk(ierr);
+  ierr = CeedFree(&impl->edata); CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numein; i++) {
+    ierr = CeedBasisDestroyFP32_Opt(&impl->planin[i].basisfp32); CeedChk(ierr);
+    ierr = CeedFree(&impl->planin[i].packed); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<impl->numeout; i++) {
+    ierr = CeedBasisDestroyFP32_Opt(&impl->planout[i].basisfp32); CeedChk(ierr);
   }
+  ierr = CeedFree(&impl->planin); CeedChk(ierr);
+  ierr = CeedFree(&impl->planout); CeedChk(ierr);
+  ierr = CeedFree(&impl->chebstart); CeedChk(ierr);
+  ierr = CeedFree(&impl->chebnodes); CeedChk(ierr);
+  impl->chebsetup = false;
+  return 0;
+}
 
+//------------------------------------------------------------------------------
+// Setup Operator
+//------------------------------------------------------------------------------
+static int CeedOperatorSetup_Opt(CeedOperator op) {
+  int ierr;
+  bool setupdone;
+  ierr = CeedOperatorIsSetupDone(op, &setupdone); CeedChk(ierr);
+  if (setupdone) return 0;
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  ierr = CeedOperatorGetBlockSize_Opt(op, &impl->blksize); CeedChk(ierr);
+  ierr = CeedOperatorSetupBlocks_Opt(op, impl); CeedChk(ierr);
   ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
 
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Setup Input Fields
+// Get L-vector Arrays
 //------------------------------------------------------------------------------
-static inline int CeedOperatorSetupInputs_Opt(CeedInt numinputfields,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
-    CeedVector invec, CeedOperator_Opt *impl, CeedRequest *request) {
-  CeedInt ierr;
-  CeedEvalMode emode;
-  CeedVector vec;
-  uint64_t state;
+static int CeedOperatorGetLArrays_Opt(CeedOperator_Opt *impl,
+                                      CeedVector invec, CeedVector outvec,
+                                      const CeedScalar **lin,
+                                      CeedScalar **lout) {
+  int ierr;
 
-  for (CeedInt i=0; i<numinputfields; i++) {
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-    CeedChk(ierr);
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
-    } else {
-      // Get input vector
-      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-      if (vec != CEED_VECTOR_ACTIVE) {
-        // Restrict
-        ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
-        if (state != impl->inputstate[i]) {
-          ierr = CeedElemRestrictionApply(impl->blkrestr[i], CEED_NOTRANSPOSE,
-                                          vec, impl->evecs[i], request);
-          CeedChk(ierr);
-          impl->inputstate[i] = state;
-        }
-      } else {
-        // Set Qvec for CEED_EVAL_NONE
-        if (emode == CEED_EVAL_NONE) {
-          ierr = CeedVectorGetArray(impl->evecsin[i], CEED_MEM_HOST,
-                                    &impl->edata[i]); CeedChk(ierr);
-          ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
-                                    CEED_USE_POINTER,
-                                    impl->edata[i]); CeedChk(ierr);
-          ierr = CeedVectorRestoreArray(impl->evecsin[i],
-                                        &impl->edata[i]); CeedChk(ierr);
-        }
-      }
-      // Get evec
-      ierr = CeedVectorGetArrayRead(impl->evecs[i], CEED_MEM_HOST,
-                                    (const CeedScalar **) &impl->edata[i]);
-      CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numein; i++) {
+    const CeedOperatorFieldPlan_Opt *field = &impl->planin[i];
+    CeedVector vec = field->vec == CEED_VECTOR_ACTIVE ? invec : field->vec;
+    lin[i] = NULL;
+    if (field->emode == CEED_EVAL_WEIGHT || field->fused || field->packed ||
+        !vec)
+      continue;
+    ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &lin[i]); CeedChk(ierr);
+  }
+  // Several output fields may sum into the same vector
+  for (CeedInt i=0; i<impl->numeout && lout; i++) {
+    CeedVector vec = impl->planout[i].vec == CEED_VECTOR_ACTIVE ? outvec :
+                     impl->planout[i].vec;
+    lout[i] = NULL;
+    for (CeedInt j=0; j<i && !lout[i]; j++) {
+      CeedVector vecj = impl->planout[j].vec == CEED_VECTOR_ACTIVE ? outvec :
+                        impl->planout[j].vec;
+      if (vecj == vec)
+        lout[i] = lout[j];
+    }
+    if (!lout[i]) {
+      ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &lout[i]); CeedChk(ierr);
     }
   }
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Input Basis Action
+// Restore L-vector Arrays
 //------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
-    CeedInt numinputfields, CeedInt blksize, CeedVector invec, bool skipactive,
-    CeedOperator_Opt *impl, CeedRequest *request) {
+static int CeedOperatorRestoreLArrays_Opt(CeedOperator_Opt *impl,
+    CeedVector invec, CeedVector outvec, const CeedScalar **lin,
+    CeedScalar **lout) {
+  int ierr;
+
+  for (CeedInt i=0; i<impl->numein; i++) {
+    if (!lin[i])
+      continue;
+    CeedVector vec = impl->planin[i].vec == CEED_VECTOR_ACTIVE ? invec :
+                     impl->planin[i].vec;
+    ierr = CeedVectorRestoreArrayRead(vec, &lin[i]); CeedChk(ierr);
+  }
+  for (CeedInt i=impl->numeout-1; i>=0 && lout; i--) {
+    bool shared = false;
+    for (CeedInt j=0; j<i; j++)
+      shared = shared || lout[j] == lout[i];
+    if (shared)
+      continue;
+    CeedVector vec = impl->planout[i].vec == CEED_VECTOR_ACTIVE ? outvec :
+                     impl->planout[i].vec;
+    ierr = CeedVectorRestoreArray(vec, &lout[i]); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Input Restriction and Basis Action
+//------------------------------------------------------------------------------
+static inline int CeedOperatorInputBasis_Opt(CeedInt b, CeedInt blksize,
+    const CeedScalar **lin, CeedOperator_Opt *impl) {
   CeedInt ierr;
-  CeedInt dim, elemsize, size;
-  CeedElemRestriction Erestrict;
-  CeedEvalMode emode;
-  CeedBasis basis;
-  CeedVector vec;
 
-  for (CeedInt i=0; i<numinputfields; i++) {
-    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-    // Skip active input
-    if (skipactive) {
-      if (vec == CEED_VECTOR_ACTIVE)
-        continue;
-    }
+  for (CeedInt i=0; i<impl->numein; i++) {
+    const CeedOperatorFieldPlan_Opt *field = &impl->planin[i];
+    if (field->emode == CEED_EVAL_WEIGHT || field->fused)
+      continue;
 
-    CeedInt activein = 0;
-    // Get elemsize, emode, size
-    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
-    // Restrict block active input
-    if (vec == CEED_VECTOR_ACTIVE) {
-      ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i], e/blksize,
-                                           CEED_NOTRANSPOSE, invec,
-                                           impl->evecsin[i], request);
+    // Widen packed passive inputs into the Q-vector
+    if (field->packed) {
+      const size_t bytes = impl->passiveprecision == CEED_SCALAR_BF16 ?
+                           sizeof(uint16_t) : sizeof(float);
+      const CeedInt blkentries = blksize*field->size*(impl->numqpts);
+      ierr = CeedScalarUnpack_Opt(impl->passiveprecision, blkentries,
+                                  (char *)field->packed +
+                                  (size_t)b*blkentries*bytes, field->qdata);
       CeedChk(ierr);
-      activein = 1;
+      continue;
     }
-    // Basis action
-    switch(emode) {
-    case CEED_EVAL_NONE:
-      if (!activein) {
-        ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
-                                  CEED_USE_POINTER,
-                                  &impl->edata[i][e*Q*size]); CeedChk(ierr);
-      }
-      break;
-    case CEED_EVAL_INTERP:
-      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
-      CeedChk(ierr);
-      if (!activein) {
-        ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
-                                  CEED_USE_POINTER,
-                                  &impl->edata[i][e*elemsize*size]);
-        CeedChk(ierr);
-      }
-      ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
-                            CEED_EVAL_INTERP, impl->evecsin[i],
-                            impl->qvecsin[i]); CeedChk(ierr);
-      break;
-    case CEED_EVAL_GRAD:
-      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
+    // Inputs left out, the active input when assembling
+    if (!lin[i])
+      continue;
+    // Basis action, with the gradient of a fused pair alongside
+    CeedEvalMode emode = field->emode;
+    if (field->gradfield >= 0)
+      emode = CEED_EVAL_INTERP | CEED_EVAL_GRAD;
+    // Single precision from the restriction on, widened for the QFunction
+    if (field->basisfp32) {
+      CeedInt qentries = blksize*field->size*impl->numqpts;
+      if (field->gradfield >= 0)
+        qentries *= 1 + field->basisfp32->dim;
+      ierr = CeedElemRestrictionApplyFP32_Opt(field->rstr, field->ncomp,
+                                              blksize, field->compstride, b,
+                                              lin[i], field->edatafp32);
       CeedChk(ierr);
-      if (!activein) {
-        ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
-        ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
-                                  CEED_USE_POINTER,
-                                  &impl->edata[i][e*elemsize*size/dim]);
-        CeedChk(ierr);
-      }
-      ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
-                            CEED_EVAL_GRAD, impl->evecsin[i],
-                            impl->qvecsin[i]); CeedChk(ierr);
-      break;
-    case CEED_EVAL_WEIGHT:
-      break;  // No action
-    // LCOV_EXCL_START
-    case CEED_EVAL_DIV:
-    case CEED_EVAL_CURL: {
-      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
+      ierr = CeedBasisApplyFP32_Opt(field->basisfp32, blksize,
+                                    CEED_NOTRANSPOSE, emode, impl->workfp32,
+                                    field->edatafp32, field->qdatafp32);
       CeedChk(ierr);
-      Ceed ceed;
-      ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
-      return CeedError(ceed, 1, "Ceed evaluation mode not implemented");
-      // LCOV_EXCL_STOP
-    }
+      CeedPragmaSIMD
+      for (CeedInt j=0; j<qentries; j++)
+        field->qdata[j] = field->qdatafp32[j];
+      continue;
     }
+    // Restrict block, directly into the Q-vector for CEED_EVAL_NONE
+    CeedScalar *e = field->emode == CEED_EVAL_NONE ? field->qdata : field->edata;
+    ierr = field->rstrimpl->Apply(field->rstr, field->ncomp, blksize,
+                                  field->compstride, b, b+1, CEED_NOTRANSPOSE,
+                                  lin[i], e); CeedChk(ierr);
+    if (field->emode == CEED_EVAL_NONE)
+      continue;
+    ierr = CeedBasisApplyCore_Ref(field->basis, blksize, CEED_NOTRANSPOSE,
+                                  emode, field->edata, field->qdata);
+    CeedChk(ierr);
   }
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Output Basis Action
+// Output Basis Action and Restriction
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q,
-    CeedQFunctionField *qfoutputfields, CeedOperatorField *opoutputfields,
-    CeedInt blksize, CeedInt numinputfields, CeedInt numoutputfields,
-    CeedOperator op, CeedVector outvec, CeedOperator_Opt *impl,
-    CeedRequest *request) {
+static inline int CeedOperatorOutputBasis_Opt(CeedInt b, CeedInt blksize,
+    CeedScalar **lout, CeedOperator_Opt *impl) {
   CeedInt ierr;
-  CeedElemRestriction Erestrict;
-  CeedEvalMode emode;
-  CeedBasis basis;
-  CeedVector vec;
 
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    // Get elemsize, emode, size
-    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
-    CeedChk(ierr);
-    // Basis action
-    switch(emode) {
-    case CEED_EVAL_NONE:
-      break; // No action
-    case CEED_EVAL_INTERP:
-      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, blksize, CEED_TRANSPOSE,
-                            CEED_EVAL_INTERP, impl->qvecsout[i],
-                            impl->evecsout[i]); CeedChk(ierr);
-      break;
-    case CEED_EVAL_GRAD:
-      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
+  for (CeedInt i=0; i<impl->numeout; i++) {
+    const CeedOperatorFieldPlan_Opt *field = &impl->planout[i];
+    // Rounded at the QFunction, single precision through the restriction
+    if (field->basisfp32) {
+      const CeedInt qentries = blksize*field->size*impl->numqpts;
+      CeedPragmaSIMD
+      for (CeedInt j=0; j<qentries; j++)
+        field->qdatafp32[j] = field->qdata[j];
+      ierr = CeedBasisApplyFP32_Opt(field->basisfp32, blksize, CEED_TRANSPOSE,
+                                    field->emode, impl->workfp32,
+                                    field->qdatafp32, field->edatafp32);
       CeedChk(ierr);
-      ierr = CeedBasisApply(basis, blksize, CEED_TRANSPOSE,
-                            CEED_EVAL_GRAD, impl->qvecsout[i],
-                            impl->evecsout[i]); CeedChk(ierr);
-      break;
-    // LCOV_EXCL_START
-    case CEED_EVAL_WEIGHT: {
-      Ceed ceed;
-      ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-      return CeedError(ceed, 1, "CEED_EVAL_WEIGHT cannot be an output "
-                       "evaluation mode");
-    }
-    case CEED_EVAL_DIV:
-    case CEED_EVAL_CURL: {
-      Ceed ceed;
-      ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-      return CeedError(ceed, 1, "Ceed evaluation mode not implemented");
-      // LCOV_EXCL_STOP
+      ierr = CeedElemRestrictionApplyTransposeFP32_Opt(field->rstr,
+             field->ncomp, blksize, field->compstride, b, field->edatafp32,
+             lout[i]); CeedChk(ierr);
+      continue;
     }
+    // Basis action
+    if (field->emode != CEED_EVAL_NONE) {
+      ierr = CeedBasisApplyCore_Ref(field->basis, blksize, CEED_TRANSPOSE,
+                                    field->emode, field->qdata, field->edata);
+      CeedChk(ierr);
     }
     // Restrict output block
-    // Get output vector
-    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
-    if (vec == CEED_VECTOR_ACTIVE)
-      vec = outvec;
-    // Restrict
-    ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i+impl->numein],
-                                         e/blksize, CEED_TRANSPOSE,
-                                         impl->evecsout[i], vec, request);
-    CeedChk(ierr);
+    ierr = field->rstrimpl->Apply(field->rstr, field->ncomp, blksize,
+                                  field->compstride, b, b+1, CEED_TRANSPOSE,
+                                  field->edata, lout[i]); CeedChk(ierr);
   }
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Restore Input Vectors
+// Chebyshev Smoother Update
 //------------------------------------------------------------------------------
-static inline int CeedOperatorRestoreInputs_Opt(CeedInt numinputfields,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
-    CeedOperator_Opt *impl) {
-  CeedInt ierr;
-  CeedEvalMode emode;
+typedef struct {
+  const CeedInt *start, *nodes; /// Entries completed by each block, or NULL
+  CeedScalar c1, c2;            /// Recurrence coefficients
+  const CeedScalar *rin, *dinv;
+  CeedScalar *r, *d, *x, *z;
+} CeedChebyshevStep_Opt;
 
-  for (CeedInt i=0; i<numinputfields; i++) {
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-    CeedChk(ierr);
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
-    } else {
-      ierr = CeedVectorRestoreArrayRead(impl->evecs[i],
-                                        (const CeedScalar **) &impl->edata[i]);
+// r = rin - z, d = c1 d + c2 D^{-1} r, x += d, and z reset, for the entries
+//   numbered start to stop in the node list, or all entries without one
+static inline void CeedChebyshevUpdate_Opt(const CeedChebyshevStep_Opt *step,
+    CeedSize start, CeedSize stop) {
+  for (CeedSize k=start; k<stop; k++) {
+    const CeedSize i = step->nodes ? step->nodes[k] : k;
+    step->r[i] = step->rin[i] - step->z[i];
+    step->z[i] = 0.0;
+    step->d[i] = step->c1*step->d[i] + step->c2*step->dinv[i]*step->r[i];
+    step->x[i] += step->d[i];
+  }
+}
+
+//------------------------------------------------------------------------------
+// Apply Element Blocks
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyBlocks_Opt(CeedOperator_Opt *impl, CeedInt nblks,
+                                       CeedQFunctionUser f, void *ctxdata,
+                                       const CeedScalar **lin,
+                                       CeedScalar **lout,
+                                       const CeedChebyshevStep_Opt *step) {
+  int ierr;
+  const CeedInt blksize = impl->blksize;
+
+  for (CeedInt b=0; b<nblks; b++) {
+    // Input restriction and basis apply
+    ierr = CeedOperatorInputBasis_Opt(b, blksize, lin, impl); CeedChk(ierr);
+
+    // Q function
+    if (!impl->identityqf) {
+      ierr = f(ctxdata, impl->numqpts*blksize, impl->qin, impl->qout);
       CeedChk(ierr);
     }
+
+    // Output basis apply and restrict
+    ierr = CeedOperatorOutputBasis_Opt(b, blksize, lout, impl); CeedChk(ierr);
+
+    // Smoother update of the entries no later block touches
+    if (step && step->start)
+      CeedChebyshevUpdate_Opt(step, step->start[b], step->start[b+1]);
   }
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Apply Elements
+//------------------------------------------------------------------------------
+// The scratch arrays in impl are those of the operator or of one of its
+//   CeedOperatorWorkspaces
+static int CeedOperatorApplyAddElements_Opt(CeedOperator op,
+    CeedOperator_Opt *impl, CeedVector invec, CeedVector outvec) {
+  int ierr;
+  const CeedInt blksize = impl->blksize;
+  CeedInt numelements;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  const CeedInt nblks = (numelements/blksize) + !!(numelements%blksize);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+
+  // L-vector arrays and QFunction context, once for all element blocks
+  const CeedScalar *lin[16];
+  CeedScalar *lout[16];
+  ierr = CeedOperatorGetLArrays_Opt(impl, invec, outvec, lin, lout);
+  CeedChk(ierr);
+  CeedQFunctionUser f = NULL;
+  ierr = CeedQFunctionGetUserFunction(qf, &f); CeedChk(ierr);
+  CeedQFunctionContext ctx;
+  ierr = CeedQFunctionGetContext(qf, &ctx); CeedChk(ierr);
+  void *ctxdata = NULL;
+  if (ctx) {
+    ierr = CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, &ctxdata);
+    CeedChk(ierr);
+  }
+
+  // Loop through element blocks
+  ierr = CeedOperatorApplyBlocks_Opt(impl, nblks, f, ctxdata, lin, lout,
+                                     NULL); CeedChk(ierr);
+
+  if (ctx) {
+    ierr = CeedQFunctionContextRestoreDataRead(ctx, &ctxdata); CeedChk(ierr);
+  }
+  ierr = CeedOperatorRestoreLArrays_Opt(impl, invec, outvec, lin, lout);
+  CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Operator Apply
 //------------------------------------------------------------------------------
 static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector invec,
                                     CeedVector outvec, CeedRequest *request) {
   int ierr;
-  Ceed ceed;
-  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  Ceed_Opt *ceedimpl;
-  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
-  CeedInt blksize = ceedimpl->blksize;
   CeedOperator_Opt *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
-  CeedInt Q, numinputfields, numoutputfields, numelements;
-  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
-  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
-  CeedInt nblks = (numelements/blksize) + !!(numelements%blksize);
-  CeedQFunction qf;
-  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
-  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
-  CeedChk(ierr);
+
+  // Setup
+  ierr = CeedOperatorSetup_Opt(op); CeedChk(ierr);
+  ierr = CeedOperatorPackPassive_Opt(op, impl, impl); CeedChk(ierr);
+
+  return CeedOperatorApplyAddElements_Opt(op, impl, invec, outvec);
+}
+
+//------------------------------------------------------------------------------
+// Workspace Create
+//------------------------------------------------------------------------------
+// The workspace shares the blocked restrictions, single precision bases, and
+//   packed passive inputs of the operator; its copy of the execution plan
+//   points at its own E-vectors and Q-vectors
+static int CeedOperatorWorkspaceCreate_Opt(CeedOperator op,
+    CeedOperatorWorkspace ws) {
+  int ierr;
+  CeedOperator_Opt *impl, *wsimpl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  ierr = CeedCalloc(1, &wsimpl); CeedChk(ierr);
+  ierr = CeedOperatorWorkspaceSetData(ws, wsimpl); CeedChk(ierr);
+  wsimpl->identityqf = impl->identityqf;
+  wsimpl->blksize = impl->blksize;
+  wsimpl->numqpts = impl->numqpts;
+  wsimpl->blkrestr = impl->blkrestr;
+  wsimpl->passiveprecision = impl->passiveprecision;
+
+  ierr = CeedCalloc(impl->numein, &wsimpl->planin); CeedChk(ierr);
+  ierr = CeedCalloc(impl->numeout, &wsimpl->planout); CeedChk(ierr);
+  wsimpl->numein = impl->numein; wsimpl->numeout = impl->numeout;
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    CeedOperatorFieldPlan_Opt *field = i < impl->numein ? &wsimpl->planin[i] :
+                                       &wsimpl->planout[i-impl->numein];
+    *field = i < impl->numein ? impl->planin[i] :
+             impl->planout[i-impl->numein];
+    field->edata = field->qdata = NULL;
+    field->qvecfused = NULL;
+    field->edatafp32 = field->qdatafp32 = NULL;
+  }
+  ierr = CeedOperatorSetupScratch_Opt(op, wsimpl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Workspace Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorWorkspaceApplyAdd_Opt(CeedOperatorWorkspace ws,
+    CeedVector invec, CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  CeedOperator op;
+  ierr = CeedOperatorWorkspaceGetOperator(ws, &op); CeedChk(ierr);
+  CeedOperator_Opt *impl, *wsimpl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  ierr = CeedOperatorWorkspaceGetData(ws, &wsimpl); CeedChk(ierr);
+
+  ierr = CeedOperatorPackPassive_Opt(op, impl, wsimpl); CeedChk(ierr);
+
+  return CeedOperatorApplyAddElements_Opt(op, wsimpl, invec, outvec);
+}
+
+//------------------------------------------------------------------------------
+// Workspace Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorWorkspaceDestroy_Opt(CeedOperatorWorkspace ws) {
+  int ierr;
+  CeedOperator_Opt *wsimpl;
+  ierr = CeedOperatorWorkspaceGetData(ws, &wsimpl); CeedChk(ierr);
+
+  ierr = CeedOperatorDestroyScratch_Opt(wsimpl); CeedChk(ierr);
+  ierr = CeedFree(&wsimpl->planin); CeedChk(ierr);
+  ierr = CeedFree(&wsimpl->planout); CeedChk(ierr);
+  ierr = CeedFree(&wsimpl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Chebyshev Smoother Node Lists
+//------------------------------------------------------------------------------
+// L-vector entries grouped by the last element block touching them, which
+//   both reads the entry of the operator input and completes the entry of
+//   the output. This requires all active fields to share one offset
+//   restriction; otherwise no lists are made and all entries are updated
+//   after the last block.
+static int CeedOperatorSetupChebyshev_Opt(CeedOperator op,
+    CeedOperator_Opt *impl, CeedSize lsize) {
+  int ierr;
+  if (impl->chebsetup) return 0;
+  impl->chebsetup = true;
+
+  // Active fields and their shared restriction
   CeedOperatorField *opinputfields, *opoutputfields;
   ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
   CeedChk(ierr);
-  CeedQFunctionField *qfinputfields, *qfoutputfields;
-  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
-  CeedChk(ierr);
-  CeedEvalMode emode;
+  CeedElemRestriction rstr = NULL;
+  const CeedOperatorFieldPlan_Opt *plan = NULL;
+  bool shared = true;
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    CeedOperatorField opfield = i < impl->numein ? opinputfields[i] :
+                                opoutputfields[i-impl->numein];
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opfield, &vec); CeedChk(ierr);
+    if (vec != CEED_VECTOR_ACTIVE)
+      continue;
+    CeedElemRestriction fieldrstr;
+    ierr = CeedOperatorFieldGetElemRestriction(opfield, &fieldrstr);
+    CeedChk(ierr);
+    if (!rstr) {
+      rstr = fieldrstr;
+      plan = i < impl->numein ? &impl->planin[i] :
+             &impl->planout[i-impl->numein];
+    }
+    shared = shared && fieldrstr == rstr;
+  }
+  if (!shared || !rstr || !plan->rstrimpl->offsets)
+    return 0;
+  CeedSize rstrlsize;
+  ierr = CeedElemRestrictionGetLVectorSize(rstr, &rstrlsize); CeedChk(ierr);
+  if (rstrlsize != lsize || lsize > INT32_MAX)
+    return 0;
+
+  // Last block touching each entry, offset restrictions address CeedInt
+  const CeedInt blksize = impl->blksize, ncomp = plan->ncomp,
+                compstride = plan->compstride, n = lsize;
+  CeedInt nelem, elemsize;
+  ierr = CeedElemRestrictionGetNumElements(rstr, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstr, &elemsize); CeedChk(ierr);
+  const CeedInt nblks = (nelem/blksize) + !!(nelem%blksize);
+  const CeedInt *offsets = plan->rstrimpl->offsets;
+  CeedInt *last;
+  ierr = CeedMalloc(n, &last); CeedChk(ierr);
+  for (CeedInt i=0; i<n; i++)
+    last[i] = 0;
+  for (CeedInt b=0; b<nblks; b++) {
+    const CeedInt nactive = CeedIntMin(blksize, nelem - b*blksize);
+    for (CeedInt k=0; k<ncomp; k++)
+      for (CeedInt node=0; node<elemsize; node++)
+        for (CeedInt j=0; j<nactive; j++)
+          last[offsets[(b*elemsize + node)*blksize + j] + k*compstride] = b;
+  }
+
+  // Entries sorted by that block, untouched entries with the first block
+  ierr = CeedCalloc(nblks+1, &impl->chebstart); CeedChk(ierr);
+  ierr = CeedMalloc(n, &impl->chebnodes); CeedChk(ierr);
+  for (CeedInt i=0; i<n; i++)
+    impl->chebstart[last[i]+1]++;
+  for (CeedInt b=0; b<nblks; b++)
+    impl->chebstart[b+1] += impl->chebstart[b];
+  CeedInt *pos;
+  ierr = CeedMalloc(nblks, &pos); CeedChk(ierr);
+  for (CeedInt b=0; b<nblks; b++)
+    pos[b] = impl->chebstart[b];
+  for (CeedInt i=0; i<n; i++)
+    impl->chebnodes[pos[last[i]]++] = i;
+  ierr = CeedFree(&pos); CeedChk(ierr);
+  ierr = CeedFree(&last); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Chebyshev Smoother Step
+//------------------------------------------------------------------------------
+// r = rin - A u, d = c1 d + c2 D^{-1} r, and x += d, with u either x or d and
+//   rin either distinct or r. A u accumulates in z, which is zero on entry,
+//   and each entry is updated and z reset right after the output restriction
+//   of the last block touching it, while it is still in cache.
+static int CeedOperatorApplyChebyshevStep_Opt(CeedOperator op, CeedVector u,
+    CeedVector rin, CeedVector dinv, CeedScalar c1, CeedScalar c2,
+    CeedVector r, CeedVector d, CeedVector x, CeedVector z,
+    CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  if (u != x && u != d)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Chebyshev step input must be x or d");
+  // LCOV_EXCL_STOP
 
   // Setup
   ierr = CeedOperatorSetup_Opt(op); CeedChk(ierr);
+  ierr = CeedOperatorPackPassive_Opt(op, impl, impl); CeedChk(ierr);
+  CeedSize lsize;
+  ierr = CeedVectorGetLength(x, &lsize); CeedChk(ierr);
+  ierr = CeedOperatorSetupChebyshev_Opt(op, impl, lsize); CeedChk(ierr);
+  const CeedInt blksize = impl->blksize;
+  CeedInt numelements;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  const CeedInt nblks = (numelements/blksize) + !!(numelements%blksize);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
 
-  // Input Evecs and Restriction
-  ierr = CeedOperatorSetupInputs_Opt(numinputfields, qfinputfields,
-                                     opinputfields, invec, impl, request);
-  CeedChk(ierr);
+  // Smoother vector arrays, with z the active output
+  CeedChebyshevStep_Opt step = {.start = impl->chebstart,
+                                .nodes = impl->chebnodes, .c1 = c1, .c2 = c2
+                               };
+  const CeedScalar *lin[16];
+  CeedScalar *lout[16];
+  ierr = CeedOperatorGetLArrays_Opt(impl, NULL, z, lin, lout); CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numeout; i++)
+    if (impl->planout[i].vec == CEED_VECTOR_ACTIVE)
+      step.z = lout[i];
+  ierr = CeedVectorGetArray(x, CEED_MEM_HOST, &step.x); CeedChk(ierr);
+  ierr = CeedVectorGetArray(d, CEED_MEM_HOST, &step.d); CeedChk(ierr);
+  ierr = CeedVectorGetArray(r, CEED_MEM_HOST, &step.r); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(dinv, CEED_MEM_HOST, &step.dinv); CeedChk(ierr);
+  if (rin == r) {
+    step.rin = step.r;
+  } else {
+    ierr = CeedVectorGetArrayRead(rin, CEED_MEM_HOST, &step.rin); CeedChk(ierr);
+  }
 
-  // Output Lvecs, Evecs, and Qvecs
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    // Set Qvec if needed
-    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+  // The active inputs read u, which the update overwrites only once no
+  //   later block reads it
+  for (CeedInt i=0; i<impl->numein; i++) {
+    const CeedOperatorFieldPlan_Opt *field = &impl->planin[i];
+    if (field->vec == CEED_VECTOR_ACTIVE && field->rstr && !field->fused)
+      lin[i] = u == x ? step.x : step.d;
+  }
+
+  // QFunction context
+  CeedQFunctionUser f = NULL;
+  ierr = CeedQFunctionGetUserFunction(qf, &f); CeedChk(ierr);
+  CeedQFunctionContext ctx;
+  ierr = CeedQFunctionGetContext(qf, &ctx); CeedChk(ierr);
+  void *ctxdata = NULL;
+  if (ctx) {
+    ierr = CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, &ctxdata);
     CeedChk(ierr);
-    if (emode == CEED_EVAL_NONE) {
-      // Set qvec to single block evec
-      ierr = CeedVectorGetArray(impl->evecsout[i], CEED_MEM_HOST,
-                                &impl->edata[i + numinputfields]);
-      CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->qvecsout[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                impl->edata[i + numinputfields]); CeedChk(ierr);
-      ierr = CeedVectorRestoreArray(impl->evecsout[i],
-                                    &impl->edata[i + numinputfields]);
-      CeedChk(ierr);
-    }
   }
 
-  // Loop through elements
-  for (CeedInt e=0; e<nblks*blksize; e+=blksize) {
-    // Input basis apply
-    ierr = CeedOperatorInputBasis_Opt(e, Q, qfinputfields, opinputfields,
-                                      numinputfields, blksize, invec, false,
-                                      impl, request); CeedChk(ierr);
+  // Loop through element blocks, updating completed entries after each
+  ierr = CeedOperatorApplyBlocks_Opt(impl, nblks, f, ctxdata, lin, lout,
+                                     &step); CeedChk(ierr);
+  if (!step.start)
+    CeedChebyshevUpdate_Opt(&step, 0, lsize);
 
-    // Q function
-    if (!impl->identityqf) {
-      ierr = CeedQFunctionApply(qf, Q*blksize, impl->qvecsin, impl->qvecsout);
+  // Cleanup
+  if (ctx) {
+    ierr = CeedQFunctionContextRestoreDataRead(ctx, &ctxdata); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<impl->numein; i++)
+    if (impl->planin[i].vec == CEED_VECTOR_ACTIVE)
+      lin[i] = NULL;
+  ierr = CeedOperatorRestoreLArrays_Opt(impl, NULL, z, lin, lout);
+  CeedChk(ierr);
+  if (rin != r) {
+    ierr = CeedVectorRestoreArrayRead(rin, &step.rin); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArrayRead(dinv, &step.dinv); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(r, &step.r); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(d, &step.d); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(x, &step.x); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Time Operator Application for Block Size
+//------------------------------------------------------------------------------
+// Seconds per element to apply the operator to its first elements in blocks
+//   of blksize elements, writing to scratch outputs
+int CeedOperatorTimeBlockSize_Opt(CeedOperator op, CeedInt blksize,
+                                  double *time) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  impl->blksize = blksize;
+  ierr = CeedOperatorSetupBlocks_Opt(op, impl); CeedChk(ierr);
+  ierr = CeedOperatorPackPassive_Opt(op, impl, impl); CeedChk(ierr);
+  CeedInt numelements;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  if (numelements > CEED_OPT_TUNE_ELEMENTS)
+    numelements = CEED_OPT_TUNE_ELEMENTS;
+  const CeedInt nblks = (numelements/blksize) + !!(numelements%blksize);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+
+  // Active input of ones and zeroed scratch L-vector arrays for the outputs
+  CeedVector invec = NULL;
+  for (CeedInt i=0; i<impl->numein && !invec; i++)
+    if (impl->planin[i].vec == CEED_VECTOR_ACTIVE && impl->planin[i].rstr) {
+      CeedSize lsize;
+      ierr = CeedElemRestrictionGetLVectorSize(impl->planin[i].rstr, &lsize);
       CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, lsize, &invec); CeedChk(ierr);
+      ierr = CeedVectorSetValue(invec, 1.0); CeedChk(ierr);
     }
-
-    // Output basis apply and restrict
-    ierr = CeedOperatorOutputBasis_Opt(e, Q, qfoutputfields, opoutputfields,
-                                       blksize, numinputfields, numoutputfields,
-                                       op, outvec, impl, request);
+  const CeedScalar *lin[16];
+  CeedScalar *lout[16];
+  ierr = CeedOperatorGetLArrays_Opt(impl, invec, NULL, lin, NULL);
+  CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numeout; i++) {
+    CeedSize lsize;
+    ierr = CeedElemRestrictionGetLVectorSize(impl->planout[i].rstr, &lsize);
+    CeedChk(ierr);
+    ierr = CeedCalloc(lsize, &lout[i]); CeedChk(ierr);
+  }
+  CeedQFunctionUser f = NULL;
+  ierr = CeedQFunctionGetUserFunction(qf, &f); CeedChk(ierr);
+  CeedQFunctionContext ctx;
+  ierr = CeedQFunctionGetContext(qf, &ctx); CeedChk(ierr);
+  void *ctxdata = NULL;
+  if (ctx) {
+    ierr = CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, &ctxdata);
     CeedChk(ierr);
   }
 
-  // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Opt(numinputfields, qfinputfields,
-                                       opinputfields, impl);
-  CeedChk(ierr);
+  // Best of several runs of the element loop
+  *time = -1;
+  for (CeedInt rep=0; rep<CEED_OPT_TUNE_REPS; rep++) {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ierr = CeedOperatorApplyBlocks_Opt(impl, nblks, f, ctxdata, lin, lout,
+                                       NULL); CeedChk(ierr);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double elapsed = (end.tv_sec - start.tv_sec) +
+                     1e-9*(end.tv_nsec - start.tv_nsec);
+    if (*time < 0 || elapsed < *time)
+      *time = elapsed;
+  }
+  *time /= nblks*blksize;
 
+  // Cleanup, the operator is set up again with the chosen block size
+  if (ctx) {
+    ierr = CeedQFunctionContextRestoreDataRead(ctx, &ctxdata); CeedChk(ierr);
+  }
+  ierr = CeedOperatorRestoreLArrays_Opt(impl, invec, NULL, lin, NULL);
+  CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numeout; i++) {
+    ierr = CeedFree(&lout[i]); CeedChk(ierr);
+  }
+  ierr = CeedVectorDestroy(&invec); CeedChk(ierr);
+  ierr = CeedOperatorDestroyBlocks_Opt(impl); CeedChk(ierr);
   return 0;
 }
 
@@ -533,32 +1249,24 @@ static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op,
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  Ceed_Opt *ceedimpl;
-  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
-  const CeedInt blksize = ceedimpl->blksize;
   CeedOperator_Opt *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
-  CeedInt Q, numinputfields, numoutputfields, numelements, size;
+
+  // Setup
+  ierr = CeedOperatorSetup_Opt(op); CeedChk(ierr);
+  ierr = CeedOperatorPackPassive_Opt(op, impl, impl); CeedChk(ierr);
+  const CeedInt blksize = impl->blksize;
+  CeedInt Q, numelements;
   ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
   ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
   CeedInt nblks = (numelements/blksize) + !!(numelements%blksize);
   CeedQFunction qf;
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
-  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
-  CeedChk(ierr);
-  CeedOperatorField *opinputfields, *opoutputfields;
-  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
-  CeedChk(ierr);
-  CeedQFunctionField *qfinputfields, *qfoutputfields;
-  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
-  CeedChk(ierr);
-  CeedVector vec, lvec;
+  const CeedInt numinputfields = impl->numein, numoutputfields = impl->numeout;
+  CeedVector lvec;
   CeedInt numactivein = 0, numactiveout = 0;
-  CeedVector *activein = NULL;
-  CeedScalar *a, *tmp;
-
-  // Setup
-  ierr = CeedOperatorSetup_Opt(op); CeedChk(ierr);
+  CeedScalar **activein = NULL;
+  CeedScalar *a;
 
   // Check for identity
   if (impl->identityqf)
@@ -566,43 +1274,25 @@ static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op,
     return CeedError(ceed, 1, "Assembling identity qfunctions not supported");
   // LCOV_EXCL_STOP
 
-  // Input Evecs and Restriction
-  ierr = CeedOperatorSetupInputs_Opt(numinputfields, qfinputfields,
-                                     opinputfields, NULL, impl, request);
-  CeedChk(ierr);
-
   // Count number of active input fields
   for (CeedInt i=0; i<numinputfields; i++) {
-    // Get input vector
-    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    const CeedOperatorFieldPlan_Opt *field = &impl->planin[i];
     // Check if active input
-    if (vec == CEED_VECTOR_ACTIVE) {
-      ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
-      ierr = CeedVectorSetValue(impl->qvecsin[i], 0.0); CeedChk(ierr);
-      ierr = CeedVectorGetArray(impl->qvecsin[i], CEED_MEM_HOST, &tmp);
-      CeedChk(ierr);
-      ierr = CeedRealloc(numactivein + size, &activein); CeedChk(ierr);
-      for (CeedInt field=0; field<size; field++) {
-        ierr = CeedVectorCreate(ceed, Q*blksize, &activein[numactivein+field]);
-        CeedChk(ierr);
-        ierr = CeedVectorSetArray(activein[numactivein+field], CEED_MEM_HOST,
-                                  CEED_USE_POINTER, &tmp[field*Q*blksize]);
-        CeedChk(ierr);
-      }
-      numactivein += size;
-      ierr = CeedVectorRestoreArray(impl->qvecsin[i], &tmp); CeedChk(ierr);
+    if (field->vec == CEED_VECTOR_ACTIVE) {
+      ierr = CeedRealloc(numactivein + field->size, &activein); CeedChk(ierr);
+      for (CeedInt j=0; j<field->size; j++)
+        activein[numactivein+j] = &field->qdata[j*Q*blksize];
+      for (CeedInt j=0; j<field->size*Q*blksize; j++)
+        field->qdata[j] = 0.0;
+      numactivein += field->size;
     }
   }
 
   // Count number of active output fields
   for (CeedInt i=0; i<numoutputfields; i++) {
-    // Get output vector
-    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
     // Check if active output
-    if (vec == CEED_VECTOR_ACTIVE) {
-      ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size); CeedChk(ierr);
-      numactiveout += size;
-    }
+    if (impl->planout[i].vec == CEED_VECTOR_ACTIVE)
+      numactiveout += impl->planout[i].size;
   }
 
   // Check sizes
@@ -620,63 +1310,62 @@ static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op,
   // Create output restriction
   CeedInt strides[3] = {1, Q, numactivein *numactiveout*Q};
   ierr = CeedElemRestrictionCreateStrided(ceed, numelements, Q,
-                                          numactivein*numactiveout,
-                                          numactivein*numactiveout*numelements*Q,
-                                          strides, rstr); CeedChk(ierr);
+         numactivein*numactiveout,
+         (CeedSize)numactivein*numactiveout*numelements*Q,
+         strides, rstr); CeedChk(ierr);
   // Create assembled vector
-  ierr = CeedVectorCreate(ceed, numelements*Q*numactivein*numactiveout,
+  ierr = CeedVectorCreate(ceed,
+                          (CeedSize)numelements*Q*numactivein*numactiveout,
                           assembled); CeedChk(ierr);
 
-  // Loop through elements
-  for (CeedInt e=0; e<nblks*blksize; e+=blksize) {
-    // Input basis apply
-    ierr = CeedOperatorInputBasis_Opt(e, Q, qfinputfields, opinputfields,
-                                      numinputfields, blksize, NULL, true,
-                                      impl, request); CeedChk(ierr);
+  // Passive input arrays and QFunction context
+  const CeedScalar *lin[16];
+  ierr = CeedOperatorGetLArrays_Opt(impl, NULL, NULL, lin, NULL); CeedChk(ierr);
+  CeedQFunctionUser f = NULL;
+  ierr = CeedQFunctionGetUserFunction(qf, &f); CeedChk(ierr);
+  CeedQFunctionContext ctx;
+  ierr = CeedQFunctionGetContext(qf, &ctx); CeedChk(ierr);
+  void *ctxdata = NULL;
+  if (ctx) {
+    ierr = CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, &ctxdata);
+    CeedChk(ierr);
+  }
+  // Active outputs are written straight into the assembled array
+  CeedScalar *qout[16];
+  for (CeedInt out=0; out<numoutputfields; out++)
+    qout[out] = impl->qout[out];
+
+  // Loop through element blocks
+  for (CeedInt b=0; b<nblks; b++) {
+    // Input restriction and basis apply
+    ierr = CeedOperatorInputBasis_Opt(b, blksize, lin, impl); CeedChk(ierr);
 
     // Assemble QFunction
     for (CeedInt in=0; in<numactivein; in++) {
       // Set Inputs
-      ierr = CeedVectorSetValue(activein[in], 1.0); CeedChk(ierr);
-      if (numactivein > 1) {
-        ierr = CeedVectorSetValue(activein[(in+numactivein-1)%numactivein],
-                                  0.0); CeedChk(ierr);
-      }
+      for (CeedInt j=0; j<Q*blksize; j++)
+        activein[in][j] = 1.0;
+      if (numactivein > 1)
+        for (CeedInt j=0; j<Q*blksize; j++)
+          activein[(in+numactivein-1)%numactivein][j] = 0.0;
       // Set Outputs
       for (CeedInt out=0; out<numoutputfields; out++) {
-        // Get output vector
-        ierr = CeedOperatorFieldGetVector(opoutputfields[out], &vec);
-        CeedChk(ierr);
         // Check if active output
-        if (vec == CEED_VECTOR_ACTIVE) {
-          CeedVectorSetArray(impl->qvecsout[out], CEED_MEM_HOST,
-                             CEED_USE_POINTER, a); CeedChk(ierr);
-          ierr = CeedQFunctionFieldGetSize(qfoutputfields[out], &size);
-          CeedChk(ierr);
-          a += size*Q*blksize; // Advance the pointer by the size of the output
+        if (impl->planout[out].vec == CEED_VECTOR_ACTIVE) {
+          qout[out] = a;
+          // Advance the pointer by the size of the output
+          a += impl->planout[out].size*Q*blksize;
         }
       }
       // Apply QFunction
-      ierr = CeedQFunctionApply(qf, Q*blksize, impl->qvecsin, impl->qvecsout);
-      CeedChk(ierr);
+      ierr = f(ctxdata, Q*blksize, impl->qin, qout); CeedChk(ierr);
     }
   }
 
-  // Un-set output Qvecs to prevent accidental overwrite of Assembled
-  for (CeedInt out=0; out<numoutputfields; out++) {
-    // Get output vector
-    ierr = CeedOperatorFieldGetVector(opoutputfields[out], &vec);
-    CeedChk(ierr);
-    // Check if active output
-    if (vec == CEED_VECTOR_ACTIVE) {
-      CeedVectorSetArray(impl->qvecsout[out], CEED_MEM_HOST, CEED_COPY_VALUES,
-                         NULL); CeedChk(ierr);
-    }
+  if (ctx) {
+    ierr = CeedQFunctionContextRestoreDataRead(ctx, &ctxdata); CeedChk(ierr);
   }
-
-  // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Opt(numinputfields, qfinputfields,
-                                       opinputfields, impl);
+  ierr = CeedOperatorRestoreLArrays_Opt(impl, NULL, NULL, lin, NULL);
   CeedChk(ierr);
 
   // Output blocked restriction
@@ -684,15 +1373,13 @@ static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op,
   ierr = CeedVectorSetValue(*assembled, 0.0); CeedChk(ierr);
   CeedElemRestriction blkrstr;
   ierr = CeedElemRestrictionCreateBlockedStrided(ceed, numelements, Q, blksize,
-         numactivein*numactiveout, numactivein*numactiveout*numelements*Q,
+         numactivein*numactiveout,
+         (CeedSize)numactivein*numactiveout*numelements*Q,
          strides, &blkrstr); CeedChk(ierr);
   ierr = CeedElemRestrictionApply(blkrstr, CEED_TRANSPOSE, lvec, *assembled,
                                   request); CeedChk(ierr);
 
   // Cleanup
-  for (CeedInt i=0; i<numactivein; i++) {
-    ierr = CeedVectorDestroy(&activein[i]); CeedChk(ierr);
-  }
   ierr = CeedFree(&activein); CeedChk(ierr);
   ierr = CeedVectorDestroy(&lvec); CeedChk(ierr);
   ierr = CeedElemRestrictionDestroy(&blkrstr); CeedChk(ierr);
@@ -701,36 +1388,64 @@ static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op,
 }
 
 //------------------------------------------------------------------------------
-// Operator Destroy
+// Operator Get Memory Usage
 //------------------------------------------------------------------------------
-static int CeedOperatorDestroy_Opt(CeedOperator op) {
+static int CeedOperatorGetMemoryUsage_Opt(CeedOperator op, CeedSize *bytes) {
   int ierr;
   CeedOperator_Opt *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedSize objbytes;
 
-  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
-    ierr = CeedElemRestrictionDestroy(&impl->blkrestr[i]); CeedChk(ierr);
-    ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
-  }
-  ierr = CeedFree(&impl->blkrestr); CeedChk(ierr);
-  ierr = CeedFree(&impl->evecs); CeedChk(ierr);
-  ierr = CeedFree(&impl->edata); CeedChk(ierr);
-  ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
+  // Nothing is held before setup, or after timing a block size
+  *bytes = 0;
+  if (!impl->planin)
+    return 0;
+  CeedInt numelements;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  const CeedInt nblks = (numelements/impl->blksize) +
+                        !!(numelements%impl->blksize);
 
-  for (CeedInt i=0; i<impl->numein; i++) {
-    ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
-    ierr = CeedVectorDestroy(&impl->qvecsin[i]); CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    CeedOperatorFieldPlan_Opt *field = i < impl->numein ? &impl->planin[i] :
+                                       &impl->planout[i-impl->numein];
+    ierr = CeedElemRestrictionGetMemoryUsage(impl->blkrestr[i], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+    ierr = CeedVectorGetMemoryUsage(i < impl->numein ? impl->evecsin[i] :
+                                    impl->evecsout[i-impl->numein], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+    ierr = CeedVectorGetMemoryUsage(i < impl->numein ? impl->qvecsin[i] :
+                                    impl->qvecsout[i-impl->numein], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+    ierr = CeedVectorGetMemoryUsage(field->qvecfused, &objbytes); CeedChk(ierr);
+    *bytes += objbytes;
+    if (field->basisfp32) {
+      const CeedBasisFP32_Opt *fbasis = field->basisfp32;
+      const CeedInt Q1d = fbasis->Q1d, P1d = fbasis->P1d;
+      *bytes += (Q1d*P1d + Q1d*(fbasis->collograd ? Q1d : P1d))*sizeof(float);
+    }
+    if (field->packed)
+      *bytes += (CeedSize)nblks*impl->blksize*impl->numqpts*field->size*
+                (impl->passiveprecision == CEED_SCALAR_BF16 ?
+                 sizeof(uint16_t) : sizeof(float));
   }
-  ierr = CeedFree(&impl->evecsin); CeedChk(ierr);
-  ierr = CeedFree(&impl->qvecsin); CeedChk(ierr);
+  *bytes += (CeedSize)impl->sizefp32*sizeof(float);
+  if (impl->chebstart)
+    *bytes += (nblks + 1 + impl->chebstart[nblks])*sizeof(CeedInt);
+  return 0;
+}
 
-  for (CeedInt i=0; i<impl->numeout; i++) {
-    ierr = CeedVectorDestroy(&impl->evecsout[i]); CeedChk(ierr);
-    ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
-  }
-  ierr = CeedFree(&impl->evecsout); CeedChk(ierr);
-  ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Opt(CeedOperator op) {
+  int ierr;
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
 
+  ierr = CeedOperatorDestroyBlocks_Opt(impl); CeedChk(ierr);
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
 }
@@ -742,24 +1457,29 @@ int CeedOperatorCreate_Opt(CeedOperator op) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  Ceed_Opt *ceedimpl;
-  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
-  CeedInt blksize = ceedimpl->blksize;
   CeedOperator_Opt *impl;
 
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
   ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
 
-  if (blksize != 1 && blksize != 8)
-    // LCOV_EXCL_START
-    return CeedError(ceed, 1, "Opt backend cannot use blocksize: %d", blksize);
-  // LCOV_EXCL_STOP
-
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction",
                                 CeedOperatorLinearAssembleQFunction_Opt);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Setup",
+                                CeedOperatorSetup_Opt); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Opt); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyChebyshevStep",
+                                CeedOperatorApplyChebyshevStep_Opt);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "GetMemoryUsage",
+                                CeedOperatorGetMemoryUsage_Opt); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceCreate",
+                                CeedOperatorWorkspaceCreate_Opt); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceApplyAdd",
+                                CeedOperatorWorkspaceApplyAdd_Opt); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceDestroy",
+                                CeedOperatorWorkspaceDestroy_Opt); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Opt); CeedChk(ierr);
   return 0;
@@ -0,0 +1,432 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "ceed-opt.h"
+
+// Vectorize the single precision loops with OpenMP SIMD when the build
+//   enables it, as GCC does not vectorize at the default optimization level
+#ifdef CEED_OMP_SIMD
+#  define CeedPragmaSIMDFP32 _Pragma("omp simd")
+#else
+#  define CeedPragmaSIMDFP32 CeedPragmaSIMD
+#endif
+
+//------------------------------------------------------------------------------
+// Single Precision Tensor Contraction
+//------------------------------------------------------------------------------
+// Same layout as CeedTensorContractApply, v_a = t u_a for a J x B matrix t
+//   and B x C blocks u_a; four rows of v_a are updated per pass over u_a
+static inline void CeedTensorContractFP32_Opt(CeedInt A, CeedInt B, CeedInt C,
+    CeedInt J, const float *restrict t, CeedTransposeMode tmode, bool add,
+    const float *restrict u, float *restrict v) {
+  CeedInt tstride0 = B, tstride1 = 1;
+  if (tmode == CEED_TRANSPOSE) {
+    tstride0 = 1; tstride1 = J;
+  }
+
+  if (!add)
+    for (CeedInt q=0; q<A*J*C; q++)
+      v[q] = 0.f;
+
+  for (CeedInt a=0; a<A; a++) {
+    const float *restrict ua = &u[a*B*C];
+    CeedInt j = 0;
+    for (; j+4<=J; j+=4) {
+      float *restrict v0 = &v[(a*J+j)*C], *restrict v1 = v0 + C,
+             *restrict v2 = v1 + C, *restrict v3 = v2 + C;
+      for (CeedInt b=0; b<B; b++) {
+        const float t0 = t[(j+0)*tstride0 + b*tstride1],
+                    t1 = t[(j+1)*tstride0 + b*tstride1],
+                    t2 = t[(j+2)*tstride0 + b*tstride1],
+                    t3 = t[(j+3)*tstride0 + b*tstride1];
+        const float *restrict ub = &ua[b*C];
+        CeedPragmaSIMDFP32
+        for (CeedInt c=0; c<C; c++) {
+          v0[c] += t0 * ub[c];
+          v1[c] += t1 * ub[c];
+          v2[c] += t2 * ub[c];
+          v3[c] += t3 * ub[c];
+        }
+      }
+    }
+    for (; j<J; j++) {
+      float *restrict vj = &v[(a*J+j)*C];
+      for (CeedInt b=0; b<B; b++) {
+        const float tq = t[j*tstride0 + b*tstride1];
+        CeedPragmaSIMDFP32
+        for (CeedInt c=0; c<C; c++)
+          vj[c] += tq * ua[b*C+c];
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Single Precision Interpolation
+//------------------------------------------------------------------------------
+static void CeedBasisInterpFP32_Opt(const CeedBasisFP32_Opt *fbasis,
+                                    CeedInt nelem, CeedTransposeMode tmode,
+                                    float *tmp[2], const float *u, float *v) {
+  const CeedInt dim = fbasis->dim, ncomp = fbasis->ncomp;
+  CeedInt P = fbasis->P1d, Q = fbasis->Q1d;
+  if (fbasis->collointerp) {
+    memcpy(v, u, nelem*ncomp*CeedIntPow(P, dim)*sizeof(u[0]));
+    return;
+  }
+  if (tmode == CEED_TRANSPOSE) {
+    P = fbasis->Q1d; Q = fbasis->P1d;
+  }
+  CeedInt pre = ncomp*CeedIntPow(P, dim-1), post = nelem;
+  for (CeedInt d=0; d<dim; d++) {
+    CeedTensorContractFP32_Opt(pre, P, post, Q, fbasis->interp1d, tmode, false,
+                               d==0?u:tmp[d%2], d==dim-1?v:tmp[(d+1)%2]);
+    pre /= P;
+    post *= Q;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Single Precision Gradient
+//------------------------------------------------------------------------------
+// With a collocated derivative, interp holds the values at the quadrature
+//   points; for CEED_NOTRANSPOSE it may already be filled by the caller
+static void CeedBasisGradFP32_Opt(const CeedBasisFP32_Opt *fbasis,
+                                  CeedInt nelem, CeedTransposeMode tmode,
+                                  bool haveinterp, float *tmp[2],
+                                  float *interp, const float *u, float *v) {
+  const CeedInt dim = fbasis->dim, ncomp = fbasis->ncomp;
+  const CeedInt P1d = fbasis->P1d, Q1d = fbasis->Q1d;
+  const CeedInt nqpt = ncomp*CeedIntPow(Q1d, dim)*nelem;
+  const bool add = tmode == CEED_TRANSPOSE;
+
+  if (fbasis->collograd) {
+    if (tmode == CEED_NOTRANSPOSE) {
+      if (!haveinterp)
+        CeedBasisInterpFP32_Opt(fbasis, nelem, tmode, tmp, u, interp);
+      CeedInt pre = ncomp*CeedIntPow(Q1d, dim-1), post = nelem;
+      for (CeedInt d=0; d<dim; d++) {
+        CeedTensorContractFP32_Opt(pre, Q1d, post, Q1d, fbasis->grad1d, tmode,
+                                   false, interp, v + d*nqpt);
+        pre /= Q1d;
+        post *= Q1d;
+      }
+    } else {
+      CeedInt pre = ncomp*CeedIntPow(Q1d, dim-1), post = nelem;
+      for (CeedInt d=0; d<dim; d++) {
+        CeedTensorContractFP32_Opt(pre, Q1d, post, Q1d, fbasis->grad1d, tmode,
+                                   d>0, u + d*nqpt, interp);
+        pre /= Q1d;
+        post *= Q1d;
+      }
+      CeedBasisInterpFP32_Opt(fbasis, nelem, tmode, tmp, interp, v);
+    }
+  } else if (fbasis->collointerp) {
+    // Dim contractions, identity in other directions
+    CeedInt pre = ncomp*CeedIntPow(P1d, dim-1), post = nelem;
+    for (CeedInt d=0; d<dim; d++) {
+      CeedTensorContractFP32_Opt(pre, P1d, post, P1d, fbasis->grad1d, tmode,
+                                 add&&(d>0), add ? u + d*nqpt : u,
+                                 add ? v : v + d*nqpt);
+      pre /= P1d;
+      post *= P1d;
+    }
+  } else {
+    // Dim**2 contractions, apply grad when p == d
+    CeedInt P = P1d, Q = Q1d;
+    if (tmode == CEED_TRANSPOSE) {
+      P = Q1d; Q = P1d;
+    }
+    for (CeedInt p=0; p<dim; p++) {
+      CeedInt pre = ncomp*CeedIntPow(P, dim-1), post = nelem;
+      for (CeedInt d=0; d<dim; d++) {
+        CeedTensorContractFP32_Opt(pre, P, post, Q,
+                                   p==d ? fbasis->grad1d : fbasis->interp1d,
+                                   tmode, add&&(d==dim-1)&&(p>0),
+                                   d==0 ? (add ? u + p*nqpt : u) : tmp[d%2],
+                                   d==dim-1 ? (add ? v : v + p*nqpt)
+                                   : tmp[(d+1)%2]);
+        pre /= P;
+        post *= Q;
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Single Precision Basis Create
+//------------------------------------------------------------------------------
+int CeedBasisCreateFP32_Opt(CeedBasis basis, CeedBasisFP32_Opt **fbasis) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+  bool tensor;
+  ierr = CeedBasisIsTensor(basis, &tensor); CeedChk(ierr);
+  if (!tensor)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Single precision requires a tensor basis");
+  // LCOV_EXCL_STOP
+
+  CeedBasisFP32_Opt *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedBasisGetDimension(basis, &impl->dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &impl->ncomp); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes1D(basis, &impl->P1d); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints1D(basis, &impl->Q1d); CeedChk(ierr);
+  const CeedInt P1d = impl->P1d, Q1d = impl->Q1d;
+  const CeedScalar *interp1d, *grad1d;
+  ierr = CeedBasisGetInterp1D(basis, &interp1d); CeedChk(ierr);
+  ierr = CeedBasisGetGrad1D(basis, &grad1d); CeedChk(ierr);
+
+  // Check for collocated interp, as in the double precision basis
+  if (Q1d == P1d) {
+    bool collocated = 1;
+    for (CeedInt i=0; i<P1d; i++) {
+      collocated = collocated && (fabs(interp1d[i+P1d*i] - 1.0) < 1e-14);
+      for (CeedInt j=0; j<P1d; j++)
+        if (j != i)
+          collocated = collocated && (fabs(interp1d[j+P1d*i]) < 1e-14);
+    }
+    impl->collointerp = collocated;
+  }
+  impl->collograd = Q1d >= P1d && !impl->collointerp;
+
+  // Round the 1D matrices once
+  ierr = CeedMalloc(Q1d*P1d, &impl->interp1d); CeedChk(ierr);
+  for (CeedInt i=0; i<Q1d*P1d; i++)
+    impl->interp1d[i] = (float)interp1d[i];
+  if (impl->collograd) {
+    CeedScalar *collograd1d;
+    ierr = CeedMalloc(Q1d*Q1d, &collograd1d); CeedChk(ierr);
+    ierr = CeedBasisGetCollocatedGrad(basis, collograd1d); CeedChk(ierr);
+    ierr = CeedMalloc(Q1d*Q1d, &impl->grad1d); CeedChk(ierr);
+    for (CeedInt i=0; i<Q1d*Q1d; i++)
+      impl->grad1d[i] = (float)collograd1d[i];
+    ierr = CeedFree(&collograd1d); CeedChk(ierr);
+  } else {
+    ierr = CeedMalloc(Q1d*P1d, &impl->grad1d); CeedChk(ierr);
+    for (CeedInt i=0; i<Q1d*P1d; i++)
+      impl->grad1d[i] = (float)grad1d[i];
+  }
+
+  *fbasis = impl;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Single Precision Basis Work Size
+//------------------------------------------------------------------------------
+// Two contraction buffers and the interpolated values used by a collocated
+//   gradient
+int CeedBasisGetWorkSizeFP32_Opt(const CeedBasisFP32_Opt *fbasis,
+                                 CeedInt nelem, size_t *size) {
+  const CeedInt dim = fbasis->dim;
+  const CeedInt M = fbasis->P1d > fbasis->Q1d ? fbasis->P1d : fbasis->Q1d;
+  *size = 3*(size_t)nelem*fbasis->ncomp*CeedIntPow(M, dim);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Single Precision Basis Apply
+//------------------------------------------------------------------------------
+// Both the E-vector and the Q-vector are single precision, the operator
+//   converts at the restriction and at the QFunction
+int CeedBasisApplyFP32_Opt(const CeedBasisFP32_Opt *fbasis, CeedInt nelem,
+                           CeedTransposeMode tmode, CeedEvalMode emode,
+                           float *work, const float *u, float *v) {
+  const CeedInt dim = fbasis->dim, ncomp = fbasis->ncomp;
+  const CeedInt M = fbasis->P1d > fbasis->Q1d ? fbasis->P1d : fbasis->Q1d;
+  const size_t block = (size_t)nelem*ncomp*CeedIntPow(M, dim);
+  const CeedInt nqpt = nelem*ncomp*CeedIntPow(fbasis->Q1d, dim);
+  const bool interp = emode & CEED_EVAL_INTERP, grad = emode & CEED_EVAL_GRAD;
+  float *tmp[2] = {work, work + block}, *interpf = work + 2*block;
+
+  // Interpolated values followed by gradients, as for a fused CeedBasisApply
+  if (interp && grad) {
+    CeedBasisInterpFP32_Opt(fbasis, nelem, tmode, tmp, u, v);
+    CeedBasisGradFP32_Opt(fbasis, nelem, tmode, fbasis->collograd, tmp, v, u,
+                          v + nqpt);
+  } else if (interp) {
+    CeedBasisInterpFP32_Opt(fbasis, nelem, tmode, tmp, u, v);
+  } else {
+    CeedBasisGradFP32_Opt(fbasis, nelem, tmode, false, tmp, interpf, u, v);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Single Precision Basis Destroy
+//------------------------------------------------------------------------------
+int CeedBasisDestroyFP32_Opt(CeedBasisFP32_Opt **fbasis) {
+  int ierr;
+  if (!*fbasis)
+    return 0;
+  ierr = CeedFree(&(*fbasis)->interp1d); CeedChk(ierr);
+  ierr = CeedFree(&(*fbasis)->grad1d); CeedChk(ierr);
+  ierr = CeedFree(fbasis); CeedChk(ierr);
+  return 0;
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Single Precision Restriction
+//------------------------------------------------------------------------------
+// CPU backend strides are {1, elemsize, elemsize*ncomp}
+static int CeedElemRestrictionGetStridesFP32_Opt(CeedElemRestriction r,
+    CeedInt ncomp, CeedInt elemsize, CeedInt (*strides)[3]) {
+  int ierr;
+  bool backendstrides;
+  ierr = CeedElemRestrictionHasBackendStrides(r, &backendstrides);
+  CeedChk(ierr);
+  if (backendstrides) {
+    (*strides)[0] = 1;
+    (*strides)[1] = elemsize;
+    (*strides)[2] = elemsize*ncomp;
+  } else {
+    ierr = CeedElemRestrictionGetStrides(r, strides); CeedChk(ierr);
+  }
+  return 0;
+}
+
+// Block b of a blocked restriction, gathered from the double precision
+//   L-vector straight into a single precision E-vector
+int CeedElemRestrictionApplyFP32_Opt(CeedElemRestriction r, CeedInt ncomp,
+                                     CeedInt blksize, CeedInt compstride,
+                                     CeedInt b, const CeedScalar *u, float *v) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  CeedInt nelem, elemsize;
+  ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  const CeedInt e = b*blksize;
+
+  if (impl->offsets) {
+    const CeedInt *offsets = &impl->offsets[e*elemsize];
+    for (CeedInt k=0; k<ncomp; k++)
+      CeedPragmaSIMDFP32
+      for (CeedInt i=0; i<elemsize*blksize; i++)
+        v[k*elemsize*blksize + i] = u[offsets[i] + (CeedSize)k*compstride];
+  } else if (impl->offsets64) {
+    const CeedSize *offsets = &impl->offsets64[(CeedSize)e*elemsize];
+    for (CeedInt k=0; k<ncomp; k++)
+      CeedPragmaSIMDFP32
+      for (CeedInt i=0; i<elemsize*blksize; i++)
+        v[k*elemsize*blksize + i] = u[offsets[i] + (CeedSize)k*compstride];
+  } else {
+    CeedInt strides[3];
+    ierr = CeedElemRestrictionGetStridesFP32_Opt(r, ncomp, elemsize, &strides);
+    CeedChk(ierr);
+    for (CeedInt k=0; k<ncomp; k++)
+      for (CeedInt n=0; n<elemsize; n++)
+        CeedPragmaSIMDFP32
+        for (CeedInt j=0; j<blksize; j++)
+          v[(k*elemsize + n)*blksize + j] =
+            u[n*strides[0] + k*strides[1] +
+              (CeedSize)CeedIntMin(e+j, nelem-1)*strides[2]];
+  }
+  return 0;
+}
+
+// Block b of a single precision E-vector added into the double precision
+//   L-vector, skipping the padding elements of the last block
+int CeedElemRestrictionApplyTransposeFP32_Opt(CeedElemRestriction r,
+    CeedInt ncomp, CeedInt blksize, CeedInt compstride, CeedInt b,
+    const float *u, CeedScalar *v) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  CeedInt nelem, elemsize;
+  ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  const CeedInt e = b*blksize, nactive = CeedIntMin(blksize, nelem-e);
+
+  if (impl->offsets) {
+    const CeedInt *offsets = &impl->offsets[e*elemsize];
+    for (CeedInt k=0; k<ncomp; k++)
+      for (CeedInt i=0; i<elemsize*blksize; i+=blksize)
+        for (CeedInt j=i; j<i+nactive; j++)
+          v[offsets[j] + (CeedSize)k*compstride] += u[k*elemsize*blksize + j];
+  } else if (impl->offsets64) {
+    const CeedSize *offsets = &impl->offsets64[(CeedSize)e*elemsize];
+    for (CeedInt k=0; k<ncomp; k++)
+      for (CeedInt i=0; i<elemsize*blksize; i+=blksize)
+        for (CeedInt j=i; j<i+nactive; j++)
+          v[offsets[j] + (CeedSize)k*compstride] += u[k*elemsize*blksize + j];
+  } else {
+    CeedInt strides[3];
+    ierr = CeedElemRestrictionGetStridesFP32_Opt(r, ncomp, elemsize, &strides);
+    CeedChk(ierr);
+    for (CeedInt k=0; k<ncomp; k++)
+      for (CeedInt n=0; n<elemsize; n++)
+        for (CeedInt j=0; j<nactive; j++)
+          v[n*strides[0] + k*strides[1] + (CeedSize)(e+j)*strides[2]] +=
+            u[(k*elemsize + n)*blksize + j];
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Reduced Precision Storage
+//------------------------------------------------------------------------------
+// bfloat16 keeps the upper half of the single precision bit pattern, rounded
+//   to nearest even; NaNs stay quiet NaNs
+int CeedScalarPack_Opt(CeedScalarType type, CeedInt n, const CeedScalar *x,
+                       void *y) {
+  if (type == CEED_SCALAR_BF16) {
+    uint16_t *yb = y;
+    CeedPragmaSIMDFP32
+    for (CeedInt i=0; i<n; i++) {
+      const float f = x[i];
+      uint32_t u;
+      memcpy(&u, &f, sizeof(u));
+      yb[i] = (u & 0x7fffffffu) > 0x7f800000u ? (u >> 16) | 0x40u :
+              (u + 0x7fffu + ((u >> 16) & 1u)) >> 16;
+    }
+  } else {
+    float *yf = y;
+    CeedPragmaSIMDFP32
+    for (CeedInt i=0; i<n; i++)
+      yf[i] = x[i];
+  }
+  return 0;
+}
+
+int CeedScalarUnpack_Opt(CeedScalarType type, CeedInt n, const void *x,
+                         CeedScalar *y) {
+  if (type == CEED_SCALAR_BF16) {
+    const uint16_t *xb = x;
+    CeedPragmaSIMDFP32
+    for (CeedInt i=0; i<n; i++) {
+      const uint32_t u = (uint32_t)xb[i] << 16;
+      float f;
+      memcpy(&f, &u, sizeof(f));
+      y[i] = f;
+    }
+  } else {
+    const float *xf = x;
+    CeedPragmaSIMDFP32
+    for (CeedInt i=0; i<n; i++)
+      y[i] = xf[i];
+  }
+  return 0;
+}
+//------------------------------------------------------------------------------
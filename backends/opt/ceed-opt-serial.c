@@ -27,6 +27,7 @@ static int CeedDestroy_Opt(Ceed ceed) {
   int ierr;
   Ceed_Opt *data;
   ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedFree(&data->tuned); CeedChk(ierr);
   ierr = CeedFree(&data); CeedChk(ierr);
 
   return 0;
@@ -37,11 +38,14 @@ static int CeedDestroy_Opt(Ceed ceed) {
 //------------------------------------------------------------------------------
 static int CeedInit_Opt_Serial(const char *resource, Ceed ceed) {
   int ierr;
-  if (strcmp(resource, "/cpu/self")
-      && strcmp(resource, "/cpu/self/opt/serial"))
+  char *resourceroot;
+  ierr = CeedGetResourceRoot(ceed, resource, &resourceroot); CeedChk(ierr);
+  if (strcmp(resourceroot, "/cpu/self")
+      && strcmp(resourceroot, "/cpu/self/opt/serial"))
     // LCOV_EXCL_START
     return CeedError(ceed, 1, "Opt backend cannot use resource: %s", resource);
   // LCOV_EXCL_STOP
+  ierr = CeedFree(&resourceroot); CeedChk(ierr);
   ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
 
   // Create reference CEED that implementation will be dispatched
@@ -55,11 +59,8 @@ static int CeedInit_Opt_Serial(const char *resource, Ceed ceed) {
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate",
                                 CeedOperatorCreate_Opt); CeedChk(ierr);
 
-  // Set blocksize
-  Ceed_Opt *data;
-  ierr = CeedCalloc(1, &data); CeedChk(ierr);
-  data->blksize = 1;
-  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+  // Set blocksize, default 1 unless given as resource option
+  ierr = CeedSetBlockSize_Opt(ceed, resource, 1); CeedChk(ierr);
 
   return 0;
 }
@@ -21,30 +21,115 @@
 #include <ceed-backend.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include "../ref/ceed-ref.h"
 
 typedef struct {
-  CeedInt blksize;
+  CeedInt P, Q, ncomp, dim;  /// Basis shape
+  CeedInt blksize;           /// Fastest block size measured for this shape
+} CeedBlockSizeTuning_Opt;
+
+typedef struct {
+  CeedInt blksize;                 /// Element block size
+  bool autotune;                   /// Time candidate block sizes per shape
+  CeedInt numtuned;                /// Number of tuned basis shapes
+  CeedBlockSizeTuning_Opt *tuned;  /// Block sizes tuned so far
+  bool tunelock;                   /// Lock for the tuned block sizes
 } Ceed_Opt;
 
 typedef struct {
   CeedScalar *colograd1d;
 } CeedBasis_Opt;
 
+typedef struct {
+  CeedInt dim, ncomp, P1d, Q1d; /// Tensor basis shape
+  bool collointerp;  /// Quadrature points coincide with the nodes
+  bool collograd;    /// Gradient by a collocated derivative at the Q points
+  float *interp1d;   /// Single precision 1D interpolation matrix
+  float *grad1d;     /// Single precision collocated or nodal 1D derivative
+} CeedBasisFP32_Opt;
+
+typedef struct {
+  CeedEvalMode emode;        /// QFunction field evaluation mode
+  CeedInt size;              /// QFunction field size
+  CeedVector vec;            /// Field vector, or CEED_VECTOR_ACTIVE
+  CeedElemRestriction rstr;  /// Blocked restriction, NULL for CEED_EVAL_WEIGHT
+  CeedElemRestriction_Ref *rstrimpl; /// Block kernel of the restriction
+  CeedInt ncomp, compstride; /// Restriction layout passed to the block kernel
+  CeedScalar *edata;         /// Single block E-vector array
+  CeedScalar *qdata;         /// Single block Q-vector array
+  CeedBasis basis;           /// Field basis
+  CeedInt gradfield;         /// GRAD input fused with this INTERP input, or -1
+  bool fused;                /// GRAD input evaluated with its INTERP input
+  CeedVector qvecfused;      /// Interpolated values followed by gradients
+  CeedBasisFP32_Opt *basisfp32; /// Single precision basis, or NULL
+  float *edatafp32;          /// Single precision block E-vector array
+  float *qdatafp32;          /// Single precision block Q-vector array
+  void *packed;              /// Reduced precision E-vector of a passive input
+  uint64_t packedstate;      /// Passive vector state when it was packed
+} CeedOperatorFieldPlan_Opt;
+
 typedef struct {
   bool identityqf;
+  CeedInt blksize;                     /// Element block size of this operator
+  CeedInt numqpts;                     /// Quadrature points per element
+  CeedOperatorFieldPlan_Opt *planin;   /// Input fields resolved at setup
+  CeedOperatorFieldPlan_Opt *planout;  /// Output fields resolved at setup
   CeedElemRestriction *blkrestr; /// Blocked versions of restrictions
-  CeedVector
-  *evecs;   /// E-vectors needed to apply operator (input followed by outputs)
   CeedScalar **edata;
-  uint64_t *inputstate;  /// State counter of inputs
-  CeedVector *evecsin;   /// Input E-vectors needed to apply operator
+  CeedVector *evecsin;   /// Single block input E-vectors
   CeedVector *evecsout;  /// Output E-vectors needed to apply operator
   CeedVector *qvecsin;   /// Input Q-vectors needed to apply operator
   CeedVector *qvecsout;  /// Output Q-vectors needed to apply operator
+  const CeedScalar *qin[16]; /// QFunction input arrays, from the Q-vectors
+  CeedScalar *qout[16];      /// QFunction output arrays, from the Q-vectors
+  float *workfp32;       /// Scratch for single precision basis actions
+  float *datafp32;       /// Single precision E- and Q-vectors of all fields
+  size_t sizefp32;       /// Entries in workfp32 and datafp32 together
+  CeedInt *chebstart;    /// Start in chebnodes of the entries each block ends
+  CeedInt *chebnodes;    /// L-vector entries by the last block touching them
+  bool chebsetup;        /// Chebyshev smoother node lists are set up
+  CeedScalarType passiveprecision; /// Storage of packed passive inputs
+  bool packlock;         /// Lock for packing the passive inputs
   CeedInt    numein;
   CeedInt    numeout;
 } CeedOperator_Opt;
 
+CEED_INTERN int CeedSetBlockSize_Opt(Ceed ceed, const char *resource,
+                                     CeedInt defaultblksize);
+
+CEED_INTERN int CeedOperatorGetBlockSize_Opt(CeedOperator op,
+    CeedInt *blksize);
+
+CEED_INTERN int CeedOperatorTimeBlockSize_Opt(CeedOperator op,
+    CeedInt blksize, double *time);
+
 CEED_INTERN int CeedOperatorCreate_Opt(CeedOperator op);
 
+CEED_INTERN int CeedBasisCreateFP32_Opt(CeedBasis basis,
+                                        CeedBasisFP32_Opt **fbasis);
+
+CEED_INTERN int CeedBasisGetWorkSizeFP32_Opt(const CeedBasisFP32_Opt *fbasis,
+    CeedInt nelem, size_t *size);
+
+CEED_INTERN int CeedBasisApplyFP32_Opt(const CeedBasisFP32_Opt *fbasis,
+                                       CeedInt nelem, CeedTransposeMode tmode,
+                                       CeedEvalMode emode, float *work,
+                                       const float *u, float *v);
+
+CEED_INTERN int CeedBasisDestroyFP32_Opt(CeedBasisFP32_Opt **fbasis);
+
+CEED_INTERN int CeedElemRestrictionApplyFP32_Opt(CeedElemRestriction r,
+    CeedInt ncomp, CeedInt blksize, CeedInt compstride, CeedInt b,
+    const CeedScalar *u, float *v);
+
+CEED_INTERN int CeedElemRestrictionApplyTransposeFP32_Opt(CeedElemRestriction r,
+    CeedInt ncomp, CeedInt blksize, CeedInt compstride, CeedInt b,
+    const float *u, CeedScalar *v);
+
+CEED_INTERN int CeedScalarPack_Opt(CeedScalarType type, CeedInt n,
+                                   const CeedScalar *x, void *y);
+
+CEED_INTERN int CeedScalarUnpack_Opt(CeedScalarType type, CeedInt n,
+                                     const void *x, CeedScalar *y);
+
 #endif // _ceed_opt_h
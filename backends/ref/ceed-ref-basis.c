@@ -24,9 +24,10 @@
 //------------------------------------------------------------------------------
 // Basis Apply
 //------------------------------------------------------------------------------
-static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
-                              CeedTransposeMode tmode, CeedEvalMode emode,
-                              CeedVector U, CeedVector V) {
+static int CeedBasisApplyArrays_Ref(CeedBasis basis, CeedInt nelem,
+                                    CeedTransposeMode tmode,
+                                    CeedEvalMode emode, const CeedScalar *u,
+                                    CeedScalar *v) {
   int ierr;
   Ceed ceed;
   ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
@@ -38,22 +39,10 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
   CeedTensorContract contract;
   ierr = CeedBasisGetTensorContract(basis, &contract); CeedChk(ierr);
   const CeedInt add = (tmode == CEED_TRANSPOSE);
-  const CeedScalar *u;
-  CeedScalar *v;
-  if (U != CEED_VECTOR_NONE) {
-    ierr = CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u); CeedChk(ierr);
-  } else if (emode != CEED_EVAL_WEIGHT) {
-    // LCOV_EXCL_START
-    return CeedError(ceed, 1,
-                     "An input vector is required for this CeedEvalMode");
-    // LCOV_EXCL_STOP
-  }
-  ierr = CeedVectorGetArray(V, CEED_MEM_HOST, &v); CeedChk(ierr);
-
   // Clear v if operating in transpose
   if (tmode == CEED_TRANSPOSE) {
-    const CeedInt vsize = nelem*ncomp*nnodes;
-    for (CeedInt i = 0; i < vsize; i++)
+    const size_t vsize = (size_t)nelem*ncomp*nnodes;
+    for (size_t i = 0; i < vsize; i++)
       v[i] = (CeedScalar) 0.0;
   }
   bool tensorbasis;
@@ -69,25 +58,32 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
       CeedBasis_Ref *impl;
       ierr = CeedBasisGetData(basis, &impl); CeedChk(ierr);
       if (impl->collointerp) {
-        memcpy(v, u, nelem*ncomp*nnodes*sizeof(u[0]));
+        memcpy(v, u, (size_t)nelem*ncomp*nnodes*sizeof(u[0]));
       } else {
         CeedInt P = P1d, Q = Q1d;
         if (tmode == CEED_TRANSPOSE) {
           P = Q1d; Q = P1d;
         }
         CeedInt pre = ncomp*CeedIntPow(P, dim-1), post = nelem;
-        CeedScalar tmp[2][nelem*ncomp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
+        const size_t tmpsize = CeedWorkspaceAlign_Ref((size_t)nelem*ncomp*Q*
+                               CeedIntPow(P>Q?P:Q, dim-1));
+        CeedWorkspace_Ref *work;
+        ierr = CeedWorkspaceGet_Ref(&impl->work, 2*tmpsize, &work);
+        CeedChk(ierr);
+        CeedScalar *tmp[2] = {work->array, work->array + tmpsize};
         const CeedScalar *interp1d;
-        ierr = CeedBasisGetInterp1D(basis, &interp1d); CeedChk(ierr);
+        ierr = CeedBasisGetInterp1D(basis, &interp1d);
+        CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
         for (CeedInt d=0; d<dim; d++) {
           ierr = CeedTensorContractApply(contract, pre, P, post, Q,
                                          interp1d, tmode, add&&(d==dim-1),
                                          d==0?u:tmp[d%2],
                                          d==dim-1?v:tmp[(d+1)%2]);
-          CeedChk(ierr);
+          CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
           pre /= P;
           post *= Q;
         }
+        ierr = CeedWorkspaceRestore_Ref(&impl->work, &work); CeedChk(ierr);
       }
     } break;
     // Evaluate the gradient to/from quadrature points
@@ -106,8 +102,13 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
       const CeedScalar *interp1d;
       ierr = CeedBasisGetInterp1D(basis, &interp1d); CeedChk(ierr);
       if (impl->collograd1d) {
-        CeedScalar tmp[2][nelem*ncomp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
-        CeedScalar interp[nelem*ncomp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
+        const size_t tmpsize = CeedWorkspaceAlign_Ref((size_t)nelem*ncomp*Q*
+                               CeedIntPow(P>Q?P:Q, dim-1));
+        CeedWorkspace_Ref *work;
+        ierr = CeedWorkspaceGet_Ref(&impl->work, 3*tmpsize, &work);
+        CeedChk(ierr);
+        CeedScalar *tmp[2] = {work->array, work->array + tmpsize};
+        CeedScalar *interp = work->array + 2*tmpsize;
         // Interpolate to quadrature points (NoTranspose)
         //  or Grad to quadrature points (Transpose)
         for (CeedInt d=0; d<dim; d++) {
@@ -122,7 +123,7 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
                                          (tmode == CEED_NOTRANSPOSE
                                           ? (d==dim-1?interp:tmp[(d+1)%2])
                                           : interp));
-          CeedChk(ierr);
+          CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
           pre /= P;
           post *= Q;
         }
@@ -145,10 +146,11 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
                                          (tmode == CEED_NOTRANSPOSE
                                           ? v + d*nqpt*ncomp*nelem
                                           : (d==dim-1?v:tmp[(d+1)%2])));
-          CeedChk(ierr);
+          CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
           pre /= P;
           post *= Q;
         }
+        ierr = CeedWorkspaceRestore_Ref(&impl->work, &work); CeedChk(ierr);
       } else if (impl->collointerp) { // Qpts collocated with nodes
         const CeedScalar *grad1d;
         ierr = CeedBasisGetGrad1D(basis, &grad1d); CeedChk(ierr);
@@ -173,7 +175,12 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
         if (tmode == CEED_TRANSPOSE) {
           P = Q1d, Q = P1d;
         }
-        CeedScalar tmp[2][nelem*ncomp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
+        const size_t tmpsize = CeedWorkspaceAlign_Ref((size_t)nelem*ncomp*Q*
+                               CeedIntPow(P>Q?P:Q, dim-1));
+        CeedWorkspace_Ref *work;
+        ierr = CeedWorkspaceGet_Ref(&impl->work, 2*tmpsize, &work);
+        CeedChk(ierr);
+        CeedScalar *tmp[2] = {work->array, work->array + tmpsize};
 
         // Dim**2 contractions, apply grad when pass == dim
         for (CeedInt p=0; p<dim; p++) {
@@ -190,11 +197,12 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
                                             ? (tmode == CEED_TRANSPOSE
                                                ? v : v+p*ncomp*nqpt*nelem)
                                             : tmp[(d+1)%2]));
-            CeedChk(ierr);
+            CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
             pre /= P;
             post *= Q;
           }
         }
+        ierr = CeedWorkspaceRestore_Ref(&impl->work, &work); CeedChk(ierr);
       }
     } break;
     // Retrieve interpolation weights
@@ -255,7 +263,17 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
       CeedInt gradstride = nqpt * nnodes;
       const CeedScalar *grad;
       ierr = CeedBasisGetGrad(basis, &grad); CeedChk(ierr);
-      if (tmode == CEED_TRANSPOSE) {
+      if (ncomp == 1) {
+        // With one component, the dim x nqpt x nnodes gradient is a single
+        //   (dim*nqpt) x nnodes matrix matching the quadrature point layout
+        if (tmode == CEED_TRANSPOSE) {
+          P = dim*nqpt; Q = nnodes;
+        } else {
+          Q = dim*nqpt;
+        }
+        ierr = CeedTensorContractApply(contract, 1, P, nelem, Q, grad, tmode,
+                                       add, u, v); CeedChk(ierr);
+      } else if (tmode == CEED_TRANSPOSE) {
         P = nqpt; Q = nnodes;
         for (CeedInt d = 0; d < dim; d++) {
           ierr = CeedTensorContractApply(contract, ncomp, P, nelem, Q,
@@ -298,6 +316,342 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
       // LCOV_EXCL_STOP
     }
   }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis Collapsed Product
+//------------------------------------------------------------------------------
+// Apply one product of collapsed coordinate factors, mats[d] for coordinate d,
+//   to a single component of nelem elements by a sequence of contractions, each
+//   summing over one mode index; transposed products are added to v
+static int CeedBasisCollapsedProduct_Ref(CeedTensorContract contract,
+    CeedBasisCollapsed_Ref *impl, CeedInt dim, CeedInt nelem,
+    CeedTransposeMode tmode, const CeedScalar *mats[3], CeedScalar *tmp[2],
+    const CeedScalar *u, CeedScalar *v) {
+  int ierr;
+  const CeedInt p = impl->degree, Q = impl->Q1d;
+  // Length of the trailing quadrature and element indices of each block
+  //   contracted by the B factors
+  const CeedInt inner = dim == 3 ? Q*nelem : nelem;
+
+  if (tmode == CEED_NOTRANSPOSE) {
+    const CeedScalar *in = u;
+    if (dim == 3) {
+      // tmp0[i,j][qc] = sum_k C_ijk(qc) u[i,j,k]
+      for (CeedInt i=0; i<=p; i++)
+        for (CeedInt j=0; j<=p-i; j++) {
+          const CeedInt ij = impl->offsetb[i] + j, ijk = impl->offsetc[ij];
+          ierr = CeedTensorContractApply(contract, 1, p-i-j+1, nelem, Q,
+                                         &mats[2][Q*ijk], tmode, 0,
+                                         &u[ijk*nelem], &tmp[0][ij*Q*nelem]);
+          CeedChk(ierr);
+        }
+      in = tmp[0];
+    }
+    // tmp1[i][qb] = sum_j B_ij(qb) in[i,j]
+    for (CeedInt i=0; i<=p; i++) {
+      const CeedInt ij = impl->offsetb[i];
+      ierr = CeedTensorContractApply(contract, 1, p-i+1, inner, Q,
+                                     &mats[1][Q*ij], tmode, 0, &in[ij*inner],
+                                     &tmp[1][i*Q*inner]); CeedChk(ierr);
+    }
+    // v[qa] = sum_i A_i(qa) tmp1[i]
+    ierr = CeedTensorContractApply(contract, 1, p+1, Q*inner, Q, mats[0], tmode,
+                                   0, tmp[1], v); CeedChk(ierr);
+  } else {
+    ierr = CeedTensorContractApply(contract, 1, Q, Q*inner, p+1, mats[0], tmode,
+                                   0, u, tmp[1]); CeedChk(ierr);
+    CeedScalar *out = dim == 3 ? tmp[0] : v;
+    for (CeedInt i=0; i<=p; i++) {
+      const CeedInt ij = impl->offsetb[i];
+      ierr = CeedTensorContractApply(contract, 1, Q, inner, p-i+1,
+                                     &mats[1][Q*ij], tmode, dim == 2,
+                                     &tmp[1][i*Q*inner], &out[ij*inner]);
+      CeedChk(ierr);
+    }
+    if (dim == 3)
+      for (CeedInt i=0; i<=p; i++)
+        for (CeedInt j=0; j<=p-i; j++) {
+          const CeedInt ij = impl->offsetb[i] + j, ijk = impl->offsetc[ij];
+          ierr = CeedTensorContractApply(contract, 1, Q, nelem, p-i-j+1,
+                                         &mats[2][Q*ijk], tmode, 1,
+                                         &tmp[0][ij*Q*nelem], &v[ijk*nelem]);
+          CeedChk(ierr);
+        }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply Collapsed
+//------------------------------------------------------------------------------
+static int CeedBasisApplyCollapsed_Ref(CeedBasis basis, CeedInt nelem,
+                                       CeedTransposeMode tmode,
+                                       CeedEvalMode emode, const CeedScalar *u,
+                                       CeedScalar *v) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+  CeedInt dim, ncomp, nnodes, nqpt;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &nnodes); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &nqpt); CeedChk(ierr);
+  CeedTensorContract contract;
+  ierr = CeedBasisGetTensorContract(basis, &contract); CeedChk(ierr);
+  CeedBasisCollapsed_Ref *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChk(ierr);
+  const CeedInt p = impl->degree, Q = impl->Q1d;
+  const CeedInt nij = (p+1)*(p+2)/2;
+  const CeedInt offset[3] = {0, Q*(p+1), Q*(p+1+nij)};
+  // Clear v if operating in transpose
+  if (tmode == CEED_TRANSPOSE) {
+    const size_t vsize = (size_t)nelem*ncomp*nnodes;
+    for (size_t i = 0; i < vsize; i++)
+      v[i] = (CeedScalar) 0.0;
+  }
+
+  // Partial sums over the first one or two mode indices
+  CeedWorkspace_Ref *work = NULL;
+  CeedScalar *tmp[2];
+  const size_t tmpsize[2] = {dim == 3 ? (size_t)nij*Q*nelem : 0,
+                             (size_t)(p+1)*CeedIntPow(Q, dim-1)*nelem
+                            };
+  if (emode == CEED_EVAL_INTERP || emode == CEED_EVAL_GRAD) {
+    const size_t gradsize = emode == CEED_EVAL_GRAD ?
+                            (size_t)dim*ncomp*nqpt*nelem : 0;
+    const size_t worksize = CeedWorkspaceAlign_Ref(tmpsize[0]) +
+                            CeedWorkspaceAlign_Ref(tmpsize[1]) + gradsize;
+    ierr = CeedWorkspaceGet_Ref(&impl->work, worksize, &work); CeedChk(ierr);
+    tmp[0] = work->array;
+    tmp[1] = tmp[0] + CeedWorkspaceAlign_Ref(tmpsize[0]);
+  }
+
+  switch (emode) {
+  // Interpolate to/from quadrature points
+  case CEED_EVAL_INTERP: {
+    const CeedScalar *mats[3] = {&impl->interp1d[offset[0]],
+                                 &impl->interp1d[offset[1]],
+                                 &impl->interp1d[offset[2]]
+                                };
+    const CeedInt ustride = tmode == CEED_NOTRANSPOSE ? nnodes : nqpt,
+                  vstride = tmode == CEED_NOTRANSPOSE ? nqpt : nnodes;
+    for (CeedInt c=0; c<ncomp; c++) {
+      ierr = CeedBasisCollapsedProduct_Ref(contract, impl, dim, nelem, tmode,
+                                           mats, tmp, &u[c*ustride*nelem],
+                                           &v[c*vstride*nelem]);
+      CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
+    }
+  } break;
+  // Evaluate the gradient to/from quadrature points
+  case CEED_EVAL_GRAD: {
+    // Derivatives in the collapsed coordinates, [dim][ncomp][nqpt][nelem]
+    CeedScalar *dc = tmp[1] + CeedWorkspaceAlign_Ref(tmpsize[1]);
+    const CeedInt dimstride = ncomp*nqpt*nelem;
+    if (tmode == CEED_TRANSPOSE)
+      for (CeedInt d=0; d<dim; d++)
+        for (CeedInt c=0; c<ncomp; c++)
+          for (CeedInt q=0; q<nqpt; q++) {
+            const CeedScalar *dcol = &impl->dcollapsed[(q*dim+d)*dim];
+            CeedScalar *dcq = &dc[d*dimstride + (c*nqpt+q)*nelem];
+            for (CeedInt e=0; e<nelem; e++)
+              dcq[e] = 0.0;
+            for (CeedInt dd=0; dd<dim; dd++) {
+              const CeedScalar *uq = &u[dd*dimstride + (c*nqpt+q)*nelem];
+              for (CeedInt e=0; e<nelem; e++)
+                dcq[e] += dcol[dd]*uq[e];
+            }
+          }
+    for (CeedInt d=0; d<dim; d++) {
+      const CeedScalar *mats[3];
+      for (CeedInt dd=0; dd<dim; dd++)
+        mats[dd] = dd == d ? &impl->grad1d[offset[dd]] :
+                   &impl->interp1d[offset[dd]];
+      for (CeedInt c=0; c<ncomp; c++) {
+        if (tmode == CEED_NOTRANSPOSE) {
+          ierr = CeedBasisCollapsedProduct_Ref(contract, impl, dim, nelem,
+                                               tmode, mats, tmp,
+                                               &u[c*nnodes*nelem],
+                                               &dc[d*dimstride + c*nqpt*nelem]);
+          CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
+        } else {
+          ierr = CeedBasisCollapsedProduct_Ref(contract, impl, dim, nelem,
+                                               tmode, mats, tmp,
+                                               &dc[d*dimstride + c*nqpt*nelem],
+                                               &v[c*nnodes*nelem]);
+          CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
+        }
+      }
+    }
+    if (tmode == CEED_NOTRANSPOSE)
+      for (CeedInt d=0; d<dim; d++)
+        for (CeedInt c=0; c<ncomp; c++)
+          for (CeedInt q=0; q<nqpt; q++) {
+            CeedScalar *vq = &v[d*dimstride + (c*nqpt+q)*nelem];
+            for (CeedInt e=0; e<nelem; e++)
+              vq[e] = 0.0;
+            for (CeedInt dd=0; dd<dim; dd++) {
+              const CeedScalar dcol = impl->dcollapsed[(q*dim+dd)*dim+d];
+              const CeedScalar *dcq = &dc[dd*dimstride + (c*nqpt+q)*nelem];
+              for (CeedInt e=0; e<nelem; e++)
+                vq[e] += dcol*dcq[e];
+            }
+          }
+  } break;
+  // Retrieve interpolation weights
+  case CEED_EVAL_WEIGHT: {
+    if (tmode == CEED_TRANSPOSE)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1,
+                       "CEED_EVAL_WEIGHT incompatible with CEED_TRANSPOSE");
+    // LCOV_EXCL_STOP
+    const CeedScalar *qweight;
+    ierr = CeedBasisGetQWeights(basis, &qweight); CeedChk(ierr);
+    for (CeedInt i=0; i<nqpt; i++)
+      for (CeedInt e=0; e<nelem; e++)
+        v[i*nelem + e] = qweight[i];
+  } break;
+  // LCOV_EXCL_START
+  // Evaluate the divergence to/from the quadrature points
+  case CEED_EVAL_DIV:
+    return CeedError(ceed, 1, "CEED_EVAL_DIV not supported");
+  // Evaluate the curl to/from the quadrature points
+  case CEED_EVAL_CURL:
+    return CeedError(ceed, 1, "CEED_EVAL_CURL not supported");
+  // Take no action, BasisApply should not have been called
+  case CEED_EVAL_NONE:
+    return CeedError(ceed, 1,
+                     "CEED_EVAL_NONE does not make sense in this context");
+    // LCOV_EXCL_STOP
+  }
+  if (work) {
+    ierr = CeedWorkspaceRestore_Ref(&impl->work, &work); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply Interpolation and Gradient Arrays
+//------------------------------------------------------------------------------
+static int CeedBasisApplyInterpGradArrays_Ref(CeedBasis basis, CeedInt nelem,
+    const CeedScalar *u, CeedScalar *v) {
+  int ierr;
+  CeedInt dim, ncomp, nqpt;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &nqpt); CeedChk(ierr);
+  const CeedInt gradoffset = ncomp*nqpt*nelem;
+  bool tensorbasis, collapsed;
+  ierr = CeedBasisIsTensor(basis, &tensorbasis); CeedChk(ierr);
+  ierr = CeedBasisIsCollapsed(basis, &collapsed); CeedChk(ierr);
+
+  if (tensorbasis) {
+    CeedBasis_Ref *impl;
+    ierr = CeedBasisGetData(basis, &impl); CeedChk(ierr);
+    if (impl->collograd1d) {
+      // The collocated gradient is taken from the interpolated values, so
+      //   interpolate straight into v and differentiate from there
+      CeedTensorContract contract;
+      ierr = CeedBasisGetTensorContract(basis, &contract); CeedChk(ierr);
+      CeedInt P, Q;
+      ierr = CeedBasisGetNumNodes1D(basis, &P); CeedChk(ierr);
+      ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q); CeedChk(ierr);
+      const CeedScalar *interp1d;
+      ierr = CeedBasisGetInterp1D(basis, &interp1d); CeedChk(ierr);
+      const size_t tmpsize = CeedWorkspaceAlign_Ref((size_t)nelem*ncomp*Q*
+                             CeedIntPow(Q, dim-1));
+      CeedWorkspace_Ref *work;
+      ierr = CeedWorkspaceGet_Ref(&impl->work, 2*tmpsize, &work);
+      CeedChk(ierr);
+      CeedScalar *tmp[2] = {work->array, work->array + tmpsize};
+      CeedInt pre = ncomp*CeedIntPow(P, dim-1), post = nelem;
+      for (CeedInt d=0; d<dim; d++) {
+        ierr = CeedTensorContractApply(contract, pre, P, post, Q, interp1d,
+                                       CEED_NOTRANSPOSE, false,
+                                       d==0?u:tmp[d%2],
+                                       d==dim-1?v:tmp[(d+1)%2]);
+        CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
+        pre /= P;
+        post *= Q;
+      }
+      pre = ncomp*CeedIntPow(Q, dim-1), post = nelem;
+      for (CeedInt d=0; d<dim; d++) {
+        ierr = CeedTensorContractApply(contract, pre, Q, post, Q,
+                                       impl->collograd1d, CEED_NOTRANSPOSE,
+                                       false, v, v + (d+1)*gradoffset);
+        CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
+        pre /= Q;
+        post *= Q;
+      }
+      ierr = CeedWorkspaceRestore_Ref(&impl->work, &work); CeedChk(ierr);
+      return 0;
+    }
+  }
+
+  // No intermediate values are shared, so evaluate each part in turn
+  if (collapsed) {
+    ierr = CeedBasisApplyCollapsed_Ref(basis, nelem, CEED_NOTRANSPOSE,
+                                       CEED_EVAL_INTERP, u, v); CeedChk(ierr);
+    ierr = CeedBasisApplyCollapsed_Ref(basis, nelem, CEED_NOTRANSPOSE,
+                                       CEED_EVAL_GRAD, u, v + gradoffset);
+    CeedChk(ierr);
+  } else {
+    ierr = CeedBasisApplyArrays_Ref(basis, nelem, CEED_NOTRANSPOSE,
+                                    CEED_EVAL_INTERP, u, v); CeedChk(ierr);
+    ierr = CeedBasisApplyArrays_Ref(basis, nelem, CEED_NOTRANSPOSE,
+                                    CEED_EVAL_GRAD, u, v + gradoffset);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply Arrays, any evaluation mode
+//------------------------------------------------------------------------------
+int CeedBasisApplyCore_Ref(CeedBasis basis, CeedInt nelem,
+                           CeedTransposeMode tmode, CeedEvalMode emode,
+                           const CeedScalar *u, CeedScalar *v) {
+  int ierr;
+  bool collapsed;
+  ierr = CeedBasisIsCollapsed(basis, &collapsed); CeedChk(ierr);
+  if (emode == (CEED_EVAL_INTERP | CEED_EVAL_GRAD)) {
+    ierr = CeedBasisApplyInterpGradArrays_Ref(basis, nelem, u, v);
+    CeedChk(ierr);
+  } else if (collapsed) {
+    ierr = CeedBasisApplyCollapsed_Ref(basis, nelem, tmode, emode, u, v);
+    CeedChk(ierr);
+  } else {
+    ierr = CeedBasisApplyArrays_Ref(basis, nelem, tmode, emode, u, v);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply Vectors
+//------------------------------------------------------------------------------
+static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
+                              CeedTransposeMode tmode, CeedEvalMode emode,
+                              CeedVector U, CeedVector V) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+  const CeedScalar *u = NULL;
+  CeedScalar *v;
+  if (U != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u); CeedChk(ierr);
+  } else if (emode != CEED_EVAL_WEIGHT) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1,
+                     "An input vector is required for this CeedEvalMode");
+    // LCOV_EXCL_STOP
+  }
+  ierr = CeedVectorGetArray(V, CEED_MEM_HOST, &v); CeedChk(ierr);
+
+  ierr = CeedBasisApplyCore_Ref(basis, nelem, tmode, emode, u, v);
+  CeedChk(ierr);
+
   if (U != CEED_VECTOR_NONE) {
     ierr = CeedVectorRestoreArrayRead(U, &u); CeedChk(ierr);
   }
@@ -305,6 +659,15 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Basis Apply Interpolation and Gradient
+//------------------------------------------------------------------------------
+static int CeedBasisApplyInterpGrad_Ref(CeedBasis basis, CeedInt nelem,
+                                        CeedVector U, CeedVector V) {
+  return CeedBasisApply_Ref(basis, nelem, CEED_NOTRANSPOSE,
+                            CEED_EVAL_INTERP | CEED_EVAL_GRAD, U, V);
+}
+
 //------------------------------------------------------------------------------
 // Basis Destroy Non-Tensor
 //------------------------------------------------------------------------------
@@ -338,12 +701,117 @@ int CeedBasisCreateH1_Ref(CeedElemTopology topo, CeedInt dim,
 
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
                                 CeedBasisApply_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "ApplyInterpGrad",
+                                CeedBasisApplyInterpGrad_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Destroy",
                                 CeedBasisDestroyNonTensor_Ref); CeedChk(ierr);
 
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Basis Get Memory Usage Collapsed
+//------------------------------------------------------------------------------
+static int CeedBasisGetMemoryUsageCollapsed_Ref(CeedBasis basis,
+    CeedSize *bytes) {
+  int ierr;
+  CeedBasisCollapsed_Ref *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChk(ierr);
+  const CeedInt p = impl->degree;
+
+  *bytes = (p + 1 + (p+1)*(p+2)/2)*sizeof(CeedInt) +
+           CeedWorkspacePoolGetMemoryUsage_Ref(&impl->work);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis Destroy Collapsed
+//------------------------------------------------------------------------------
+static int CeedBasisDestroyCollapsed_Ref(CeedBasis basis) {
+  int ierr;
+  CeedTensorContract contract;
+  ierr = CeedBasisGetTensorContract(basis, &contract); CeedChk(ierr);
+  ierr = CeedTensorContractDestroy(&contract); CeedChk(ierr);
+
+  CeedBasisCollapsed_Ref *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChk(ierr);
+  ierr = CeedFree(&impl->offsetb); CeedChk(ierr);
+  ierr = CeedFree(&impl->offsetc); CeedChk(ierr);
+  ierr = CeedWorkspacePoolDestroy_Ref(&impl->work); CeedChk(ierr);
+  ierr = CeedFree(&impl); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis Create Collapsed
+//------------------------------------------------------------------------------
+int CeedBasisCreateCollapsed_Ref(CeedElemTopology topo, CeedInt dim,
+                                 CeedInt P1d, CeedInt Q1d,
+                                 const CeedScalar *interp1d,
+                                 const CeedScalar *grad1d,
+                                 const CeedScalar *dcollapsed,
+                                 CeedBasis basis) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+  CeedBasisCollapsed_Ref *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  const CeedInt p = P1d - 1;
+  impl->degree = p;
+  impl->Q1d = Q1d;
+  impl->interp1d = interp1d;
+  impl->grad1d = grad1d;
+  impl->dcollapsed = dcollapsed;
+
+  // Mode offsets, with modes ordered by i, then j, then k
+  ierr = CeedMalloc(p+1, &impl->offsetb); CeedChk(ierr);
+  ierr = CeedMalloc((p+1)*(p+2)/2, &impl->offsetc); CeedChk(ierr);
+  for (CeedInt i=0, ij=0, ijk=0; i<=p; i++) {
+    impl->offsetb[i] = ij;
+    for (CeedInt j=0; j<=p-i; ij++, j++) {
+      impl->offsetc[ij] = ijk;
+      ijk += p-i-j+1;
+    }
+  }
+  ierr = CeedBasisSetData(basis, impl); CeedChk(ierr);
+
+  Ceed parent;
+  ierr = CeedGetParent(ceed, &parent); CeedChk(ierr);
+  CeedTensorContract contract;
+  ierr = CeedTensorContractCreate(parent, basis, &contract); CeedChk(ierr);
+  ierr = CeedBasisSetTensorContract(basis, &contract); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
+                                CeedBasisApply_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "ApplyInterpGrad",
+                                CeedBasisApplyInterpGrad_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Destroy",
+                                CeedBasisDestroyCollapsed_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "GetMemoryUsage",
+                                CeedBasisGetMemoryUsageCollapsed_Ref);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis Get Memory Usage Tensor
+//------------------------------------------------------------------------------
+static int CeedBasisGetMemoryUsageTensor_Ref(CeedBasis basis,
+    CeedSize *bytes) {
+  int ierr;
+  CeedBasis_Ref *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChk(ierr);
+  CeedInt Q1d;
+  ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+
+  *bytes = CeedWorkspacePoolGetMemoryUsage_Ref(&impl->work);
+  if (impl->collograd1d)
+    *bytes += Q1d*Q1d*sizeof(CeedScalar);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Basis Destroy Tensor
 //------------------------------------------------------------------------------
@@ -356,6 +824,7 @@ static int CeedBasisDestroyTensor_Ref(CeedBasis basis) {
   CeedBasis_Ref *impl;
   ierr = CeedBasisGetData(basis, &impl); CeedChk(ierr);
   ierr = CeedFree(&impl->collograd1d); CeedChk(ierr);
+  ierr = CeedWorkspacePoolDestroy_Ref(&impl->work); CeedChk(ierr);
   ierr = CeedFree(&impl); CeedChk(ierr);
 
   return 0;
@@ -401,8 +870,13 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P1d,
 
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
                                 CeedBasisApply_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "ApplyInterpGrad",
+                                CeedBasisApplyInterpGrad_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Destroy",
                                 CeedBasisDestroyTensor_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "GetMemoryUsage",
+                                CeedBasisGetMemoryUsageTensor_Ref);
+  CeedChk(ierr);
   return 0;
 }
 
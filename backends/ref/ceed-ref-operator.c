@@ -20,6 +20,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #include "ceed-ref.h"
 
 //------------------------------------------------------------------------------
@@ -27,14 +28,11 @@
 //------------------------------------------------------------------------------
 static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op,
                                        bool inOrOut,
-                                       CeedVector *fullevecs, CeedVector *evecs,
-                                       CeedVector *qvecs, CeedInt starte,
-                                       CeedInt numfields, CeedInt Q) {
-  CeedInt dim, ierr, size, P;
+                                       CeedOperatorFieldPlan_Ref *plan,
+                                       CeedInt numfields) {
+  CeedInt ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  CeedBasis basis;
-  CeedElemRestriction Erestrict;
   CeedOperatorField *opfields;
   CeedQFunctionField *qffields;
   if (inOrOut) {
@@ -49,51 +47,167 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op,
   for (CeedInt i=0; i<numfields; i++) {
     CeedEvalMode emode;
     ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
-
+    plan[i].emode = emode;
+    ierr = CeedOperatorFieldGetVector(opfields[i], &plan[i].vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetBasis(opfields[i], &plan[i].basis); CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetSize(qffields[i], &plan[i].size); CeedChk(ierr);
     if (emode != CEED_EVAL_WEIGHT) {
-      ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &Erestrict);
-      CeedChk(ierr);
-      ierr = CeedElemRestrictionCreateVector(Erestrict, NULL,
-                                             &fullevecs[i+starte]);
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &plan[i].rstr);
       CeedChk(ierr);
     }
+    if (emode == CEED_EVAL_DIV || emode == CEED_EVAL_CURL)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Ceed evaluation mode not implemented");
+    // LCOV_EXCL_STOP
+  }
+  return 0;
+}
 
-    switch(emode) {
-    case CEED_EVAL_NONE:
-      ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, Q*size, &qvecs[i]); CeedChk(ierr);
-      break;
-    case CEED_EVAL_INTERP:
-      ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
-      ierr = CeedElemRestrictionGetElementSize(Erestrict, &P);
-      CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, P*size, &evecs[i]); CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, Q*size, &qvecs[i]); CeedChk(ierr);
-      break;
-    case CEED_EVAL_GRAD:
-      ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
-      ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
-      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
-      ierr = CeedElemRestrictionGetElementSize(Erestrict, &P);
-      CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, P*size/dim, &evecs[i]); CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, Q*size, &qvecs[i]); CeedChk(ierr);
-      break;
-    case CEED_EVAL_WEIGHT: // Only on input fields
-      ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, Q, &qvecs[i]); CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
-                            CEED_VECTOR_NONE, qvecs[i]); CeedChk(ierr);
+//------------------------------------------------------------------------------
+// Fuse Input Interpolation and Gradient
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFusedInputs_Ref(CeedOperatorFieldPlan_Ref *plan,
+    CeedInt numfields) {
+  for (CeedInt i=0; i<numfields; i++)
+    plan[i].gradfield = -1;
+
+  // Pair interpolated inputs with gradients of the same field, so one
+  //   restriction and one basis evaluation serve both
+  for (CeedInt i=0; i<numfields; i++) {
+    if (plan[i].emode != CEED_EVAL_INTERP)
+      continue;
+    for (CeedInt j=0; j<numfields; j++) {
+      if (plan[j].emode != CEED_EVAL_GRAD || plan[j].fused ||
+          plan[j].vec != plan[i].vec || plan[j].rstr != plan[i].rstr ||
+          plan[j].basis != plan[i].basis)
+        continue;
+      plan[i].gradfield = j;
+      plan[j].fused = true;
       break;
-    case CEED_EVAL_DIV:
-      break; // Not implemented
-    case CEED_EVAL_CURL:
-      break; // Not implemented
     }
   }
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Setup Field E-vector and Q-vector
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFieldScratch_Ref(Ceed ceed,
+    const CeedOperatorFieldPlan_Ref *field, CeedInt Q, CeedVector *evec,
+    CeedVector *qvec) {
+  CeedInt ierr, dim, P;
+
+  switch(field->emode) {
+  case CEED_EVAL_NONE:
+    ierr = CeedVectorCreate(ceed, Q*field->size, qvec); CeedChk(ierr);
+    break;
+  case CEED_EVAL_INTERP:
+  case CEED_EVAL_GRAD:
+    dim = 1;
+    if (field->emode == CEED_EVAL_GRAD) {
+      ierr = CeedBasisGetDimension(field->basis, &dim); CeedChk(ierr);
+    }
+    ierr = CeedElemRestrictionGetElementSize(field->rstr, &P); CeedChk(ierr);
+    ierr = CeedVectorCreate(ceed, P*field->size/dim, evec); CeedChk(ierr);
+    ierr = CeedVectorCreate(ceed, Q*field->size, qvec); CeedChk(ierr);
+    break;
+  case CEED_EVAL_WEIGHT: // Only on input fields
+    ierr = CeedVectorCreate(ceed, Q, qvec); CeedChk(ierr);
+    ierr = CeedBasisApply(field->basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
+                          CEED_VECTOR_NONE, *qvec); CeedChk(ierr);
+    break;
+  case CEED_EVAL_DIV:
+  case CEED_EVAL_CURL:
+    break; // Refused at setup
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Scratch E-vectors and Q-vectors
+//------------------------------------------------------------------------------
+// Single element E- and Q-vectors for the execution plan; a
+//   CeedOperatorWorkspace gets its own, sharing the plan of the operator
+static int CeedOperatorSetupScratch_Ref(CeedOperator op,
+                                        CeedOperator_Ref *impl) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedInt Q;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+
+  // Allocate
+  ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->qvecsfused); CeedChk(ierr);
+
+  for (CeedInt i=0; i<impl->numein; i++) {
+    ierr = CeedOperatorSetupFieldScratch_Ref(ceed, &impl->planin[i], Q,
+           &impl->evecsin[i], &impl->qvecsin[i]); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<impl->numeout; i++) {
+    ierr = CeedOperatorSetupFieldScratch_Ref(ceed, &impl->planout[i], Q,
+           &impl->evecsout[i], &impl->qvecsout[i]); CeedChk(ierr);
+  }
+
+  // The QFunction reads both parts of a fused Q-vector in place
+  for (CeedInt i=0; i<impl->numein; i++) {
+    const CeedInt j = impl->planin[i].gradfield;
+    if (j < 0)
+      continue;
+    CeedScalar *q;
+    ierr = CeedVectorCreate(ceed, Q*(impl->planin[i].size +
+                                     impl->planin[j].size),
+                            &impl->qvecsfused[i]); CeedChk(ierr);
+    ierr = CeedVectorGetArray(impl->qvecsfused[i], CEED_MEM_HOST, &q);
+    CeedChk(ierr);
+    ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
+                              CEED_USE_POINTER, q); CeedChk(ierr);
+    ierr = CeedVectorSetArray(impl->qvecsin[j], CEED_MEM_HOST,
+                              CEED_USE_POINTER, &q[Q*impl->planin[i].size]);
+    CeedChk(ierr);
+    ierr = CeedVectorRestoreArray(impl->qvecsfused[i], &q); CeedChk(ierr);
+  }
+
+  // Identity QFunctions
+  if (impl->identityqf) {
+    for (CeedInt i=0; i<impl->numein; i++) {
+      ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
+      impl->qvecsout[i] = impl->qvecsin[i];
+      ierr = CeedVectorAddReference(impl->qvecsin[i]); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Destroy Scratch E-vectors and Q-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyScratch_Ref(CeedOperator_Ref *impl) {
+  int ierr;
+  // The arrays are allocated together, qvecsfused last
+  const bool allocated = impl->qvecsfused;
+
+  for (CeedInt i=0; i<impl->numein && allocated; i++) {
+    ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->qvecsin[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->qvecsfused[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->evecsin); CeedChk(ierr);
+  ierr = CeedFree(&impl->qvecsin); CeedChk(ierr);
+  ierr = CeedFree(&impl->qvecsfused); CeedChk(ierr);
+
+  for (CeedInt i=0; i<impl->numeout && allocated; i++) {
+    ierr = CeedVectorDestroy(&impl->evecsout[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->evecsout); CeedChk(ierr);
+  ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------/*
@@ -102,67 +216,36 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
   bool setupdone;
   ierr = CeedOperatorIsSetupDone(op, &setupdone); CeedChk(ierr);
   if (setupdone) return 0;
-  Ceed ceed;
-  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
   CeedOperator_Ref *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  // Element block-Jacobi inverses are applied without the fields
+  if (impl->blkjac)
+    return CeedOperatorSetSetupDone(op);
   CeedQFunction qf;
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
-  CeedInt Q, numinputfields, numoutputfields;
-  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
   ierr = CeedQFunctionIsIdentity(qf, &impl->identityqf); CeedChk(ierr);
   ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
   CeedChk(ierr);
-  CeedOperatorField *opinputfields, *opoutputfields;
-  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
-  CeedChk(ierr);
-  CeedQFunctionField *qfinputfields, *qfoutputfields;
-  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
-  CeedChk(ierr);
 
   // Allocate
-  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->evecs);
-  CeedChk(ierr);
-  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
-  CeedChk(ierr);
-
-  ierr = CeedCalloc(16, &impl->inputstate); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->planin); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->planout); CeedChk(ierr);
 
   impl->numein = numinputfields; impl->numeout = numoutputfields;
 
-  // Set up infield and outfield evecs and qvecs
+  // Execution plan
   // Infields
-  ierr = CeedOperatorSetupFields_Ref(qf, op, 0, impl->evecs,
-                                     impl->evecsin, impl->qvecsin, 0,
-                                     numinputfields, Q);
+  ierr = CeedOperatorSetupFields_Ref(qf, op, 0, impl->planin, numinputfields);
   CeedChk(ierr);
-  // Outfields
-  ierr = CeedOperatorSetupFields_Ref(qf, op, 1, impl->evecs,
-                                     impl->evecsout, impl->qvecsout,
-                                     numinputfields, numoutputfields, Q);
+  ierr = CeedOperatorSetupFusedInputs_Ref(impl->planin, numinputfields);
   CeedChk(ierr);
+  // Outfields
+  ierr = CeedOperatorSetupFields_Ref(qf, op, 1, impl->planout,
+                                     numoutputfields); CeedChk(ierr);
 
-  // Identity QFunctions
-  if (impl->identityqf) {
-    CeedEvalMode inmode, outmode;
-    CeedQFunctionField *infields, *outfields;
-    ierr = CeedQFunctionGetFields(qf, &infields, &outfields); CeedChk(ierr);
-
-    for (CeedInt i=0; i<numinputfields; i++) {
-      ierr = CeedQFunctionFieldGetEvalMode(infields[i], &inmode);
-      CeedChk(ierr);
-      ierr = CeedQFunctionFieldGetEvalMode(outfields[i], &outmode);
-      CeedChk(ierr);
-
-      ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
-      impl->qvecsout[i] = impl->qvecsin[i];
-      ierr = CeedVectorAddReference(impl->qvecsin[i]); CeedChk(ierr);
-    }
-  }
+  // E-vectors and Q-vectors for the operator's own application
+  ierr = CeedOperatorSetupScratch_Ref(op, impl); CeedChk(ierr);
 
   ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
 
@@ -170,220 +253,153 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
 }
 
 //------------------------------------------------------------------------------
-// Setup Operator Inputs
+// Input Restriction and Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorSetupInputs_Ref(CeedInt numinputfields,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
+static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt numinputfields,
     CeedVector invec, const bool skipactive, CeedOperator_Ref *impl,
     CeedRequest *request) {
   CeedInt ierr;
-  CeedEvalMode emode;
-  CeedVector vec;
-  CeedElemRestriction Erestrict;
-  uint64_t state;
 
   for (CeedInt i=0; i<numinputfields; i++) {
-    // Get input vector
-    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    const CeedOperatorFieldPlan_Ref *field = &impl->planin[i];
+    CeedVector vec = field->vec;
     if (vec == CEED_VECTOR_ACTIVE) {
       if (skipactive)
         continue;
       else
         vec = invec;
     }
+    if (field->emode == CEED_EVAL_WEIGHT || field->fused)
+      continue;
 
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    // Restrict element, directly into the Q-vector for CEED_EVAL_NONE
+    if (field->emode == CEED_EVAL_NONE) {
+      ierr = CeedElemRestrictionApplyBlock(field->rstr, e, CEED_NOTRANSPOSE,
+                                           vec, impl->qvecsin[i], request);
+      CeedChk(ierr);
+      continue;
+    }
+    ierr = CeedElemRestrictionApplyBlock(field->rstr, e, CEED_NOTRANSPOSE, vec,
+                                         impl->evecsin[i], request);
     CeedChk(ierr);
-    // Restrict and Evec
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
-    } else {
-      // Restrict
-      ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
-      // Skip restriction if input is unchanged
-      if (state != impl->inputstate[i] || vec == invec) {
-        ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
-        CeedChk(ierr);
-        ierr = CeedElemRestrictionApply(Erestrict, CEED_NOTRANSPOSE, vec,
-                                        impl->evecs[i], request); CeedChk(ierr);
-        impl->inputstate[i] = state;
-      }
-      // Get evec
-      ierr = CeedVectorGetArrayRead(impl->evecs[i], CEED_MEM_HOST,
-                                    (const CeedScalar **) &impl->edata[i]);
+    // Basis action, with the gradient of a fused pair alongside
+    if (field->gradfield >= 0) {
+      ierr = CeedBasisApply(field->basis, 1, CEED_NOTRANSPOSE,
+                            CEED_EVAL_INTERP | CEED_EVAL_GRAD,
+                            impl->evecsin[i], impl->qvecsfused[i]);
       CeedChk(ierr);
+    } else {
+      ierr = CeedBasisApply(field->basis, 1, CEED_NOTRANSPOSE, field->emode,
+                            impl->evecsin[i], impl->qvecsin[i]); CeedChk(ierr);
     }
   }
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Input Basis Action
+// Output Basis Action and Restriction
 //------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
-    CeedInt numinputfields, const bool skipactive, CeedOperator_Ref *impl) {
+static inline int CeedOperatorOutputBasis_Ref(CeedInt e,
+    CeedInt numoutputfields, CeedVector outvec, CeedOperator_Ref *impl,
+    CeedRequest *request) {
   CeedInt ierr;
-  CeedInt dim, elemsize, size;
-  CeedElemRestriction Erestrict;
-  CeedEvalMode emode;
-  CeedBasis basis;
 
-  for (CeedInt i=0; i<numinputfields; i++) {
-    // Skip active input
-    if (skipactive) {
-      CeedVector vec;
-      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-      if (vec == CEED_VECTOR_ACTIVE)
-        continue;
-    }
-    // Get elemsize, emode, size
-    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
-    // Basis action
-    switch(emode) {
-    case CEED_EVAL_NONE:
-      ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i][e*Q*size]); CeedChk(ierr);
-      break;
-    case CEED_EVAL_INTERP:
-      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i][e*elemsize*size]);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE,
-                            CEED_EVAL_INTERP, impl->evecsin[i],
-                            impl->qvecsin[i]); CeedChk(ierr);
-      break;
-    case CEED_EVAL_GRAD:
-      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
-      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i][e*elemsize*size/dim]);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE,
-                            CEED_EVAL_GRAD, impl->evecsin[i],
-                            impl->qvecsin[i]); CeedChk(ierr);
-      break;
-    case CEED_EVAL_WEIGHT:
-      break;  // No action
-    // LCOV_EXCL_START
-    case CEED_EVAL_DIV:
-    case CEED_EVAL_CURL: {
-      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    const CeedOperatorFieldPlan_Ref *field = &impl->planout[i];
+    CeedVector vec = field->vec;
+    if (vec == CEED_VECTOR_ACTIVE)
+      vec = outvec;
+
+    // Scatter CEED_EVAL_NONE outputs directly from the Q-vector
+    if (field->emode == CEED_EVAL_NONE) {
+      ierr = CeedElemRestrictionApplyBlock(field->rstr, e, CEED_TRANSPOSE,
+                                           impl->qvecsout[i], vec, request);
       CeedChk(ierr);
-      Ceed ceed;
-      ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
-      return CeedError(ceed, 1, "Ceed evaluation mode not implemented");
-      // LCOV_EXCL_STOP
-    }
+      continue;
     }
+    // Basis action
+    ierr = CeedBasisApply(field->basis, 1, CEED_TRANSPOSE, field->emode,
+                          impl->qvecsout[i], impl->evecsout[i]); CeedChk(ierr);
+    // Scatter element
+    ierr = CeedElemRestrictionApplyBlock(field->rstr, e, CEED_TRANSPOSE,
+                                         impl->evecsout[i], vec, request);
+    CeedChk(ierr);
   }
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Output Basis Action
+// Element Block-Jacobi Inverse Apply
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
-    CeedQFunctionField *qfoutputfields, CeedOperatorField *opoutputfields,
-    CeedInt numinputfields, CeedInt numoutputfields, CeedOperator op,
-    CeedOperator_Ref *impl) {
-  CeedInt ierr;
-  CeedInt dim, elemsize, size;
-  CeedElemRestriction Erestrict;
-  CeedEvalMode emode;
-  CeedBasis basis;
-
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    // Get elemsize, emode, size
-    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size); CeedChk(ierr);
-    // Basis action
-    switch(emode) {
-    case CEED_EVAL_NONE:
-      break; // No action
-    case CEED_EVAL_INTERP:
-      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
-      CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsout[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i + numinputfields][e*elemsize*size]);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_TRANSPOSE,
-                            CEED_EVAL_INTERP, impl->qvecsout[i],
-                            impl->evecsout[i]); CeedChk(ierr);
-      break;
-    case CEED_EVAL_GRAD:
-      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
-      CeedChk(ierr);
-      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsout[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i + numinputfields][e*elemsize*size/dim]);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_TRANSPOSE,
-                            CEED_EVAL_GRAD, impl->qvecsout[i],
-                            impl->evecsout[i]); CeedChk(ierr);
-      break;
-    // LCOV_EXCL_START
-    case CEED_EVAL_WEIGHT: {
-      Ceed ceed;
-      ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-      return CeedError(ceed, 1, "CEED_EVAL_WEIGHT cannot be an output "
-                       "evaluation mode");
-    }
-    case CEED_EVAL_DIV:
-    case CEED_EVAL_CURL: {
-      Ceed ceed;
-      ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-      return CeedError(ceed, 1, "Ceed evaluation mode not implemented");
-      // LCOV_EXCL_STOP
-    }
+// Inverses are interlaced across the elements of a block, matching the
+//   blocked E-vector layout, so the inner loop runs over the block
+static int CeedOperatorApplyAddBlockJacobi_Ref(CeedOperatorBlockJacobi_Ref *bj,
+    CeedVector invec, CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  const CeedInt B = CEED_ELEMMAT_BLK_SIZE, n = bj->esize;
+
+  ierr = CeedElemRestrictionApply(bj->rstr, CEED_NOTRANSPOSE, invec, bj->ein,
+                                  request); CeedChk(ierr);
+  const CeedScalar *u;
+  CeedScalar *v;
+  ierr = CeedVectorGetArrayRead(bj->ein, CEED_MEM_HOST, &u); CeedChk(ierr);
+  ierr = CeedVectorGetArray(bj->eout, CEED_MEM_HOST, &v); CeedChk(ierr);
+  for (CeedInt b=0; b<bj->nblk; b++)
+    for (CeedInt i=0; i<n; i++) {
+      CeedScalar vi[CEED_ELEMMAT_BLK_SIZE] = {0.};
+      const CeedScalar *inv = &bj->inv[(b*n+i)*n*B];
+      for (CeedInt j=0; j<n; j++) {
+        const CeedScalar *uj = &u[(b*n+j)*B];
+        CeedPragmaSIMD
+        for (CeedInt l=0; l<B; l++)
+          vi[l] += inv[j*B+l] * uj[l];
+      }
+      for (CeedInt l=0; l<B; l++)
+        v[(b*n+i)*B+l] = vi[l];
     }
-  }
+  ierr = CeedVectorRestoreArrayRead(bj->ein, &u); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(bj->eout, &v); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(bj->rstr, CEED_TRANSPOSE, bj->eout, outvec,
+                                  request); CeedChk(ierr);
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Restore Input Vectors
+// Apply Elements
 //------------------------------------------------------------------------------
-static inline int CeedOperatorRestoreInputs_Ref(CeedInt numinputfields,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
-    const bool skipactive, CeedOperator_Ref *impl) {
-  CeedInt ierr;
-  CeedEvalMode emode;
+// The scratch vectors in impl are those of the operator or of one of its
+//   CeedOperatorWorkspaces
+static int CeedOperatorApplyAddElements_Ref(CeedOperator op,
+    CeedOperator_Ref *impl, CeedVector invec, CeedVector outvec,
+    CeedRequest *request) {
+  int ierr;
+  if (impl->blkjac)
+    return CeedOperatorApplyAddBlockJacobi_Ref(impl->blkjac, invec, outvec,
+           request);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt Q, numelements;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  const CeedInt numinputfields = impl->numein, numoutputfields = impl->numeout;
 
-  for (CeedInt i=0; i<numinputfields; i++) {
-    // Skip active inputs
-    if (skipactive) {
-      CeedVector vec;
-      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-      if (vec == CEED_VECTOR_ACTIVE)
-        continue;
-    }
-    // Restore input
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-    CeedChk(ierr);
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
-    } else {
-      ierr = CeedVectorRestoreArrayRead(impl->evecs[i],
-                                        (const CeedScalar **) &impl->edata[i]);
+  // Loop through elements
+  for (CeedInt e=0; e<numelements; e++) {
+    // Input restriction and basis apply
+    ierr = CeedOperatorInputBasis_Ref(e, numinputfields, invec, false, impl,
+                                      request); CeedChk(ierr);
+
+    // Q function
+    if (!impl->identityqf) {
+      ierr = CeedQFunctionApply(qf, Q, impl->qvecsin, impl->qvecsout);
       CeedChk(ierr);
     }
+
+    // Output basis apply and restriction
+    ierr = CeedOperatorOutputBasis_Ref(e, numoutputfields, outvec, impl,
+                                       request); CeedChk(ierr);
   }
+
   return 0;
 }
 
@@ -395,94 +411,77 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector invec,
   int ierr;
   CeedOperator_Ref *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
-  CeedQFunction qf;
-  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
-  CeedInt Q, numelements, numinputfields, numoutputfields, size;
-  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
-  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
-  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
-  CeedChk(ierr);
-  CeedOperatorField *opinputfields, *opoutputfields;
-  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
-  CeedChk(ierr);
-  CeedQFunctionField *qfinputfields, *qfoutputfields;
-  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
-  CeedChk(ierr);
-  CeedEvalMode emode;
-  CeedVector vec;
-  CeedElemRestriction Erestrict;
 
   // Setup
   ierr = CeedOperatorSetup_Ref(op); CeedChk(ierr);
 
-  // Input Evecs and Restriction
-  ierr = CeedOperatorSetupInputs_Ref(numinputfields, qfinputfields,
-                                     opinputfields, invec, false, impl,
-                                     request); CeedChk(ierr);
-
-  // Output Evecs
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    ierr = CeedVectorGetArray(impl->evecs[i+impl->numein], CEED_MEM_HOST,
-                              &impl->edata[i + numinputfields]); CeedChk(ierr);
-  }
+  return CeedOperatorApplyAddElements_Ref(op, impl, invec, outvec, request);
+}
 
-  // Loop through elements
-  for (CeedInt e=0; e<numelements; e++) {
-    // Output pointers
-    for (CeedInt i=0; i<numoutputfields; i++) {
-      ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
-      CeedChk(ierr);
-      if (emode == CEED_EVAL_NONE) {
-        ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size);
-        CeedChk(ierr);
-        ierr = CeedVectorSetArray(impl->qvecsout[i], CEED_MEM_HOST,
-                                  CEED_USE_POINTER,
-                                  &impl->edata[i + numinputfields][e*Q*size]);
-        CeedChk(ierr);
-      }
-    }
+//------------------------------------------------------------------------------
+// Workspace Create
+//------------------------------------------------------------------------------
+// The workspace shares the execution plan, and any block-Jacobi inverse, of
+//   the operator and owns only its E-vectors and Q-vectors
+static int CeedOperatorWorkspaceCreate_Ref(CeedOperator op,
+    CeedOperatorWorkspace ws) {
+  int ierr;
+  CeedOperator_Ref *impl, *wsimpl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
 
-    // Input basis apply
-    ierr = CeedOperatorInputBasis_Ref(e, Q, qfinputfields, opinputfields,
-                                      numinputfields, false, impl);
+  ierr = CeedCalloc(1, &wsimpl); CeedChk(ierr);
+  ierr = CeedOperatorWorkspaceSetData(ws, wsimpl); CeedChk(ierr);
+  wsimpl->identityqf = impl->identityqf;
+  wsimpl->planin = impl->planin;
+  wsimpl->planout = impl->planout;
+  wsimpl->numein = impl->numein;
+  wsimpl->numeout = impl->numeout;
+
+  if (impl->blkjac) {
+    CeedOperatorBlockJacobi_Ref *bj;
+    ierr = CeedCalloc(1, &bj); CeedChk(ierr);
+    *bj = *impl->blkjac;
+    bj->ein = bj->eout = NULL;
+    wsimpl->blkjac = bj;
+    ierr = CeedElemRestrictionCreateVector(bj->rstr, NULL, &bj->ein);
     CeedChk(ierr);
-
-    // Q function
-    if (!impl->identityqf) {
-      ierr = CeedQFunctionApply(qf, Q, impl->qvecsin, impl->qvecsout);
-      CeedChk(ierr);
-    }
-
-    // Output basis apply
-    ierr = CeedOperatorOutputBasis_Ref(e, Q, qfoutputfields, opoutputfields,
-                                       numinputfields, numoutputfields, op, impl);
+    ierr = CeedElemRestrictionCreateVector(bj->rstr, NULL, &bj->eout);
     CeedChk(ierr);
+    return 0;
   }
+  ierr = CeedOperatorSetupScratch_Ref(op, wsimpl); CeedChk(ierr);
+  return 0;
+}
 
-  // Output restriction
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    // Restore evec
-    ierr = CeedVectorRestoreArray(impl->evecs[i+impl->numein],
-                                  &impl->edata[i + numinputfields]);
-    CeedChk(ierr);
-    // Get output vector
-    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
-    // Active
-    if (vec == CEED_VECTOR_ACTIVE)
-      vec = outvec;
-    // Restrict
-    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionApply(Erestrict, CEED_TRANSPOSE,
-                                    impl->evecs[i+impl->numein], vec, request);
-    CeedChk(ierr);
-  }
+//------------------------------------------------------------------------------
+// Workspace Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorWorkspaceApplyAdd_Ref(CeedOperatorWorkspace ws,
+    CeedVector invec, CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  CeedOperator op;
+  ierr = CeedOperatorWorkspaceGetOperator(ws, &op); CeedChk(ierr);
+  CeedOperator_Ref *wsimpl;
+  ierr = CeedOperatorWorkspaceGetData(ws, &wsimpl); CeedChk(ierr);
 
-  // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Ref(numinputfields, qfinputfields,
-                                       opinputfields, false, impl);
-  CeedChk(ierr);
+  return CeedOperatorApplyAddElements_Ref(op, wsimpl, invec, outvec, request);
+}
 
+//------------------------------------------------------------------------------
+// Workspace Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorWorkspaceDestroy_Ref(CeedOperatorWorkspace ws) {
+  int ierr;
+  CeedOperator_Ref *wsimpl;
+  ierr = CeedOperatorWorkspaceGetData(ws, &wsimpl); CeedChk(ierr);
+
+  if (wsimpl->blkjac) {
+    ierr = CeedVectorDestroy(&wsimpl->blkjac->ein); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&wsimpl->blkjac->eout); CeedChk(ierr);
+    ierr = CeedFree(&wsimpl->blkjac); CeedChk(ierr);
+  }
+  ierr = CeedOperatorDestroyScratch_Ref(wsimpl); CeedChk(ierr);
+  ierr = CeedFree(&wsimpl); CeedChk(ierr);
   return 0;
 }
 
@@ -494,6 +493,14 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
   int ierr;
   CeedOperator_Ref *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  if (impl->blkjac) {
+    Ceed ceed;
+    ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Element block-Jacobi inverse operators cannot "
+                     "be assembled");
+    // LCOV_EXCL_STOP
+  }
   CeedQFunction qf;
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
   CeedInt Q, numelements, numinputfields, numoutputfields, size;
@@ -525,11 +532,6 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
     return CeedError(ceed, 1, "Assembling identity QFunctions not supported");
   // LCOV_EXCL_STOP
 
-  // Input Evecs and Restriction
-  ierr = CeedOperatorSetupInputs_Ref(numinputfields, qfinputfields,
-                                     opinputfields, NULL, true, impl, request);
-  CeedChk(ierr);
-
   // Count number of active input fields
   for (CeedInt i=0; i<numinputfields; i++) {
     // Get input vector
@@ -574,21 +576,21 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
   // Create output restriction
   CeedInt strides[3] = {1, Q, numactivein*numactiveout*Q}; /* *NOPAD* */
   ierr = CeedElemRestrictionCreateStrided(ceedparent, numelements, Q,
-                                          numactivein*numactiveout,
-                                          numactivein*numactiveout*numelements*Q,
-                                          strides, rstr); CeedChk(ierr);
+         numactivein*numactiveout,
+         (CeedSize)numactivein*numactiveout*numelements*Q,
+         strides, rstr); CeedChk(ierr);
   // Create assembled vector
-  ierr = CeedVectorCreate(ceedparent, numelements*Q*numactivein*numactiveout,
+  ierr = CeedVectorCreate(ceedparent,
+                          (CeedSize)numelements*Q*numactivein*numactiveout,
                           assembled); CeedChk(ierr);
   ierr = CeedVectorSetValue(*assembled, 0.0); CeedChk(ierr);
   ierr = CeedVectorGetArray(*assembled, CEED_MEM_HOST, &a); CeedChk(ierr);
 
   // Loop through elements
   for (CeedInt e=0; e<numelements; e++) {
-    // Input basis apply
-    ierr = CeedOperatorInputBasis_Ref(e, Q, qfinputfields, opinputfields,
-                                      numinputfields, true, impl);
-    CeedChk(ierr);
+    // Input restriction and basis apply
+    ierr = CeedOperatorInputBasis_Ref(e, numinputfields, NULL, true, impl,
+                                      request); CeedChk(ierr);
 
     // Assemble QFunction
     for (CeedInt in=0; in<numactivein; in++) {
@@ -600,16 +602,12 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
       }
       // Set Outputs
       for (CeedInt out=0; out<numoutputfields; out++) {
-        // Get output vector
-        ierr = CeedOperatorFieldGetVector(opoutputfields[out], &vec);
-        CeedChk(ierr);
         // Check if active output
-        if (vec == CEED_VECTOR_ACTIVE) {
-          CeedVectorSetArray(impl->qvecsout[out], CEED_MEM_HOST,
-                             CEED_USE_POINTER, a); CeedChk(ierr);
-          ierr = CeedQFunctionFieldGetSize(qfoutputfields[out], &size);
-          CeedChk(ierr);
-          a += size*Q; // Advance the pointer by the size of the output
+        if (impl->planout[out].vec == CEED_VECTOR_ACTIVE) {
+          ierr = CeedVectorSetArray(impl->qvecsout[out], CEED_MEM_HOST,
+                                    CEED_USE_POINTER, a); CeedChk(ierr);
+          // Advance the pointer by the size of the output
+          a += impl->planout[out].size*Q;
         }
       }
       // Apply QFunction
@@ -630,11 +628,6 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
     }
   }
 
-  // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Ref(numinputfields, qfinputfields,
-                                       opinputfields, true, impl);
-  CeedChk(ierr);
-
   // Restore output
   ierr = CeedVectorRestoreArray(*assembled, &a); CeedChk(ierr);
 
@@ -670,6 +663,79 @@ static inline void CeedOperatorGetBasisPointer_Ref(const CeedScalar **basisptr,
   }
 }
 
+//------------------------------------------------------------------------------
+// Get Active Field Evaluation Modes
+//------------------------------------------------------------------------------
+static int CeedOperatorGetActiveEvalModes_Ref(CeedOperator op, bool isinput,
+    CeedBasis *basis, CeedElemRestriction *rstr, CeedInt *numemode,
+    CeedEvalMode **emodes) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opfields;
+  CeedQFunctionField *qffields;
+  CeedInt numfields;
+  if (isinput) {
+    ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, &qffields, NULL); CeedChk(ierr);
+    numfields = numinputfields;
+  } else {
+    ierr = CeedOperatorGetFields(op, NULL, &opfields); CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, NULL, &qffields); CeedChk(ierr);
+    numfields = numoutputfields;
+  }
+
+  // Each active field contributes one evaluation mode per dimension of its
+  //   basis action
+  *numemode = 0;
+  *emodes = NULL;
+  *basis = NULL;
+  *rstr = NULL;
+  for (CeedInt i=0; i<numfields; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+    if (vec != CEED_VECTOR_ACTIVE)
+      continue;
+    CeedElemRestriction r;
+    CeedInt dim;
+    ierr = CeedOperatorFieldGetBasis(opfields[i], basis); CeedChk(ierr);
+    ierr = CeedBasisGetDimension(*basis, &dim); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &r); CeedChk(ierr);
+    if (*rstr && *rstr != r)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1,
+                       "Multi-field non-composite operator assembly not supported");
+    // LCOV_EXCL_STOP
+    *rstr = r;
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+    switch (emode) {
+    case CEED_EVAL_NONE:
+    case CEED_EVAL_INTERP:
+      ierr = CeedRealloc(*numemode + 1, emodes); CeedChk(ierr);
+      (*emodes)[*numemode] = emode;
+      *numemode += 1;
+      break;
+    case CEED_EVAL_GRAD:
+      ierr = CeedRealloc(*numemode + dim, emodes); CeedChk(ierr);
+      for (CeedInt d=0; d<dim; d++)
+        (*emodes)[*numemode+d] = emode;
+      *numemode += dim;
+      break;
+    case CEED_EVAL_WEIGHT:
+    case CEED_EVAL_DIV:
+    case CEED_EVAL_CURL:
+      break; // Caught by QF Assembly
+    }
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Create point block restriction
 //------------------------------------------------------------------------------
@@ -718,13 +784,8 @@ static inline int CeedOperatorAssembleAddDiagonalCore_Ref(CeedOperator op,
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-
-  // Assemble QFunction
-  CeedQFunction qf;
-  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
-  CeedInt numinputfields, numoutputfields;
-  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
-  CeedChk(ierr);
+
+  // Assemble QFunction
   CeedVector assembledqf;
   CeedElemRestriction rstr;
   ierr = CeedOperatorLinearAssembleQFunction(op,  &assembledqf, &rstr, request);
@@ -733,98 +794,16 @@ static inline int CeedOperatorAssembleAddDiagonalCore_Ref(CeedOperator op,
   CeedScalar maxnorm = 0;
   ierr = CeedVectorNorm(assembledqf, CEED_NORM_MAX, &maxnorm); CeedChk(ierr);
 
-  // Determine active input basis
-  CeedOperatorField *opfields;
-  CeedQFunctionField *qffields;
-  ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
-  ierr = CeedQFunctionGetFields(qf, &qffields, NULL); CeedChk(ierr);
-  CeedInt numemodein = 0, ncomp, dim = 1;
-  CeedEvalMode *emodein = NULL;
-  CeedBasis basisin = NULL;
-  CeedElemRestriction rstrin = NULL;
-  for (CeedInt i=0; i<numinputfields; i++) {
-    CeedVector vec;
-    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
-    if (vec == CEED_VECTOR_ACTIVE) {
-      CeedElemRestriction rstr;
-      ierr = CeedOperatorFieldGetBasis(opfields[i], &basisin); CeedChk(ierr);
-      ierr = CeedBasisGetNumComponents(basisin, &ncomp); CeedChk(ierr);
-      ierr = CeedBasisGetDimension(basisin, &dim); CeedChk(ierr);
-      ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &rstr);
-      CeedChk(ierr);
-      if (rstrin && rstrin != rstr)
-        // LCOV_EXCL_START
-        return CeedError(ceed, 1,
-                         "Multi-field non-composite operator diagonal assembly not supported");
-      // LCOV_EXCL_STOP
-      rstrin = rstr;
-      CeedEvalMode emode;
-      ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode);
-      CeedChk(ierr);
-      switch (emode) {
-      case CEED_EVAL_NONE:
-      case CEED_EVAL_INTERP:
-        ierr = CeedRealloc(numemodein + 1, &emodein); CeedChk(ierr);
-        emodein[numemodein] = emode;
-        numemodein += 1;
-        break;
-      case CEED_EVAL_GRAD:
-        ierr = CeedRealloc(numemodein + dim, &emodein); CeedChk(ierr);
-        for (CeedInt d=0; d<dim; d++)
-          emodein[numemodein+d] = emode;
-        numemodein += dim;
-        break;
-      case CEED_EVAL_WEIGHT:
-      case CEED_EVAL_DIV:
-      case CEED_EVAL_CURL:
-        break; // Caught by QF Assembly
-      }
-    }
-  }
-
-  // Determine active output basis
-  ierr = CeedOperatorGetFields(op, NULL, &opfields); CeedChk(ierr);
-  ierr = CeedQFunctionGetFields(qf, NULL, &qffields); CeedChk(ierr);
-  CeedInt numemodeout = 0;
-  CeedEvalMode *emodeout = NULL;
-  CeedBasis basisout = NULL;
-  CeedElemRestriction rstrout = NULL;
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    CeedVector vec;
-    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
-    if (vec == CEED_VECTOR_ACTIVE) {
-      CeedElemRestriction rstr;
-      ierr = CeedOperatorFieldGetBasis(opfields[i], &basisout); CeedChk(ierr);
-      ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &rstr);
-      CeedChk(ierr);
-      if (rstrout && rstrout != rstr)
-        // LCOV_EXCL_START
-        return CeedError(ceed, 1,
-                         "Multi-field non-composite operator diagonal assembly not supported");
-      // LCOV_EXCL_STOP
-      rstrout = rstr;
-      CeedEvalMode emode;
-      ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
-      switch (emode) {
-      case CEED_EVAL_NONE:
-      case CEED_EVAL_INTERP:
-        ierr = CeedRealloc(numemodeout + 1, &emodeout); CeedChk(ierr);
-        emodeout[numemodeout] = emode;
-        numemodeout += 1;
-        break;
-      case CEED_EVAL_GRAD:
-        ierr = CeedRealloc(numemodeout + dim, &emodeout); CeedChk(ierr);
-        for (CeedInt d=0; d<dim; d++)
-          emodeout[numemodeout+d] = emode;
-        numemodeout += dim;
-        break;
-      case CEED_EVAL_WEIGHT:
-      case CEED_EVAL_DIV:
-      case CEED_EVAL_CURL:
-        break; // Caught by QF Assembly
-      }
-    }
-  }
+  // Determine active input and output bases
+  CeedInt numemodein, numemodeout, ncomp;
+  CeedEvalMode *emodein, *emodeout;
+  CeedBasis basisin, basisout;
+  CeedElemRestriction rstrin, rstrout;
+  ierr = CeedOperatorGetActiveEvalModes_Ref(op, true, &basisin, &rstrin,
+         &numemodein, &emodein); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveEvalModes_Ref(op, false, &basisout, &rstrout,
+         &numemodeout, &emodeout); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basisin, &ncomp); CeedChk(ierr);
 
   // Assemble point-block diagonal restriction, if needed
   CeedElemRestriction diagrstr = rstrout;
@@ -982,6 +961,398 @@ static int CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref(CeedOperator op,
   }
 }
 
+//------------------------------------------------------------------------------
+// Get L-vector Indices of a Restriction
+//------------------------------------------------------------------------------
+// indices has shape [nelem, ncomp, elemsize]; L-vectors may be larger than
+//   INT32_MAX, so the indices and their arithmetic are CeedSize
+static int CeedElemRestrictionGetLVectorIndices_Ref(CeedElemRestriction rstr,
+    CeedSize **indices) {
+  int ierr;
+  CeedInt nelem, elemsize, ncomp;
+  ierr = CeedElemRestrictionGetNumElements(rstr, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstr, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstr, &ncomp); CeedChk(ierr);
+  ierr = CeedMalloc((CeedSize)nelem*ncomp*elemsize, indices); CeedChk(ierr);
+
+  bool strided;
+  ierr = CeedElemRestrictionIsStrided(rstr, &strided); CeedChk(ierr);
+  if (strided) {
+    bool backendstrides;
+    CeedInt strides[3] = {1, elemsize, elemsize*ncomp};
+    ierr = CeedElemRestrictionHasBackendStrides(rstr, &backendstrides);
+    CeedChk(ierr);
+    if (!backendstrides) {
+      ierr = CeedElemRestrictionGetStrides(rstr, &strides); CeedChk(ierr);
+    }
+    for (CeedInt e=0; e<nelem; e++)
+      for (CeedInt k=0; k<ncomp; k++)
+        for (CeedInt n=0; n<elemsize; n++)
+          (*indices)[((CeedSize)e*ncomp+k)*elemsize+n] =
+            (CeedSize)n*strides[0] + (CeedSize)k*strides[1] +
+            (CeedSize)e*strides[2];
+  } else {
+    bool hasoffsets64;
+    CeedInt compstride;
+    ierr = CeedElemRestrictionHasOffsets64(rstr, &hasoffsets64); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetCompStride(rstr, &compstride); CeedChk(ierr);
+    if (hasoffsets64) {
+      const CeedSize *offsets;
+      ierr = CeedElemRestrictionGetOffsets64(rstr, CEED_MEM_HOST, &offsets);
+      CeedChk(ierr);
+      for (CeedInt e=0; e<nelem; e++)
+        for (CeedInt k=0; k<ncomp; k++)
+          for (CeedInt n=0; n<elemsize; n++)
+            (*indices)[((CeedSize)e*ncomp+k)*elemsize+n] =
+              offsets[(CeedSize)e*elemsize+n] + (CeedSize)k*compstride;
+      ierr = CeedElemRestrictionRestoreOffsets64(rstr, &offsets); CeedChk(ierr);
+    } else {
+      const CeedInt *offsets;
+      ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+      CeedChk(ierr);
+      for (CeedInt e=0; e<nelem; e++)
+        for (CeedInt k=0; k<ncomp; k++)
+          for (CeedInt n=0; n<elemsize; n++)
+            (*indices)[((CeedSize)e*ncomp+k)*elemsize+n] =
+              offsets[(CeedSize)e*elemsize+n] + (CeedSize)k*compstride;
+      ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Count Assembled Matrix Entries
+//------------------------------------------------------------------------------
+static int CeedSingleOperatorAssemblyCountEntries_Ref(CeedOperator op,
+    CeedSize *nentries) {
+  int ierr;
+  CeedInt numemodein, numemodeout, nelem, elemsizein, elemsizeout, ncompin,
+          ncompout;
+  CeedEvalMode *emodein, *emodeout;
+  CeedBasis basisin, basisout;
+  CeedElemRestriction rstrin, rstrout;
+  ierr = CeedOperatorGetActiveEvalModes_Ref(op, true, &basisin, &rstrin,
+         &numemodein, &emodein); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveEvalModes_Ref(op, false, &basisout, &rstrout,
+         &numemodeout, &emodeout); CeedChk(ierr);
+  ierr = CeedFree(&emodein); CeedChk(ierr);
+  ierr = CeedFree(&emodeout); CeedChk(ierr);
+
+  ierr = CeedElemRestrictionGetNumElements(rstrin, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrin, &elemsizein); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrin, &ncompin); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrout, &elemsizeout);
+  CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrout, &ncompout); CeedChk(ierr);
+  *nentries = (CeedSize)nelem*elemsizeout*ncompout*elemsizein*ncompin;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Sparsity Pattern
+//------------------------------------------------------------------------------
+// Each element contributes a dense block of rows [ncompout, elemsizeout] by
+//   columns [ncompin, elemsizein], stored row-major
+static int CeedSingleOperatorAssembleSymbolic_Ref(CeedOperator op,
+    CeedSize offset, CeedSize *rows, CeedSize *cols) {
+  int ierr;
+  CeedInt numemodein, numemodeout;
+  CeedEvalMode *emodein, *emodeout;
+  CeedBasis basisin, basisout;
+  CeedElemRestriction rstrin, rstrout;
+  ierr = CeedOperatorGetActiveEvalModes_Ref(op, true, &basisin, &rstrin,
+         &numemodein, &emodein); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveEvalModes_Ref(op, false, &basisout, &rstrout,
+         &numemodeout, &emodeout); CeedChk(ierr);
+  ierr = CeedFree(&emodein); CeedChk(ierr);
+  ierr = CeedFree(&emodeout); CeedChk(ierr);
+
+  CeedInt nelem, elemsizein, elemsizeout, ncompin, ncompout;
+  ierr = CeedElemRestrictionGetNumElements(rstrin, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrin, &elemsizein); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrin, &ncompin); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrout, &elemsizeout);
+  CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrout, &ncompout); CeedChk(ierr);
+  const CeedInt nrows = ncompout*elemsizeout, ncols = ncompin*elemsizein;
+
+  CeedSize *indicesin, *indicesout;
+  ierr = CeedElemRestrictionGetLVectorIndices_Ref(rstrin, &indicesin);
+  CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorIndices_Ref(rstrout, &indicesout);
+  CeedChk(ierr);
+  for (CeedInt e=0; e<nelem; e++)
+    for (CeedInt i=0; i<nrows; i++)
+      for (CeedInt j=0; j<ncols; j++) {
+        const CeedSize k = offset + ((CeedSize)e*nrows + i)*ncols + j;
+        rows[k] = indicesout[(CeedSize)e*nrows+i];
+        cols[k] = indicesin[(CeedSize)e*ncols+j];
+      }
+  ierr = CeedFree(&indicesin); CeedChk(ierr);
+  ierr = CeedFree(&indicesout); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Element Matrices
+//------------------------------------------------------------------------------
+// Element matrices are written to elemmats[offset:] with shape
+//   [nelem, ncompout, elemsizeout, ncompin, elemsizein]. For each block of
+//   elements, BTD = B_out^T D is formed pointwise and the product BTD B_in for
+//   the whole block is one GEMM through the tensor contraction of the active
+//   input basis.
+static int CeedSingleOperatorAssembleElementMatrices_Ref(CeedOperator op,
+    CeedSize offset, CeedScalar *elemmats) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+
+  // Assemble QFunction
+  CeedVector assembledqf;
+  CeedElemRestriction rstr;
+  ierr = CeedOperatorLinearAssembleQFunction(op, &assembledqf, &rstr,
+         CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr); CeedChk(ierr);
+
+  // Determine active input and output bases
+  CeedInt numemodein, numemodeout;
+  CeedEvalMode *emodein, *emodeout;
+  CeedBasis basisin, basisout;
+  CeedElemRestriction rstrin, rstrout;
+  ierr = CeedOperatorGetActiveEvalModes_Ref(op, true, &basisin, &rstrin,
+         &numemodein, &emodein); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveEvalModes_Ref(op, false, &basisout, &rstrout,
+         &numemodeout, &emodeout); CeedChk(ierr);
+  CeedInt nelem, nnodesin, nnodesout, ncompin, ncompout, nqpts;
+  ierr = CeedElemRestrictionGetNumElements(rstrin, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrin, &ncompin); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrout, &ncompout); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basisin, &nnodesin); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basisout, &nnodesout); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basisin, &nqpts); CeedChk(ierr);
+
+  // Stack the basis matrices of each evaluation mode, B has shape
+  //   [numemode, nqpts, nnodes]
+  const CeedInt numactivein = numemodein*ncompin,
+                numactiveout = numemodeout*ncompout,
+                nrows = ncompout*nnodesout, ncols = ncompin*nnodesin,
+                K = numemodein*nqpts;
+  const CeedInt blksize = nelem < CEED_ELEMMAT_BLK_SIZE ? nelem :
+                          CEED_ELEMMAT_BLK_SIZE;
+  CeedScalar *Bin, *Bout, *BTD;
+  ierr = CeedCalloc(numemodein*nqpts*nnodesin, &Bin); CeedChk(ierr);
+  ierr = CeedCalloc(numemodeout*nqpts*nnodesout, &Bout); CeedChk(ierr);
+  ierr = CeedMalloc(blksize*nrows*ncompin*K, &BTD); CeedChk(ierr);
+  for (CeedInt side=0; side<2; side++) {
+    CeedBasis basis = side ? basisout : basisin;
+    CeedEvalMode *emodes = side ? emodeout : emodein;
+    CeedScalar *B = side ? Bout : Bin;
+    CeedInt numemode = side ? numemodeout : numemodein;
+    CeedInt nnodes = side ? nnodesout : nnodesin;
+    const CeedScalar *interp, *grad;
+    ierr = CeedBasisGetInterp(basis, &interp); CeedChk(ierr);
+    ierr = CeedBasisGetGrad(basis, &grad); CeedChk(ierr);
+    CeedInt d = 0;
+    for (CeedInt m=0; m<numemode; m++) {
+      CeedScalar *Bm = &B[m*nqpts*nnodes];
+      switch (emodes[m]) {
+      case CEED_EVAL_NONE:
+        for (CeedInt i=0; i<(nnodes<nqpts?nnodes:nqpts); i++)
+          Bm[i*nnodes+i] = 1.0;
+        break;
+      case CEED_EVAL_INTERP:
+        memcpy(Bm, interp, nqpts*nnodes*sizeof(CeedScalar));
+        break;
+      case CEED_EVAL_GRAD:
+        memcpy(Bm, &grad[d*nqpts*nnodes], nqpts*nnodes*sizeof(CeedScalar));
+        d++;
+        break;
+      case CEED_EVAL_WEIGHT:
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_CURL:
+        break; // Caught by QF Assembly
+      }
+    }
+  }
+
+  // Contraction of the active input basis, if the backend provides one
+  CeedTensorContract contract;
+  ierr = CeedBasisGetTensorContract(basisin, &contract); CeedChk(ierr);
+
+  const CeedScalar *assembledqfarray;
+  ierr = CeedVectorGetArrayRead(assembledqf, CEED_MEM_HOST, &assembledqfarray);
+  CeedChk(ierr);
+  for (CeedInt e=0; e<nelem; e+=blksize) {
+    const CeedInt nblk = e+blksize <= nelem ? blksize : nelem-e;
+
+    // BTD has shape [nblk, ncompout, nnodesout, ncompin, numemodein, nqpts]
+    for (CeedInt b=0; b<nblk; b++)
+      for (CeedInt compout=0; compout<ncompout; compout++)
+        for (CeedInt i=0; i<nnodesout; i++)
+          for (CeedInt compin=0; compin<ncompin; compin++)
+            for (CeedInt ein=0; ein<numemodein; ein++) {
+              CeedScalar *btd = &BTD[((((b*ncompout+compout)*nnodesout+i)*
+                                       ncompin+compin)*numemodein+ein)*nqpts];
+              for (CeedInt q=0; q<nqpts; q++)
+                btd[q] = 0.0;
+              for (CeedInt eout=0; eout<numemodeout; eout++) {
+                const CeedInt qfin = (e+b)*numactivein + ein*ncompin+compin,
+                              qfout = eout*ncompout+compout;
+                const CeedScalar *qf =
+                  &assembledqfarray[(qfin*numactiveout + qfout)*nqpts];
+                const CeedScalar *bout = &Bout[eout*nqpts*nnodesout+i];
+                for (CeedInt q=0; q<nqpts; q++)
+                  btd[q] += bout[q*nnodesout] * qf[q];
+              }
+            }
+
+    // Element matrices BTD B_in, one row of nnodesin entries per
+    //   (element, compout, node, compin)
+    CeedScalar *emat = &elemmats[offset + (CeedSize)e*nrows*ncols];
+    const CeedInt A = nblk*nrows*ncompin;
+    if (contract) {
+      ierr = CeedTensorContractApply(contract, A, K, 1, nnodesin, Bin,
+                                     CEED_TRANSPOSE, false, BTD, emat);
+      CeedChk(ierr);
+    } else {
+      for (CeedInt a=0; a<A; a++)
+        for (CeedInt j=0; j<nnodesin; j++) {
+          CeedScalar sum = 0.0;
+          for (CeedInt k=0; k<K; k++)
+            sum += BTD[a*K+k] * Bin[k*nnodesin+j];
+          emat[a*nnodesin+j] = sum;
+        }
+    }
+  }
+  ierr = CeedVectorRestoreArrayRead(assembledqf, &assembledqfarray);
+  CeedChk(ierr);
+
+  // Cleanup
+  ierr = CeedVectorDestroy(&assembledqf); CeedChk(ierr);
+  ierr = CeedFree(&emodein); CeedChk(ierr);
+  ierr = CeedFree(&emodeout); CeedChk(ierr);
+  ierr = CeedFree(&Bin); CeedChk(ierr);
+  ierr = CeedFree(&Bout); CeedChk(ierr);
+  ierr = CeedFree(&BTD); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear Symbolic
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleSymbolic_Ref(CeedOperator op,
+    CeedSize *nentries, CeedSize **rows, CeedSize **cols) {
+  int ierr;
+  bool iscomposite;
+  CeedInt numsub = 1;
+  CeedOperator *subops = &op;
+  ierr = CeedOperatorIsComposite(op, &iscomposite); CeedChk(ierr);
+  if (iscomposite) {
+    ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+    ierr = CeedOperatorGetSubList(op, &subops); CeedChk(ierr);
+  }
+
+  // Suboperator entries follow each other
+  *nentries = 0;
+  for (CeedInt i=0; i<numsub; i++) {
+    CeedSize subentries;
+    ierr = CeedSingleOperatorAssemblyCountEntries_Ref(subops[i], &subentries);
+    CeedChk(ierr);
+    *nentries += subentries;
+  }
+  ierr = CeedMalloc(*nentries, rows); CeedChk(ierr);
+  ierr = CeedMalloc(*nentries, cols); CeedChk(ierr);
+  CeedSize offset = 0;
+  for (CeedInt i=0; i<numsub; i++) {
+    CeedSize subentries;
+    ierr = CeedSingleOperatorAssembleSymbolic_Ref(subops[i], offset, *rows,
+           *cols); CeedChk(ierr);
+    ierr = CeedSingleOperatorAssemblyCountEntries_Ref(subops[i], &subentries);
+    CeedChk(ierr);
+    offset += subentries;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear
+//------------------------------------------------------------------------------
+// The COO values are the element matrices of each suboperator in turn
+static int CeedOperatorLinearAssemble_Ref(CeedOperator op, CeedVector values) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  bool iscomposite;
+  CeedInt numsub = 1;
+  CeedOperator *subops = &op;
+  ierr = CeedOperatorIsComposite(op, &iscomposite); CeedChk(ierr);
+  if (iscomposite) {
+    ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+    ierr = CeedOperatorGetSubList(op, &subops); CeedChk(ierr);
+  }
+
+  // Check values length
+  CeedSize nentries = 0, length;
+  for (CeedInt i=0; i<numsub; i++) {
+    CeedSize subentries;
+    ierr = CeedSingleOperatorAssemblyCountEntries_Ref(subops[i], &subentries);
+    CeedChk(ierr);
+    nentries += subentries;
+  }
+  ierr = CeedVectorGetLength(values, &length); CeedChk(ierr);
+  if (length != nentries)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 2, "Values vector length %ld not compatible with "
+                     "%ld assembled entries", (long)length, (long)nentries);
+  // LCOV_EXCL_STOP
+
+  CeedScalar *vals;
+  ierr = CeedVectorGetArray(values, CEED_MEM_HOST, &vals); CeedChk(ierr);
+  CeedSize offset = 0;
+  for (CeedInt i=0; i<numsub; i++) {
+    CeedSize subentries;
+    ierr = CeedSingleOperatorAssembleElementMatrices_Ref(subops[i], offset,
+           vals); CeedChk(ierr);
+    ierr = CeedSingleOperatorAssemblyCountEntries_Ref(subops[i], &subentries);
+    CeedChk(ierr);
+    offset += subentries;
+  }
+  ierr = CeedVectorRestoreArray(values, &vals); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Element Matrices
+//------------------------------------------------------------------------------
+static int CeedOperatorAssembleElementMatrices_Ref(CeedOperator op,
+    CeedVector *assembled, CeedRequest *request) {
+  int ierr;
+  Ceed ceed, ceedparent;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedGetOperatorFallbackParentCeed(ceed, &ceedparent); CeedChk(ierr);
+  ceedparent = ceedparent ? ceedparent : ceed;
+  bool iscomposite;
+  CeedInt numsub = 1;
+  CeedOperator *subops = &op;
+  ierr = CeedOperatorIsComposite(op, &iscomposite); CeedChk(ierr);
+  if (iscomposite) {
+    ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+    ierr = CeedOperatorGetSubList(op, &subops); CeedChk(ierr);
+  }
+
+  CeedSize nentries = 0;
+  for (CeedInt i=0; i<numsub; i++) {
+    CeedSize subentries;
+    ierr = CeedSingleOperatorAssemblyCountEntries_Ref(subops[i], &subentries);
+    CeedChk(ierr);
+    nentries += subentries;
+  }
+  ierr = CeedVectorCreate(ceedparent, nentries, assembled); CeedChk(ierr);
+  ierr = CeedOperatorLinearAssemble_Ref(op, *assembled); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Create FDM Element Inverse
 //------------------------------------------------------------------------------
@@ -1022,7 +1393,8 @@ int CeedOperatorCreateFDMElementInverse_Ref(CeedOperator op,
     // LCOV_EXCL_START
     return CeedError(ceed, 1, "No active field set");
   // LCOV_EXCL_STOP
-  CeedInt P1d, Q1d, elemsize, nqpts, dim, ncomp = 1, nelem = 1, lsize = 1;
+  CeedInt P1d, Q1d, elemsize, nqpts, dim, ncomp = 1, nelem = 1;
+  CeedSize lsize = 1;
   ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
   ierr = CeedBasisGetNumNodes(basis, &elemsize); CeedChk(ierr);
   ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
@@ -1125,7 +1497,7 @@ int CeedOperatorCreateFDMElementInverse_Ref(CeedOperator op,
   ierr = CeedVectorGetArray(qdata, CEED_MEM_HOST, &qdataarray); CeedChk(ierr);
   for (CeedInt e=0; e<nelem; e++)
     for (CeedInt c=0; c<ncomp; c++)
-      for (CeedInt n=0; n<lsize; n++) {
+      for (CeedSize n=0; n<lsize; n++) {
         if (interp)
           qdataarray[(e*ncomp+c)*lsize+n] = 1;
         if (grad)
@@ -1185,33 +1557,236 @@ int CeedOperatorCreateFDMElementInverse_Ref(CeedOperator op,
 }
 
 //------------------------------------------------------------------------------
-// Operator Destroy
+// Invert Element Matrix
 //------------------------------------------------------------------------------
-static int CeedOperatorDestroy_Ref(CeedOperator op) {
+// Gauss-Jordan elimination with partial pivoting, in place on the row-major
+//   n x n matrix A
+static int CeedElementMatrixInvert_Ref(Ceed ceed, CeedInt n, CeedScalar *A,
+                                       CeedInt *pivots) {
+  for (CeedInt k=0; k<n; k++) {
+    // Pivot
+    CeedInt p = k;
+    for (CeedInt i=k+1; i<n; i++)
+      if (fabs(A[i*n+k]) > fabs(A[p*n+k]))
+        p = i;
+    if (A[p*n+k] == 0.0)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Element matrix is singular");
+    // LCOV_EXCL_STOP
+    pivots[k] = p;
+    if (p != k)
+      for (CeedInt j=0; j<n; j++) {
+        CeedScalar tmp = A[k*n+j];
+        A[k*n+j] = A[p*n+j];
+        A[p*n+j] = tmp;
+      }
+
+    // Eliminate
+    const CeedScalar pivinv = 1.0 / A[k*n+k];
+    A[k*n+k] = 1.0;
+    for (CeedInt j=0; j<n; j++)
+      A[k*n+j] *= pivinv;
+    for (CeedInt i=0; i<n; i++) {
+      if (i == k)
+        continue;
+      const CeedScalar f = A[i*n+k];
+      A[i*n+k] = 0.0;
+      for (CeedInt j=0; j<n; j++)
+        A[i*n+j] -= f * A[k*n+j];
+    }
+  }
+
+  // Undo row interchanges as column interchanges
+  for (CeedInt k=n-1; k>=0; k--)
+    if (pivots[k] != k)
+      for (CeedInt i=0; i<n; i++) {
+        CeedScalar tmp = A[i*n+k];
+        A[i*n+k] = A[i*n+pivots[k]];
+        A[i*n+pivots[k]] = tmp;
+      }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Create Element Block-Jacobi Inverse
+//------------------------------------------------------------------------------
+static int CeedOperatorCreateElementBlockJacobiInverse_Ref(CeedOperator op,
+    CeedOperator *blkinv, CeedRequest *request) {
   int ierr;
-  CeedOperator_Ref *impl;
-  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+
+  // Active restriction
+  CeedInt numemodein, numemodeout;
+  CeedEvalMode *emodein, *emodeout;
+  CeedBasis basisin, basisout;
+  CeedElemRestriction rstrin, rstrout;
+  ierr = CeedOperatorGetActiveEvalModes_Ref(op, true, &basisin, &rstrin,
+         &numemodein, &emodein); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveEvalModes_Ref(op, false, &basisout, &rstrout,
+         &numemodeout, &emodeout); CeedChk(ierr);
+  ierr = CeedFree(&emodein); CeedChk(ierr);
+  ierr = CeedFree(&emodeout); CeedChk(ierr);
+  if (rstrin != rstrout)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Element block-Jacobi inverse requires the same "
+                     "active input and output restriction");
+  // LCOV_EXCL_STOP
+  CeedInt nelem, elemsize, ncomp;
+  CeedSize lsize;
+  ierr = CeedElemRestrictionGetNumElements(rstrin, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrin, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrin, &ncomp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(rstrin, &lsize); CeedChk(ierr);
+
+  // Assemble element matrices
+  const CeedInt n = ncomp*elemsize, B = CEED_ELEMMAT_BLK_SIZE;
+  CeedScalar *mats;
+  ierr = CeedMalloc((CeedSize)nelem*n*n, &mats); CeedChk(ierr);
+  ierr = CeedSingleOperatorAssembleElementMatrices_Ref(op, 0, mats);
+  CeedChk(ierr);
 
-  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
-    ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
+  // Invert and interlace the element matrices of each block; padding
+  //   elements of the last block are left zero
+  CeedOperatorBlockJacobi_Ref *bj;
+  ierr = CeedCalloc(1, &bj); CeedChk(ierr);
+  bj->nblk = (nelem + B - 1) / B;
+  bj->esize = n;
+  ierr = CeedCalloc((CeedSize)bj->nblk*n*n*B, &bj->inv); CeedChk(ierr);
+  CeedInt *pivots;
+  ierr = CeedMalloc(n, &pivots); CeedChk(ierr);
+  for (CeedInt e=0; e<nelem; e++) {
+    CeedScalar *A = &mats[(CeedSize)e*n*n];
+    ierr = CeedElementMatrixInvert_Ref(ceed, n, A, pivots); CeedChk(ierr);
+    const CeedInt b = e / B, l = e % B;
+    for (CeedInt ij=0; ij<n*n; ij++)
+      bj->inv[((CeedSize)b*n*n + ij)*B + l] = A[ij];
+  }
+  ierr = CeedFree(&pivots); CeedChk(ierr);
+  ierr = CeedFree(&mats); CeedChk(ierr);
+
+  // Blocked restriction
+  bool strided, hasoffsets64;
+  ierr = CeedElemRestrictionIsStrided(rstrin, &strided); CeedChk(ierr);
+  ierr = CeedElemRestrictionHasOffsets64(rstrin, &hasoffsets64); CeedChk(ierr);
+  if (strided) {
+    bool backendstrides;
+    CeedInt strides[3] = {1, elemsize, elemsize*ncomp};
+    ierr = CeedElemRestrictionHasBackendStrides(rstrin, &backendstrides);
+    CeedChk(ierr);
+    if (!backendstrides) {
+      ierr = CeedElemRestrictionGetStrides(rstrin, &strides); CeedChk(ierr);
+    }
+    ierr = CeedElemRestrictionCreateBlockedStrided(ceed, nelem, elemsize, B,
+           ncomp, lsize, strides, &bj->rstr); CeedChk(ierr);
+  } else if (hasoffsets64) {
+    const CeedSize *offsets;
+    CeedInt compstride;
+    ierr = CeedElemRestrictionGetOffsets64(rstrin, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetCompStride(rstrin, &compstride); CeedChk(ierr);
+    ierr = CeedElemRestrictionCreateBlocked64(ceed, nelem, elemsize, B, ncomp,
+           compstride, lsize, CEED_MEM_HOST, CEED_COPY_VALUES, offsets,
+           &bj->rstr); CeedChk(ierr);
+    ierr = CeedElemRestrictionRestoreOffsets64(rstrin, &offsets); CeedChk(ierr);
+  } else {
+    const CeedInt *offsets;
+    CeedInt compstride;
+    ierr = CeedElemRestrictionGetOffsets(rstrin, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetCompStride(rstrin, &compstride); CeedChk(ierr);
+    ierr = CeedElemRestrictionCreateBlocked(ceed, nelem, elemsize, B, ncomp,
+                                            compstride, lsize, CEED_MEM_HOST,
+                                            CEED_COPY_VALUES, offsets,
+                                            &bj->rstr); CeedChk(ierr);
+    ierr = CeedElemRestrictionRestoreOffsets(rstrin, &offsets); CeedChk(ierr);
   }
-  ierr = CeedFree(&impl->evecs); CeedChk(ierr);
-  ierr = CeedFree(&impl->edata); CeedChk(ierr);
-  ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
+  ierr = CeedElemRestrictionCreateVector(bj->rstr, NULL, &bj->ein);
+  CeedChk(ierr);
+  ierr = CeedElemRestrictionCreateVector(bj->rstr, NULL, &bj->eout);
+  CeedChk(ierr);
+
+  // Operator with the same active fields; its application is replaced by the
+  //   block inverses
+  CeedQFunction qf;
+  ierr = CeedQFunctionCreateIdentity(ceed, ncomp, CEED_EVAL_INTERP,
+                                     CEED_EVAL_INTERP, &qf); CeedChk(ierr);
+  ierr = CeedOperatorCreate(ceed, qf, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                            blkinv); CeedChk(ierr);
+  ierr = CeedOperatorSetField(*blkinv, "input", rstrin, basisin,
+                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
+  ierr = CeedOperatorSetField(*blkinv, "output", rstrin, basisin,
+                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
+  ierr = CeedQFunctionDestroy(&qf); CeedChk(ierr);
+  CeedOperator_Ref *impl;
+  ierr = CeedOperatorGetData(*blkinv, &impl); CeedChk(ierr);
+  impl->blkjac = bj;
+
+  return 0;
+}
 
+//------------------------------------------------------------------------------
+// Operator Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedOperatorGetMemoryUsage_Ref(CeedOperator op, CeedSize *bytes) {
+  int ierr;
+  CeedOperator_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedSize vecbytes;
+
+  *bytes = 0;
+  if (impl->blkjac) {
+    CeedOperatorBlockJacobi_Ref *bj = impl->blkjac;
+    CeedInt blksize;
+    ierr = CeedElemRestrictionGetBlockSize(bj->rstr, &blksize); CeedChk(ierr);
+    *bytes += (CeedSize)bj->nblk*bj->esize*bj->esize*blksize*sizeof(CeedScalar);
+    ierr = CeedElemRestrictionGetMemoryUsage(bj->rstr, &vecbytes);
+    CeedChk(ierr);
+    *bytes += vecbytes;
+    ierr = CeedVectorGetMemoryUsage(bj->ein, &vecbytes); CeedChk(ierr);
+    *bytes += vecbytes;
+    ierr = CeedVectorGetMemoryUsage(bj->eout, &vecbytes); CeedChk(ierr);
+    *bytes += vecbytes;
+  }
   for (CeedInt i=0; i<impl->numein; i++) {
-    ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
-    ierr = CeedVectorDestroy(&impl->qvecsin[i]); CeedChk(ierr);
+    ierr = CeedVectorGetMemoryUsage(impl->evecsin[i], &vecbytes); CeedChk(ierr);
+    *bytes += vecbytes;
+    ierr = CeedVectorGetMemoryUsage(impl->qvecsin[i], &vecbytes); CeedChk(ierr);
+    *bytes += vecbytes;
+    ierr = CeedVectorGetMemoryUsage(impl->qvecsfused[i], &vecbytes);
+    CeedChk(ierr);
+    *bytes += vecbytes;
   }
-  ierr = CeedFree(&impl->evecsin); CeedChk(ierr);
-  ierr = CeedFree(&impl->qvecsin); CeedChk(ierr);
-
   for (CeedInt i=0; i<impl->numeout; i++) {
-    ierr = CeedVectorDestroy(&impl->evecsout[i]); CeedChk(ierr);
-    ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
+    ierr = CeedVectorGetMemoryUsage(impl->evecsout[i], &vecbytes);
+    CeedChk(ierr);
+    *bytes += vecbytes;
+    ierr = CeedVectorGetMemoryUsage(impl->qvecsout[i], &vecbytes);
+    CeedChk(ierr);
+    *bytes += vecbytes;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Ref(CeedOperator op) {
+  int ierr;
+  CeedOperator_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  if (impl->blkjac) {
+    ierr = CeedElemRestrictionDestroy(&impl->blkjac->rstr); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->blkjac->ein); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->blkjac->eout); CeedChk(ierr);
+    ierr = CeedFree(&impl->blkjac->inv); CeedChk(ierr);
+    ierr = CeedFree(&impl->blkjac); CeedChk(ierr);
   }
-  ierr = CeedFree(&impl->evecsout); CeedChk(ierr);
-  ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+
+  ierr = CeedFree(&impl->planin); CeedChk(ierr);
+  ierr = CeedFree(&impl->planout); CeedChk(ierr);
+
+  ierr = CeedOperatorDestroyScratch_Ref(impl); CeedChk(ierr);
 
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
@@ -1239,11 +1814,33 @@ int CeedOperatorCreate_Ref(CeedOperator op) {
                                 "LinearAssembleAddPointBlockDiagonal",
                                 CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSymbolic",
+                                CeedOperatorLinearAssembleSymbolic_Ref);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssemble",
+                                CeedOperatorLinearAssemble_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "AssembleElementMatrices",
+                                CeedOperatorAssembleElementMatrices_Ref);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "CreateFDMElementInverse",
                                 CeedOperatorCreateFDMElementInverse_Ref);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op,
+                                "CreateElementBlockJacobiInverse",
+                                CeedOperatorCreateElementBlockJacobiInverse_Ref);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Setup",
+                                CeedOperatorSetup_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "GetMemoryUsage",
+                                CeedOperatorGetMemoryUsage_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceCreate",
+                                CeedOperatorWorkspaceCreate_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceApplyAdd",
+                                CeedOperatorWorkspaceApplyAdd_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "WorkspaceDestroy",
+                                CeedOperatorWorkspaceDestroy_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Ref); CeedChk(ierr);
   return 0;
@@ -1263,6 +1860,14 @@ int CeedCompositeOperatorCreate_Ref(CeedOperator op) {
                                 "LinearAssembleAddPointBlockDiagonal",
                                 CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSymbolic",
+                                CeedOperatorLinearAssembleSymbolic_Ref);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssemble",
+                                CeedOperatorLinearAssemble_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "AssembleElementMatrices",
+                                CeedOperatorAssembleElementMatrices_Ref);
+  CeedChk(ierr);
   return 0;
 }
 //------------------------------------------------------------------------------
@@ -20,25 +20,160 @@
 #include <string.h>
 #include "ceed-ref.h"
 
+//------------------------------------------------------------------------------
+// L-vector and E-vector Entries of a Block
+//   Entries are listed in the order the transpose scatter visits them
+//------------------------------------------------------------------------------
+static inline CeedInt CeedElemRestrictionBlockIndices_Ref(
+  const CeedInt *offsets, const CeedInt strides[3], CeedInt nelem,
+  CeedInt elemsize, CeedInt blksize, CeedInt ncomp, CeedInt compstride,
+  CeedInt block, CeedInt *lindices, CeedInt *eindices) {
+  CeedInt count = 0;
+  const CeedInt e = block*blksize;
+  for (CeedInt k = 0; k < ncomp; k++)
+    for (CeedInt n = 0; n < elemsize; n++)
+      // Iteration bound set to discard padding elements
+      for (CeedInt j = 0; j < CeedIntMin(blksize, nelem-e); j++) {
+        lindices[count] = offsets ?
+                          offsets[n*blksize + j + e*elemsize] + k*compstride :
+                          n*strides[0] + k*strides[1] + (e+j)*strides[2];
+        eindices[count] = (k*elemsize + n)*blksize + j + e*elemsize*ncomp;
+        count++;
+      }
+  return count;
+}
+
+//------------------------------------------------------------------------------
+// Strides of a Strided ElemRestriction, Resolving Backend Strides
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionGetIndexStrides_Ref(CeedElemRestriction r,
+    CeedInt (*strides)[3]) {
+  int ierr;
+  bool isstrided, backendstrides = true;
+  ierr = CeedElemRestrictionIsStrided(r, &isstrided); CeedChk(ierr);
+  if (isstrided) {
+    ierr = CeedElemRestrictionHasBackendStrides(r, &backendstrides);
+    CeedChk(ierr);
+  }
+  if (backendstrides) {
+    // CPU backend strides are {1, elemsize, elemsize*ncomp}
+    CeedInt elemsize, ncomp;
+    ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
+    (*strides)[0] = 1;
+    (*strides)[1] = elemsize;
+    (*strides)[2] = elemsize*ncomp;
+  } else {
+    ierr = CeedElemRestrictionGetStrides(r, strides); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Build L-vector to E-vector Map
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionBuildTransposeMap_Ref(CeedElemRestriction r) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  CeedInt nelem, elemsize, numblk, blksize, ncomp, compstride;
+  CeedSize lsize;
+  ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumBlocks(r, &numblk); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(r, &blksize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+
+  // The map holds 32-bit L- and E-vector indices; larger restrictions
+  //   scatter in the transpose instead
+  if (impl->offsets64 || lsize > INT32_MAX ||
+      (CeedSize)numblk*blksize*elemsize*ncomp > INT32_MAX)
+    return 0;
+
+  CeedInt strides[3];
+  ierr = CeedElemRestrictionGetIndexStrides_Ref(r, &strides); CeedChk(ierr);
+  CeedInt *lindices, *eindices, numind;
+  ierr = CeedMalloc(blksize*elemsize*ncomp, &lindices); CeedChk(ierr);
+  ierr = CeedMalloc(blksize*elemsize*ncomp, &eindices); CeedChk(ierr);
+
+  // Count E-vector entries contributing to each L-vector entry
+  ierr = CeedCalloc(lsize+1, &impl->ltoeoffsets); CeedChk(ierr);
+  for (CeedInt b = 0; b < numblk; b++) {
+    numind = CeedElemRestrictionBlockIndices_Ref(impl->offsets, strides, nelem,
+             elemsize, blksize, ncomp, compstride, b, lindices, eindices);
+    for (CeedInt i = 0; i < numind; i++)
+      impl->ltoeoffsets[lindices[i]+1]++;
+  }
+  for (CeedInt l = 0; l < lsize; l++)
+    impl->ltoeoffsets[l+1] += impl->ltoeoffsets[l];
+
+  // Fill, shifting offsets forward, then restore offsets
+  ierr = CeedMalloc(impl->ltoeoffsets[lsize], &impl->ltoeindices);
+  CeedChk(ierr);
+  for (CeedInt b = 0; b < numblk; b++) {
+    numind = CeedElemRestrictionBlockIndices_Ref(impl->offsets, strides, nelem,
+             elemsize, blksize, ncomp, compstride, b, lindices, eindices);
+    for (CeedInt i = 0; i < numind; i++)
+      impl->ltoeindices[impl->ltoeoffsets[lindices[i]]++] = eindices[i];
+  }
+  for (CeedInt l = lsize; l > 0; l--)
+    impl->ltoeoffsets[l] = impl->ltoeoffsets[l-1];
+  impl->ltoeoffsets[0] = 0;
+
+  // The gather visits every L-vector entry, so restrictions touching few of
+  //   them, such as boundary faces, keep the scatter
+  impl->ltoegather = impl->ltoeoffsets[lsize] >= lsize;
+
+  ierr = CeedFree(&lindices); CeedChk(ierr);
+  ierr = CeedFree(&eindices); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Setup L-vector to E-vector Map
+//------------------------------------------------------------------------------
+// The map is built on first use, so restrictions that are never transposed
+//   do not pay for it. The restriction may be shared by operators applied
+//   concurrently, so the first caller builds the map under a lock.
+int CeedElemRestrictionSetupTransposeMap_Ref(CeedElemRestriction r) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+
+  if (CeedAtomicLoad(impl->ltoeready))
+    return 0;
+  CeedSpinLock(impl->ltoelock);
+  ierr = 0;
+  if (!impl->ltoeready) {
+    ierr = CeedElemRestrictionBuildTransposeMap_Ref(r);
+    if (!ierr)
+      CeedAtomicStore(impl->ltoeready, true);
+  }
+  CeedSpinUnlock(impl->ltoelock);
+  CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Core ElemRestriction Apply Code
 //------------------------------------------------------------------------------
 static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   int ierr;
   CeedElemRestriction_Ref *impl;
   ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
-  const CeedScalar *uu;
-  CeedScalar *vv;
-  CeedInt nelem, elemsize, voffset;
+  CeedInt nelem, elemsize, numblk;
   ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
   ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
-  voffset = start*blksize*elemsize*ncomp;
+  ierr = CeedElemRestrictionGetNumBlocks(r, &numblk); CeedChk(ierr);
+  // Offsets are 32-bit, but L- and E-vector positions are computed in
+  //   CeedSize, as full vectors may exceed the range of CeedInt
+  const CeedSize voffset = (CeedSize)start*blksize*elemsize*ncomp;
 
-  ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uu); CeedChk(ierr);
-  ierr = CeedVectorGetArray(v, CEED_MEM_HOST, &vv); CeedChk(ierr);
   // Restriction from L-vector to E-vector
   // Perform: v = r * u
   if (tmode == CEED_NOTRANSPOSE) {
@@ -50,7 +185,7 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
       if (backendstrides) {
         // CPU backend strides are {1, elemsize, elemsize*ncomp}
         // This if branch is left separate to allow better inlining
-        for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize)
+        for (CeedSize e = start*blksize; e < stop*blksize; e+=blksize)
           CeedPragmaSIMD
           for (CeedInt k = 0; k < ncomp; k++)
             CeedPragmaSIMD
@@ -59,12 +194,12 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
               for (CeedInt j = 0; j < blksize; j++)
                 vv[e*elemsize*ncomp + (k*elemsize+n)*blksize + j - voffset]
                   = uu[n + k*elemsize +
-                         CeedIntMin(e+j, nelem-1)*elemsize*ncomp];
+                         (CeedSize)CeedIntMin(e+j, nelem-1)*elemsize*ncomp];
       } else {
         // User provided strides
         CeedInt strides[3];
         ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
-        for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize)
+        for (CeedSize e = start*blksize; e < stop*blksize; e+=blksize)
           CeedPragmaSIMD
           for (CeedInt k = 0; k < ncomp; k++)
             CeedPragmaSIMD
@@ -73,19 +208,19 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
               for (CeedInt j = 0; j < blksize; j++)
                 vv[e*elemsize*ncomp + (k*elemsize+n)*blksize + j - voffset]
                   = uu[n*strides[0] + k*strides[1] +
-                                    CeedIntMin(e+j, nelem-1)*strides[2]];
+                       (CeedSize)CeedIntMin(e+j, nelem-1)*strides[2]];
       }
     } else {
       // Offsets provided, standard or blocked restriction
       // vv has shape [elemsize, ncomp, nelem], row-major
       // uu has shape [nnodes, ncomp]
-      for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize)
+      for (CeedSize e = start*blksize; e < stop*blksize; e+=blksize)
         CeedPragmaSIMD
         for (CeedInt k = 0; k < ncomp; k++)
           CeedPragmaSIMD
           for (CeedInt i = 0; i < elemsize*blksize; i++)
             vv[elemsize*(k*blksize+ncomp*e) + i - voffset]
-              = uu[impl->offsets[i+elemsize*e] + k*compstride];
+              = uu[impl->offsets[i+elemsize*e] + (CeedSize)k*compstride];
     }
   } else {
     // Restriction from E-vector to L-vector
@@ -98,7 +233,7 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
       if (backendstrides) {
         // CPU backend strides are {1, elemsize, elemsize*ncomp}
         // This if brach is left separate to allow better inlining
-        for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize)
+        for (CeedSize e = start*blksize; e < stop*blksize; e+=blksize)
           CeedPragmaSIMD
           for (CeedInt k = 0; k < ncomp; k++)
             CeedPragmaSIMD
@@ -111,7 +246,7 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
         // User provided strides
         CeedInt strides[3];
         ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
-        for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize)
+        for (CeedSize e = start*blksize; e < stop*blksize; e+=blksize)
           CeedPragmaSIMD
           for (CeedInt k = 0; k < ncomp; k++)
             CeedPragmaSIMD
@@ -121,23 +256,32 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
                 vv[n*strides[0] + k*strides[1] + (e+j)*strides[2]]
                 += uu[e*elemsize*ncomp + (k*elemsize+n)*blksize + j - voffset];
       }
+    } else if (start == 0 && stop == numblk &&
+               CeedAtomicLoad(impl->ltoeready) && impl->ltoegather) {
+      // Offsets provided, full restriction
+      // Gather the E-vector entries contributing to each L-vector entry,
+      //   summed in the same order as the scatter below
+      CeedSize lsize;
+      ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+      for (CeedSize l = 0; l < lsize; l++) {
+        CeedScalar vl = vv[l];
+        for (CeedInt j = impl->ltoeoffsets[l]; j < impl->ltoeoffsets[l+1]; j++)
+          vl += uu[impl->ltoeindices[j]];
+        vv[l] = vl;
+      }
     } else {
       // Offsets provided, standard or blocked restriction
       // uu has shape [elemsize, ncomp, nelem]
       // vv has shape [nnodes, ncomp]
-      for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize)
+      for (CeedSize e = start*blksize; e < stop*blksize; e+=blksize)
         for (CeedInt k = 0; k < ncomp; k++)
           for (CeedInt i = 0; i < elemsize*blksize; i+=blksize)
             // Iteration bound set to discard padding elements
             for (CeedInt j = i; j < i+CeedIntMin(blksize, nelem-e); j++)
-              vv[impl->offsets[j+e*elemsize] + k*compstride]
+              vv[impl->offsets[j+e*elemsize] + (CeedSize)k*compstride]
               += uu[elemsize*(k*blksize+ncomp*e) + j - voffset];
     }
   }
-  ierr = CeedVectorRestoreArrayRead(u, &uu); CeedChk(ierr);
-  ierr = CeedVectorRestoreArray(v, &vv); CeedChk(ierr);
-  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
-    *request = NULL;
   return 0;
 }
 
@@ -146,110 +290,150 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
 //------------------------------------------------------------------------------
 static int CeedElemRestrictionApply_Ref_110(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 1, 1, compstride, start, stop,
-         tmode, u, v, request);
+         tmode, uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_111(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 1, 1, 1, start, stop, tmode,
-         u, v, request);
+         uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_180(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 1, 8, compstride, start, stop,
-         tmode, u, v, request);
+         tmode, uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_181(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 1, 8, 1, start, stop, tmode,
-         u, v, request);
+         uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_310(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 3, 1, compstride, start, stop,
-         tmode, u, v, request);
+         tmode, uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_311(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 3, 1, 1, start, stop, tmode,
-         u, v, request);
+         uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_380(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 3, 8, compstride, start, stop,
-         tmode, u, v, request);
+         tmode, uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_381(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 3, 8, 1, start, stop, tmode,
-         u, v, request);
+         uu, vv);
 }
 
 // LCOV_EXCL_START
 static int CeedElemRestrictionApply_Ref_510(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 5, 1, compstride, start, stop,
-         tmode, u, v, request);
+         tmode, uu, vv);
 }
 // LCOV_EXCL_STOP
 
 static int CeedElemRestrictionApply_Ref_511(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 5, 1, 1, start, stop, tmode,
-         u, v, request);
+         uu, vv);
 }
 
 // LCOV_EXCL_START
 static int CeedElemRestrictionApply_Ref_580(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 5, 8, compstride, start, stop,
-         tmode, u, v, request);
+         tmode, uu, vv);
 }
 // LCOV_EXCL_STOP
 
 static int CeedElemRestrictionApply_Ref_581(CeedElemRestriction r,
     const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
   return CeedElemRestrictionApply_Ref_Core(r, 5, 8, 1, start, stop, tmode,
-         u, v, request);
+         uu, vv);
 }
 
 //------------------------------------------------------------------------------
-// ElemRestriction Apply
+// ElemRestriction Apply - 64-bit Offsets
 //------------------------------------------------------------------------------
-static int CeedElemRestrictionApply_Ref(CeedElemRestriction r,
-                                        CeedTransposeMode tmode, CeedVector u,
-                                        CeedVector v, CeedRequest *request) {
+static int CeedElemRestrictionApply64_Ref(CeedElemRestriction r,
+    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode,
+    const CeedScalar *uu, CeedScalar *vv) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  CeedInt nelem, elemsize;
+  ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  const CeedSize *offsets = impl->offsets64;
+  const CeedSize voffset = (CeedSize)start*blksize*elemsize*ncomp;
+
+  if (tmode == CEED_NOTRANSPOSE) {
+    // vv has shape [elemsize, ncomp, nelem], row-major
+    // uu has shape [nnodes, ncomp]
+    for (CeedSize e = start*blksize; e < stop*blksize; e+=blksize)
+      CeedPragmaSIMD
+      for (CeedInt k = 0; k < ncomp; k++)
+        CeedPragmaSIMD
+        for (CeedInt i = 0; i < elemsize*blksize; i++)
+          vv[elemsize*(k*blksize+ncomp*e) + i - voffset]
+            = uu[offsets[i+elemsize*e] + (CeedSize)k*compstride];
+  } else {
+    // uu has shape [elemsize, ncomp, nelem]
+    // vv has shape [nnodes, ncomp]
+    for (CeedSize e = start*blksize; e < stop*blksize; e+=blksize)
+      for (CeedInt k = 0; k < ncomp; k++)
+        for (CeedInt i = 0; i < elemsize*blksize; i+=blksize)
+          // Iteration bound set to discard padding elements
+          for (CeedInt j = i; j < i+CeedIntMin(blksize, nelem-e); j++)
+            vv[offsets[j+elemsize*e] + (CeedSize)k*compstride]
+            += uu[elemsize*(k*blksize+ncomp*e) + j - voffset];
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Apply to Vectors
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApplyVectors_Ref(CeedElemRestriction r,
+    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
+    CeedVector v, CeedRequest *request) {
   int ierr;
   CeedInt numblk, blksize, ncomp, compstride;
   ierr = CeedElemRestrictionGetNumBlocks(r, &numblk); CeedChk(ierr);
@@ -259,8 +443,35 @@ static int CeedElemRestrictionApply_Ref(CeedElemRestriction r,
   CeedElemRestriction_Ref *impl;
   ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
 
-  return impl->Apply(r, ncomp, blksize, compstride, 0, numblk, tmode, u, v,
-                     request);
+  if (tmode == CEED_TRANSPOSE && impl->offsets && start == 0 &&
+      stop == numblk) {
+    ierr = CeedElemRestrictionSetupTransposeMap_Ref(r); CeedChk(ierr);
+  }
+
+  const CeedScalar *uu;
+  CeedScalar *vv;
+  ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uu); CeedChk(ierr);
+  ierr = CeedVectorGetArray(v, CEED_MEM_HOST, &vv); CeedChk(ierr);
+  ierr = impl->Apply(r, ncomp, blksize, compstride, start, stop, tmode, uu,
+                     vv); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(u, &uu); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(v, &vv); CeedChk(ierr);
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Apply
+//------------------------------------------------------------------------------
+int CeedElemRestrictionApply_Ref(CeedElemRestriction r,
+                                 CeedTransposeMode tmode, CeedVector u,
+                                 CeedVector v, CeedRequest *request) {
+  int ierr;
+  CeedInt numblk;
+  ierr = CeedElemRestrictionGetNumBlocks(r, &numblk); CeedChk(ierr);
+  return CeedElemRestrictionApplyVectors_Ref(r, 0, numblk, tmode, u, v,
+         request);
 }
 
 //------------------------------------------------------------------------------
@@ -269,16 +480,8 @@ static int CeedElemRestrictionApply_Ref(CeedElemRestriction r,
 static int CeedElemRestrictionApplyBlock_Ref(CeedElemRestriction r,
     CeedInt block, CeedTransposeMode tmode, CeedVector u, CeedVector v,
     CeedRequest *request) {
-  int ierr;
-  CeedInt blksize, ncomp, compstride;
-  ierr = CeedElemRestrictionGetBlockSize(r, &blksize); CeedChk(ierr);
-  ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
-  ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
-  CeedElemRestriction_Ref *impl;
-  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
-
-  return impl->Apply(r, ncomp, blksize, compstride, block, block+1, tmode, u, v,
-                     request);
+  return CeedElemRestrictionApplyVectors_Ref(r, block, block+1, tmode, u, v,
+         request);
 }
 
 //------------------------------------------------------------------------------
@@ -301,6 +504,193 @@ static int CeedElemRestrictionGetOffsets_Ref(CeedElemRestriction rstr,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Get 64-bit Offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionGetOffsets64_Ref(CeedElemRestriction rstr,
+    CeedMemType mtype, const CeedSize **offsets) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(rstr, &impl); CeedChk(ierr);
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(rstr, &ceed); CeedChk(ierr);
+
+  if (mtype != CEED_MEM_HOST)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Can only provide to HOST memory");
+  // LCOV_EXCL_STOP
+
+  *offsets = impl->offsets64;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Setup Coloring
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionSetupColoring_Ref(CeedElemRestriction r) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  CeedInt nelem, elemsize, numblk, blksize, ncomp, compstride;
+  ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumBlocks(r, &numblk); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(r, &blksize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+  CeedInt strides[3];
+  ierr = CeedElemRestrictionGetIndexStrides_Ref(r, &strides); CeedChk(ierr);
+  const CeedInt blklen = blksize*elemsize*ncomp;
+  CeedInt *lindices, *eindices, *blkcolor, *forbidden, numind;
+
+  // Blocks sharing an L-vector entry are found through the transpose map
+  ierr = CeedElemRestrictionSetupTransposeMap_Ref(r); CeedChk(ierr);
+  if (!impl->ltoeoffsets) {
+    // Too large for the 32-bit map, give each block its own color
+    impl->numcolors = numblk;
+    ierr = CeedMalloc(numblk+1, &impl->coloroffsets); CeedChk(ierr);
+    ierr = CeedMalloc(numblk, &impl->colorblks); CeedChk(ierr);
+    for (CeedInt b = 0; b <= numblk; b++)
+      impl->coloroffsets[b] = b;
+    for (CeedInt b = 0; b < numblk; b++)
+      impl->colorblks[b] = b;
+    return 0;
+  }
+  const CeedInt *ltoeoffsets = impl->ltoeoffsets;
+  const CeedInt *ltoeindices = impl->ltoeindices;
+
+  // Greedy coloring, smallest color not used by a block sharing an entry
+  ierr = CeedMalloc(blklen, &lindices); CeedChk(ierr);
+  ierr = CeedMalloc(blklen, &eindices); CeedChk(ierr);
+  ierr = CeedMalloc(numblk, &blkcolor); CeedChk(ierr);
+  ierr = CeedMalloc(numblk+1, &forbidden); CeedChk(ierr);
+  for (CeedInt b = 0; b < numblk; b++) {
+    blkcolor[b] = -1;
+    forbidden[b] = -1;
+  }
+  impl->numcolors = 0;
+  for (CeedInt b = 0; b < numblk; b++) {
+    numind = CeedElemRestrictionBlockIndices_Ref(impl->offsets, strides, nelem,
+             elemsize, blksize, ncomp, compstride, b, lindices, eindices);
+    for (CeedInt i = 0; i < numind; i++)
+      for (CeedInt j = ltoeoffsets[lindices[i]];
+           j < ltoeoffsets[lindices[i]+1]; j++)
+        if (blkcolor[ltoeindices[j]/blklen] >= 0)
+          forbidden[blkcolor[ltoeindices[j]/blklen]] = b;
+    CeedInt c = 0;
+    while (forbidden[c] == b) c++;
+    blkcolor[b] = c;
+    impl->numcolors = CeedIntMax(impl->numcolors, c+1);
+  }
+
+  // Group blocks by color
+  ierr = CeedCalloc(impl->numcolors+1, &impl->coloroffsets); CeedChk(ierr);
+  ierr = CeedMalloc(numblk, &impl->colorblks); CeedChk(ierr);
+  for (CeedInt b = 0; b < numblk; b++)
+    impl->coloroffsets[blkcolor[b]+1]++;
+  for (CeedInt c = 0; c < impl->numcolors; c++) {
+    impl->coloroffsets[c+1] += impl->coloroffsets[c];
+    forbidden[c] = impl->coloroffsets[c];
+  }
+  for (CeedInt b = 0; b < numblk; b++)
+    impl->colorblks[forbidden[blkcolor[b]]++] = b;
+
+  ierr = CeedFree(&lindices); CeedChk(ierr);
+  ierr = CeedFree(&eindices); CeedChk(ierr);
+  ierr = CeedFree(&blkcolor); CeedChk(ierr);
+  ierr = CeedFree(&forbidden); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Get Coloring
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionGetColoring_Ref(CeedElemRestriction r,
+    CeedInt *numcolors, const CeedInt **coloroffsets,
+    const CeedInt **colorblks) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+
+  // Coloring is built on first request and kept for the restriction lifetime;
+  //   operators applied concurrently may share the restriction, so the first
+  //   caller builds it under a lock and publishes it with the ready flag
+  if (!CeedAtomicLoad(impl->colorready)) {
+    CeedSpinLock(impl->colorlock);
+    ierr = 0;
+    if (!impl->colorready) {
+      ierr = CeedElemRestrictionSetupColoring_Ref(r);
+      if (!ierr)
+        CeedAtomicStore(impl->colorready, true);
+    }
+    CeedSpinUnlock(impl->colorlock);
+    CeedChk(ierr);
+  }
+  *numcolors = impl->numcolors;
+  *coloroffsets = impl->coloroffsets;
+  *colorblks = impl->colorblks;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Get Multiplicity
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionGetMultiplicity_Ref(CeedElemRestriction r,
+    CeedVector mult) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  CeedSize lsize;
+  ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+
+  ierr = CeedElemRestrictionSetupTransposeMap_Ref(r); CeedChk(ierr);
+  if (!impl->ltoeoffsets) {
+    // Too large for the 32-bit map, accumulate ones in the transpose
+    CeedVector evec;
+    ierr = CeedElemRestrictionCreateVector(r, NULL, &evec); CeedChk(ierr);
+    ierr = CeedVectorSetValue(evec, 1.0); CeedChk(ierr);
+    ierr = CeedVectorSetValue(mult, 0.0); CeedChk(ierr);
+    ierr = CeedElemRestrictionApply(r, CEED_TRANSPOSE, evec, mult,
+                                    CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&evec); CeedChk(ierr);
+    return 0;
+  }
+  CeedScalar *multarray;
+  ierr = CeedVectorGetArray(mult, CEED_MEM_HOST, &multarray); CeedChk(ierr);
+  for (CeedSize l = 0; l < lsize; l++)
+    multarray[l] = impl->ltoeoffsets[l+1] - impl->ltoeoffsets[l];
+  ierr = CeedVectorRestoreArray(mult, &multarray); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionGetMemoryUsage_Ref(CeedElemRestriction r,
+    CeedSize *bytes) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  CeedInt numblk, blksize, elemsize;
+  ierr = CeedElemRestrictionGetNumBlocks(r, &numblk); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(r, &blksize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  CeedSize lsize, entries = 0;
+  ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+
+  if (impl->offsets_allocated)
+    entries += (CeedSize)numblk*blksize*elemsize;
+  if (impl->offsets64_allocated)
+    entries += (CeedSize)numblk*blksize*elemsize*
+               (sizeof(CeedSize)/sizeof(CeedInt));
+  if (CeedAtomicLoad(impl->ltoeready) && impl->ltoeoffsets)
+    entries += lsize + 1 + impl->ltoeoffsets[lsize];
+  if (CeedAtomicLoad(impl->colorready))
+    entries += impl->numcolors + 1 + numblk;
+  *bytes = entries*(CeedSize)sizeof(CeedInt);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Destroy
 //------------------------------------------------------------------------------
@@ -310,16 +700,21 @@ static int CeedElemRestrictionDestroy_Ref(CeedElemRestriction r) {
   ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
 
   ierr = CeedFree(&impl->offsets_allocated); CeedChk(ierr);
+  ierr = CeedFree(&impl->offsets64_allocated); CeedChk(ierr);
+  ierr = CeedFree(&impl->ltoeoffsets); CeedChk(ierr);
+  ierr = CeedFree(&impl->ltoeindices); CeedChk(ierr);
+  ierr = CeedFree(&impl->coloroffsets); CeedChk(ierr);
+  ierr = CeedFree(&impl->colorblks); CeedChk(ierr);
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// ElemRestriction Create
+// ElemRestriction Create, from either 32-bit or 64-bit offsets
 //------------------------------------------------------------------------------
-int CeedElemRestrictionCreate_Ref(CeedMemType mtype, CeedCopyMode cmode,
-                                  const CeedInt *offsets,
-                                  CeedElemRestriction r) {
+static int CeedElemRestrictionCreateCore_Ref(CeedMemType mtype,
+    CeedCopyMode cmode, const CeedInt *offsets, const CeedSize *offsets64,
+    CeedElemRestriction r) {
   int ierr;
   CeedElemRestriction_Ref *impl;
   CeedInt nelem, elemsize, numblk, blksize, ncomp, compstride;
@@ -354,38 +749,59 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mtype, CeedCopyMode cmode,
         || !strcmp(resource, "/cpu/self/ref/blocked")
         || !strcmp(resource, "/cpu/self/memcheck/serial")
         || !strcmp(resource, "/cpu/self/memcheck/blocked")) {
-      CeedInt lsize;
+      CeedSize lsize;
       ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
 
-      for (CeedInt i = 0; i < nelem*elemsize; i++)
-        if (offsets[i] < 0 || lsize <= offsets[i] + (ncomp - 1) * compstride)
+      for (CeedSize i = 0; i < (CeedSize)nelem*elemsize; i++) {
+        const CeedSize offset = offsets64 ? offsets64[i] : offsets[i];
+        if (offset < 0 || lsize <= offset + (CeedSize)(ncomp - 1) * compstride)
           // LCOV_EXCL_START
-          return CeedError(ceed, 1, "Restriction offset %d (%d) out of range "
-                           "[0, %d]", i, offsets[i], lsize);
-      // LCOV_EXCL_STOP
+          return CeedError(ceed, 1, "Restriction offset %ld (%ld) out of range "
+                           "[0, %ld]", (long)i, (long)offset, (long)lsize);
+        // LCOV_EXCL_STOP
+      }
     }
 
     // Copy data
-    switch (cmode) {
-    case CEED_COPY_VALUES:
-      ierr = CeedMalloc(nelem*elemsize, &impl->offsets_allocated);
-      CeedChk(ierr);
-      memcpy(impl->offsets_allocated, offsets,
-             nelem * elemsize * sizeof(offsets[0]));
-      impl->offsets = impl->offsets_allocated;
-      break;
-    case CEED_OWN_POINTER:
-      impl->offsets_allocated = (CeedInt *)offsets;
-      impl->offsets = impl->offsets_allocated;
-      break;
-    case CEED_USE_POINTER:
-      impl->offsets = offsets;
+    if (offsets64) {
+      switch (cmode) {
+      case CEED_COPY_VALUES:
+        ierr = CeedMalloc((CeedSize)nelem*elemsize, &impl->offsets64_allocated);
+        CeedChk(ierr);
+        memcpy(impl->offsets64_allocated, offsets64,
+               (CeedSize)nelem * elemsize * sizeof(offsets64[0]));
+        impl->offsets64 = impl->offsets64_allocated;
+        break;
+      case CEED_OWN_POINTER:
+        impl->offsets64_allocated = (CeedSize *)offsets64;
+        impl->offsets64 = impl->offsets64_allocated;
+        break;
+      case CEED_USE_POINTER:
+        impl->offsets64 = offsets64;
+      }
+    } else {
+      switch (cmode) {
+      case CEED_COPY_VALUES:
+        ierr = CeedMalloc(nelem*elemsize, &impl->offsets_allocated);
+        CeedChk(ierr);
+        memcpy(impl->offsets_allocated, offsets,
+               nelem * elemsize * sizeof(offsets[0]));
+        impl->offsets = impl->offsets_allocated;
+        break;
+      case CEED_OWN_POINTER:
+        impl->offsets_allocated = (CeedInt *)offsets;
+        impl->offsets = impl->offsets_allocated;
+        break;
+      case CEED_USE_POINTER:
+        impl->offsets = offsets;
+      }
     }
   }
 
   ierr = CeedElemRestrictionSetData(r, impl); CeedChk(ierr);
   CeedInt layout[3] = {1, elemsize, elemsize*ncomp};
   ierr = CeedElemRestrictionSetELayout(r, layout); CeedChk(ierr);
+
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Apply",
                                 CeedElemRestrictionApply_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "ApplyBlock",
@@ -394,9 +810,26 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mtype, CeedCopyMode cmode,
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetOffsets",
                                 CeedElemRestrictionGetOffsets_Ref);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetColoring",
+                                CeedElemRestrictionGetColoring_Ref);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetMultiplicity",
+                                CeedElemRestrictionGetMultiplicity_Ref);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetMemoryUsage",
+                                CeedElemRestrictionGetMemoryUsage_Ref);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Destroy",
                                 CeedElemRestrictionDestroy_Ref); CeedChk(ierr);
 
+  if (offsets64) {
+    ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetOffsets64",
+                                  CeedElemRestrictionGetOffsets64_Ref);
+    CeedChk(ierr);
+    impl->Apply = CeedElemRestrictionApply64_Ref;
+    return 0;
+  }
+
   // Set apply function based upon ncomp, blksize, and compstride
   CeedInt idx = -1;
   if (blksize < 10)
@@ -449,4 +882,22 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mtype, CeedCopyMode cmode,
 
   return 0;
 }
+
+//------------------------------------------------------------------------------
+// ElemRestriction Create
+//------------------------------------------------------------------------------
+int CeedElemRestrictionCreate_Ref(CeedMemType mtype, CeedCopyMode cmode,
+                                  const CeedInt *offsets,
+                                  CeedElemRestriction r) {
+  return CeedElemRestrictionCreateCore_Ref(mtype, cmode, offsets, NULL, r);
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Create with 64-bit Offsets
+//------------------------------------------------------------------------------
+int CeedElemRestrictionCreate64_Ref(CeedMemType mtype, CeedCopyMode cmode,
+                                    const CeedSize *offsets,
+                                    CeedElemRestriction r) {
+  return CeedElemRestrictionCreateCore_Ref(mtype, cmode, NULL, offsets, r);
+}
 //------------------------------------------------------------------------------
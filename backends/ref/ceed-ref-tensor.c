@@ -16,17 +16,22 @@
 
 #include <ceed.h>
 #include <ceed-backend.h>
+#include <math.h>
+#include <stdbool.h>
 #include "ceed-ref.h"
 
+// Smallest 1D size for which the even-odd decomposition is used
+#ifndef CEED_EVENODD_MIN_SIZE
+#  define CEED_EVENODD_MIN_SIZE 4
+#endif
+
 //------------------------------------------------------------------------------
-// Tensor Contract Apply
+// Tensor Contract Apply Generic
 //------------------------------------------------------------------------------
-int CeedTensorContractApply_Ref(CeedTensorContract contract, CeedInt A,
-                                CeedInt B, CeedInt C, CeedInt J,
-                                const CeedScalar *restrict t,
-                                CeedTransposeMode tmode, const CeedInt Add,
-                                const CeedScalar *restrict u,
-                                CeedScalar *restrict v) {
+static int CeedTensorContractApplyGeneric_Ref(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
   CeedInt tstride0 = B, tstride1 = 1;
   if (tmode == CEED_TRANSPOSE) {
     tstride0 = 1; tstride1 = J;
@@ -46,10 +51,226 @@ int CeedTensorContractApply_Ref(CeedTensorContract contract, CeedInt A,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Apply GEMM
+//------------------------------------------------------------------------------
+// Non-tensor bases contract the full interpolation or gradient matrix with
+//   each component of the element batch, v_a = t u_a for a J x B matrix t and
+//   B x C blocks u_a; four rows of v_a are updated per pass over u_a so each
+//   entry of u_a is loaded once for four multiply-adds
+static int CeedTensorContractApplyGemm_Ref(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  CeedInt tstride0 = B, tstride1 = 1;
+  if (tmode == CEED_TRANSPOSE) {
+    tstride0 = 1; tstride1 = J;
+  }
+
+  if (!Add)
+    for (CeedInt q=0; q<A*J*C; q++)
+      v[q] = (CeedScalar) 0.0;
+
+  for (CeedInt a=0; a<A; a++) {
+    const CeedScalar *restrict ua = &u[a*B*C];
+    CeedInt j = 0;
+    for (; j+4<=J; j+=4) {
+      CeedScalar *restrict v0 = &v[(a*J+j)*C], *restrict v1 = v0 + C,
+                  *restrict v2 = v1 + C, *restrict v3 = v2 + C;
+      for (CeedInt b=0; b<B; b++) {
+        const CeedScalar t0 = t[(j+0)*tstride0 + b*tstride1],
+                         t1 = t[(j+1)*tstride0 + b*tstride1],
+                         t2 = t[(j+2)*tstride0 + b*tstride1],
+                         t3 = t[(j+3)*tstride0 + b*tstride1];
+        const CeedScalar *restrict ub = &ua[b*C];
+        CeedPragmaSIMD
+        for (CeedInt c=0; c<C; c++) {
+          v0[c] += t0 * ub[c];
+          v1[c] += t1 * ub[c];
+          v2[c] += t2 * ub[c];
+          v3[c] += t3 * ub[c];
+        }
+      }
+    }
+    for (; j<J; j++) {
+      CeedScalar *restrict vj = &v[(a*J+j)*C];
+      for (CeedInt b=0; b<B; b++) {
+        const CeedScalar tq = t[j*tstride0 + b*tstride1];
+        CeedPragmaSIMD
+        for (CeedInt c=0; c<C; c++)
+          vj[c] += tq * ua[b*C+c];
+      }
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply Even-Odd
+//------------------------------------------------------------------------------
+// Centro-symmetric (sign 1) or centro-antisymmetric (sign -1) 1D matrices,
+//   t[J-1-j][B-1-b] = sign t[j][b], are applied by folding u into even and
+//   odd parts and contracting each with a half size matrix, roughly halving
+//   the FLOPs
+static int CeedTensorContractApplyEvenOdd_Ref(CeedTensorContract contract,
+    CeedTensorContract_Ref *impl, const CeedTensorContractEvenOdd_Ref *eo,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, CeedTransposeMode tmode,
+    const CeedInt Add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  int ierr;
+  const CeedInt Bh = (B+1)/2, Bo = B/2, Jh = (J+1)/2;
+  const CeedScalar sign = eo->sign;
+  const size_t usize = CeedWorkspaceAlign_Ref((size_t)A*Bh*C),
+               vsize = CeedWorkspaceAlign_Ref((size_t)A*Jh*C);
+  CeedWorkspace_Ref *work;
+  ierr = CeedWorkspaceGet_Ref(&impl->work, 2*usize + 2*vsize, &work);
+  CeedChk(ierr);
+  CeedScalar *ue = work->array, *uo = ue + usize, *ve = uo + usize,
+              *vo = ve + vsize;
+
+  // Fold input into even and odd parts
+  for (CeedInt a=0; a<A; a++) {
+    for (CeedInt b=0; b<Bo; b++) {
+      CeedPragmaSIMD
+      for (CeedInt c=0; c<C; c++) {
+        const CeedScalar u0 = u[(a*B+b)*C+c], u1 = u[(a*B+B-1-b)*C+c];
+        ue[(a*Bh+b)*C+c] = u0 + u1;
+        uo[(a*Bo+b)*C+c] = u0 - u1;
+      }
+    }
+    if (B%2) {
+      CeedPragmaSIMD
+      for (CeedInt c=0; c<C; c++)
+        ue[(a*Bh+Bo)*C+c] = u[(a*B+Bo)*C+c];
+    }
+  }
+
+  // Half size contractions
+  ierr = CeedTensorContractApplyGeneric_Ref(contract, A, Bh, C, Jh,
+         eo->even[tmode], CEED_NOTRANSPOSE, false, ue, ve);
+  CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
+  ierr = CeedTensorContractApplyGeneric_Ref(contract, A, Bo, C, Jh,
+         eo->odd[tmode], CEED_NOTRANSPOSE, false, uo, vo);
+  CeedWorkspaceChk_Ref(ierr, &impl->work, &work);
+
+  // Unfold output
+  for (CeedInt a=0; a<A; a++)
+    for (CeedInt j=0; j<Jh; j++) {
+      CeedScalar *v0 = &v[(a*J+j)*C], *v1 = &v[(a*J+J-1-j)*C];
+      const CeedScalar *e = &ve[(a*Jh+j)*C], *o = &vo[(a*Jh+j)*C];
+      if (!Add) {
+        CeedPragmaSIMD
+        for (CeedInt c=0; c<C; c++)
+          v0[c] = v1[c] = 0.0;
+      }
+      if (v0 == v1) {
+        // Middle row, the other part vanishes
+        CeedPragmaSIMD
+        for (CeedInt c=0; c<C; c++)
+          v0[c] += e[c] + o[c];
+      } else {
+        CeedPragmaSIMD
+        for (CeedInt c=0; c<C; c++) {
+          v0[c] += e[c] + o[c];
+          v1[c] += sign*(e[c] - o[c]);
+        }
+      }
+    }
+  ierr = CeedWorkspaceRestore_Ref(&impl->work, &work); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+int CeedTensorContractApply_Ref(CeedTensorContract contract, CeedInt A,
+                                CeedInt B, CeedInt C, CeedInt J,
+                                const CeedScalar *restrict t,
+                                CeedTransposeMode tmode, const CeedInt Add,
+                                const CeedScalar *restrict u,
+                                CeedScalar *restrict v) {
+  int ierr;
+  CeedTensorContract_Ref *impl;
+  ierr = CeedTensorContractGetData(contract, &impl); CeedChk(ierr);
+
+  // Use even-odd decomposition for symmetric 1D matrices of the basis
+  for (CeedInt i=0; impl && i<impl->numevenodd; i++)
+    if (impl->evenodd[i].t == t)
+      return CeedTensorContractApplyEvenOdd_Ref(contract, impl,
+             &impl->evenodd[i], A, B, C, J, tmode, Add, u, v);
+
+  if (impl && !impl->istensor)
+    return CeedTensorContractApplyGemm_Ref(contract, A, B, C, J, t, tmode, Add,
+                                           u, v);
+
+  return CeedTensorContractApplyGeneric_Ref(contract, A, B, C, J, t, tmode,
+         Add, u, v);
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Setup Even-Odd
+//------------------------------------------------------------------------------
+// Detect centro-(anti)symmetry of the [J, B] matrix t and, if present, store
+//   half size even and odd parts for both transpose modes
+static int CeedTensorContractSetupEvenOdd_Ref(CeedTensorContract_Ref *impl,
+    const CeedScalar *t, CeedInt J, CeedInt B) {
+  int ierr;
+  if (!t || J < CEED_EVENODD_MIN_SIZE || B < CEED_EVENODD_MIN_SIZE)
+    return 0;
+
+  // Check symmetry
+  CeedScalar tmax = 0.0;
+  for (CeedInt i=0; i<J*B; i++)
+    tmax = fabs(t[i]) > tmax ? fabs(t[i]) : tmax;
+  CeedInt sign = 0;
+  for (CeedInt s=1; s>=-1 && !sign; s-=2) {
+    bool symmetric = true;
+    for (CeedInt j=0; j<J && symmetric; j++)
+      for (CeedInt b=0; b<B && symmetric; b++)
+        symmetric = fabs(t[(J-1-j)*B+B-1-b] - s*t[j*B+b]) <= 1e-13*tmax;
+    sign = symmetric ? s : 0;
+  }
+  if (!sign)
+    return 0;
+
+  // Even and odd parts of t (CEED_NOTRANSPOSE) and t^T (CEED_TRANSPOSE)
+  CeedTensorContractEvenOdd_Ref *eo = &impl->evenodd[impl->numevenodd++];
+  eo->t = t;
+  eo->sign = sign;
+  for (CeedInt tmode=0; tmode<2; tmode++) {
+    const CeedInt JJ = tmode ? B : J, BB = tmode ? J : B;
+    const CeedInt Jh = (JJ+1)/2, Bh = (BB+1)/2, Bo = BB/2;
+    const CeedInt jstride = tmode ? 1 : B, bstride = tmode ? B : 1;
+    ierr = CeedCalloc(Jh*Bh, &eo->even[tmode]); CeedChk(ierr);
+    ierr = CeedCalloc(Jh*Bo, &eo->odd[tmode]); CeedChk(ierr);
+    for (CeedInt j=0; j<Jh; j++) {
+      for (CeedInt b=0; b<Bo; b++) {
+        const CeedScalar t0 = t[j*jstride+b*bstride],
+                         t1 = t[j*jstride+(BB-1-b)*bstride];
+        eo->even[tmode][j*Bh+b] = 0.5*(t0 + t1);
+        eo->odd[tmode][j*Bo+b] = 0.5*(t0 - t1);
+      }
+      if (BB%2)
+        eo->even[tmode][j*Bh+Bo] = t[j*jstride+Bo*bstride];
+    }
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Destroy
 //------------------------------------------------------------------------------
 static int CeedTensorContractDestroy_Ref(CeedTensorContract contract) {
+  int ierr;
+  CeedTensorContract_Ref *impl;
+  ierr = CeedTensorContractGetData(contract, &impl); CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numevenodd; i++)
+    for (CeedInt tmode=0; tmode<2; tmode++) {
+      ierr = CeedFree(&impl->evenodd[i].even[tmode]); CeedChk(ierr);
+      ierr = CeedFree(&impl->evenodd[i].odd[tmode]); CeedChk(ierr);
+    }
+  ierr = CeedWorkspacePoolDestroy_Ref(&impl->work); CeedChk(ierr);
+  ierr = CeedFree(&impl); CeedChk(ierr);
+
   return 0;
 }
 
@@ -60,6 +281,30 @@ int CeedTensorContractCreate_Ref(CeedBasis basis, CeedTensorContract contract) {
   int ierr;
   Ceed ceed;
   ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChk(ierr);
+  CeedTensorContract_Ref *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+
+  // Even-odd decompositions of symmetric 1D matrices
+  ierr = CeedBasisIsTensor(basis, &impl->istensor); CeedChk(ierr);
+  if (impl->istensor) {
+    CeedInt P1d, Q1d;
+    ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+    ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+    const CeedScalar *interp1d, *grad1d;
+    ierr = CeedBasisGetInterp1D(basis, &interp1d); CeedChk(ierr);
+    ierr = CeedBasisGetGrad1D(basis, &grad1d); CeedChk(ierr);
+    CeedBasis_Ref *basisimpl;
+    ierr = CeedBasisGetData(basis, &basisimpl); CeedChk(ierr);
+    if (!basisimpl->collointerp) {
+      ierr = CeedTensorContractSetupEvenOdd_Ref(impl, interp1d, Q1d, P1d);
+      CeedChk(ierr);
+    }
+    ierr = CeedTensorContractSetupEvenOdd_Ref(impl, grad1d, Q1d, P1d);
+    CeedChk(ierr);
+    ierr = CeedTensorContractSetupEvenOdd_Ref(impl, basisimpl->collograd1d, Q1d,
+           Q1d); CeedChk(ierr);
+  }
+  ierr = CeedTensorContractSetData(contract, impl); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
                                 CeedTensorContractApply_Ref); CeedChk(ierr);
@@ -27,7 +27,7 @@ static int CeedVectorSetArray_Ref(CeedVector vec, CeedMemType mtype,
   int ierr;
   CeedVector_Ref *impl;
   ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
-  CeedInt length;
+  CeedSize length;
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
   Ceed ceed;
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
@@ -133,6 +133,20 @@ static int CeedVectorRestoreArrayRead_Ref(CeedVector vec) {
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Vector Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedVectorGetMemoryUsage_Ref(CeedVector vec, CeedSize *bytes) {
+  int ierr;
+  CeedVector_Ref *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  CeedSize length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  *bytes = impl->array_allocated ? length*(CeedSize)sizeof(CeedScalar) : 0;
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Vector Destroy
 //------------------------------------------------------------------------------
@@ -149,7 +163,7 @@ static int CeedVectorDestroy_Ref(CeedVector vec) {
 //------------------------------------------------------------------------------
 // Vector Create
 //------------------------------------------------------------------------------
-int CeedVectorCreate_Ref(CeedInt n, CeedVector vec) {
+int CeedVectorCreate_Ref(CeedSize n, CeedVector vec) {
   int ierr;
   CeedVector_Ref *impl;
   Ceed ceed;
@@ -167,6 +181,8 @@ int CeedVectorCreate_Ref(CeedInt n, CeedVector vec) {
                                 CeedVectorRestoreArray_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "RestoreArrayRead",
                                 CeedVectorRestoreArrayRead_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetMemoryUsage",
+                                CeedVectorGetMemoryUsage_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Destroy",
                                 CeedVectorDestroy_Ref); CeedChk(ierr);
   ierr = CeedCalloc(1,&impl); CeedChk(ierr);
@@ -0,0 +1,100 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdbool.h>
+#include "ceed-ref.h"
+
+// Workspaces may be taken and returned by operators applied concurrently,
+//   through OpenMP or separate CeedOperatorWorkspace objects, so pool slots
+//   are only accessed atomically
+
+//------------------------------------------------------------------------------
+// Workspace Get
+//------------------------------------------------------------------------------
+// Take a cached workspace from the pool, or create one, and grow it to hold at
+//   least size scalars
+int CeedWorkspaceGet_Ref(CeedWorkspacePool_Ref *pool, size_t size,
+                         CeedWorkspace_Ref **work) {
+  int ierr;
+  *work = NULL;
+  for (CeedInt i=0; i<CEED_REF_WORKSPACE_SLOTS && !*work; i++)
+    *work = CeedAtomicExchange(pool->slots[i], NULL);
+  if (!*work) {
+    ierr = CeedCalloc(1, work); CeedChk(ierr);
+  }
+  if ((*work)->size < size) {
+    (*work)->size = 0;
+    ierr = CeedFree(&(*work)->array);
+    if (!ierr)
+      ierr = CeedMalloc(size, &(*work)->array);
+    if (ierr) {
+      // Hand the emptied workspace back rather than dropping it
+      CeedWorkspaceRestore_Ref(pool, work);
+      return ierr;
+    }
+    (*work)->size = size;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Workspace Restore
+//------------------------------------------------------------------------------
+// Return a workspace to the pool, freeing it if every slot is taken
+int CeedWorkspaceRestore_Ref(CeedWorkspacePool_Ref *pool,
+                             CeedWorkspace_Ref **work) {
+  int ierr;
+  for (CeedInt i=0; i<CEED_REF_WORKSPACE_SLOTS && *work; i++) {
+    CeedWorkspace_Ref *empty = NULL;
+    if (CeedAtomicCompareExchange(pool->slots[i], empty, *work))
+      *work = NULL;
+  }
+  if (*work) {
+    ierr = CeedFree(&(*work)->array); CeedChk(ierr);
+    ierr = CeedFree(work); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Workspace Pool Get Memory Usage
+//------------------------------------------------------------------------------
+// Count the cached workspaces; workspaces taken by a running apply are missed
+size_t CeedWorkspacePoolGetMemoryUsage_Ref(CeedWorkspacePool_Ref *pool) {
+  size_t bytes = 0;
+  for (CeedInt i=0; i<CEED_REF_WORKSPACE_SLOTS; i++) {
+    CeedWorkspace_Ref *work = CeedAtomicLoad(pool->slots[i]);
+    if (work)
+      bytes += work->size*sizeof(CeedScalar);
+  }
+  return bytes;
+}
+
+//------------------------------------------------------------------------------
+// Workspace Pool Destroy
+//------------------------------------------------------------------------------
+int CeedWorkspacePoolDestroy_Ref(CeedWorkspacePool_Ref *pool) {
+  int ierr;
+  for (CeedInt i=0; i<CEED_REF_WORKSPACE_SLOTS; i++)
+    if (pool->slots[i]) {
+      ierr = CeedFree(&pool->slots[i]->array); CeedChk(ierr);
+      ierr = CeedFree(&pool->slots[i]); CeedChk(ierr);
+    }
+  return 0;
+}
+//------------------------------------------------------------------------------
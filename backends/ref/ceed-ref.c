@@ -16,9 +16,44 @@
 
 #include <ceed.h>
 #include <ceed-backend.h>
+#include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
 #include "ceed-ref.h"
 
+//------------------------------------------------------------------------------
+// Get Block Size Option
+//------------------------------------------------------------------------------
+// Read the "blksize" resource option shared by the CPU blocked backends,
+//   leaving blksize unchanged when it is not given; "blksize=auto" sets
+//   autotune, and is refused by backends that pass NULL for it
+int CeedGetBlockSizeOption_Ref(Ceed ceed, const char *resource,
+                               CeedInt *blksize, bool *autotune) {
+  int ierr;
+  char *option;
+  ierr = CeedGetResourceOption(ceed, resource, "blksize", &option);
+  CeedChk(ierr);
+  if (!option)
+    return 0;
+
+  char *end;
+  long size = strtol(option, &end, 10);
+  if (autotune && !strcmp(option, "auto")) {
+    *autotune = true;
+  } else if (*end || size < 1 || size > 1024) {
+    // LCOV_EXCL_START
+    ierr = CeedError(ceed, 1, "Backend cannot use blocksize: %s", option);
+    CeedFree(&option);
+    return ierr;
+    // LCOV_EXCL_STOP
+  } else {
+    *blksize = size;
+  }
+  ierr = CeedFree(&option); CeedChk(ierr);
+
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Backend Init
 //------------------------------------------------------------------------------
@@ -37,6 +72,8 @@ static int CeedInit_Ref(const char *resource, Ceed ceed) {
                                 CeedBasisCreateTensorH1_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "BasisCreateH1",
                                 CeedBasisCreateH1_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "BasisCreateCollapsed",
+                                CeedBasisCreateCollapsed_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate",
                                 CeedTensorContractCreate_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ElemRestrictionCreate",
@@ -44,6 +81,11 @@ static int CeedInit_Ref(const char *resource, Ceed ceed) {
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed,
                                 "ElemRestrictionCreateBlocked",
                                 CeedElemRestrictionCreate_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ElemRestrictionCreate64",
+                                CeedElemRestrictionCreate64_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed,
+                                "ElemRestrictionCreateBlocked64",
+                                CeedElemRestrictionCreate64_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "QFunctionCreate",
                                 CeedQFunctionCreate_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "QFunctionContextCreate",
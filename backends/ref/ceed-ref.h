@@ -22,11 +22,57 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// Number of cached workspaces kept per pool, enough for one per thread of
+//   the usual concurrent operator applications
+#ifndef CEED_REF_WORKSPACE_SLOTS
+#  define CEED_REF_WORKSPACE_SLOTS 16
+#endif
+
+// Number of elements whose element matrices are assembled, and element
+//   block-Jacobi inverses applied, together
+#ifndef CEED_ELEMMAT_BLK_SIZE
+#  define CEED_ELEMMAT_BLK_SIZE 8
+#endif
+
+typedef struct {
+  size_t size;        /// Allocated length of array
+  CeedScalar *array;  /// CEED_ALIGN aligned scratch array
+} CeedWorkspace_Ref;
+
+typedef struct {
+  CeedWorkspace_Ref *slots[CEED_REF_WORKSPACE_SLOTS]; /// Cached workspaces
+} CeedWorkspacePool_Ref;
+
 typedef struct {
   CeedScalar *collograd1d;
   bool collointerp;
+  CeedWorkspacePool_Ref work;  /// Scratch for tensor basis application
 } CeedBasis_Ref;
 
+typedef struct {
+  CeedInt degree, Q1d;
+  const CeedScalar *interp1d;    /// Collapsed coordinate factors
+  const CeedScalar *grad1d;      /// Derivatives of the factors
+  const CeedScalar *dcollapsed;  /// Derivatives of the collapsed coordinates
+  CeedInt *offsetb;  /// First mode, and B factor block, of each i
+  CeedInt *offsetc;  /// First mode, and C factor block, of each (i, j) in 3D
+  CeedWorkspacePool_Ref work;  /// Scratch for partial sums
+} CeedBasisCollapsed_Ref;
+
+typedef struct {
+  const CeedScalar *t;  /// 1D matrix the decomposition applies to
+  CeedScalar *even[2];  /// Even parts, for CEED_NOTRANSPOSE and CEED_TRANSPOSE
+  CeedScalar *odd[2];   /// Odd parts, for CEED_NOTRANSPOSE and CEED_TRANSPOSE
+  CeedInt sign;         /// 1 if centro-symmetric, -1 if centro-antisymmetric
+} CeedTensorContractEvenOdd_Ref;
+
+typedef struct {
+  bool istensor;  /// Contractions of a tensor product basis
+  CeedInt numevenodd;
+  CeedTensorContractEvenOdd_Ref evenodd[3]; /// interp1d, grad1d, collograd1d
+  CeedWorkspacePool_Ref work;  /// Scratch for even-odd contractions
+} CeedTensorContract_Ref;
+
 typedef struct {
   CeedScalar *array;
   CeedScalar *array_allocated;
@@ -35,14 +81,24 @@ typedef struct {
 typedef struct {
   const CeedInt *offsets;
   CeedInt *offsets_allocated;
+  const CeedSize *offsets64;     /// Offsets beyond the range of CeedInt
+  CeedSize *offsets64_allocated;
+  CeedInt *ltoeoffsets;  /// Start of each L-vector entry in ltoeindices
+  CeedInt *ltoeindices;  /// E-vector entries contributing to each L entry
+  bool ltoegather;       /// Transpose gathers through the map, not scatters
+  bool ltoeready;        /// Transpose map set up, built on first transpose
+  bool ltoelock;         /// Lock for building the transpose map
+  CeedInt numcolors;     /// Number of block colors
+  CeedInt *coloroffsets; /// Start of each color in colorblks
+  CeedInt *colorblks;    /// Blocks grouped by color
+  bool colorready;       /// Coloring set up, built on first request
+  bool colorlock;        /// Lock for building the coloring
   int (*Apply)(CeedElemRestriction, const CeedInt, const CeedInt,
-               const CeedInt, CeedInt, CeedInt, CeedTransposeMode, CeedVector,
-               CeedVector, CeedRequest *);
+               const CeedInt, CeedInt, CeedInt, CeedTransposeMode,
+               const CeedScalar *, CeedScalar *); /// Blocks start to stop
 } CeedElemRestriction_Ref;
 
 typedef struct {
-  const CeedScalar **inputs;
-  CeedScalar **outputs;
   bool setupdone;
 } CeedQFunction_Ref;
 
@@ -51,25 +107,84 @@ typedef struct {
   void *data_allocated;
 } CeedQFunctionContext_Ref;
 
+typedef struct {
+  CeedEvalMode emode;        /// QFunction field evaluation mode
+  CeedInt size;              /// QFunction field size
+  CeedVector vec;            /// Field vector, or CEED_VECTOR_ACTIVE
+  CeedElemRestriction rstr;  /// Field restriction, NULL for CEED_EVAL_WEIGHT
+  CeedBasis basis;           /// Field basis
+  CeedInt gradfield;         /// GRAD input fused with this INTERP input, or -1
+  bool fused;                /// GRAD input evaluated with its INTERP input
+} CeedOperatorFieldPlan_Ref;
+
+typedef struct {
+  CeedElemRestriction rstr;  /// Blocked active restriction
+  CeedInt nblk;              /// Number of element blocks
+  CeedInt esize;             /// Element matrix size, ncomp*elemsize
+  CeedScalar *inv;           /// Inverses, [nblk, esize, esize, blksize]
+  CeedVector ein;            /// Blocked input E-vector
+  CeedVector eout;           /// Blocked output E-vector
+} CeedOperatorBlockJacobi_Ref;
+
 typedef struct {
   bool identityqf;
-  CeedVector
-  *evecs;   /// E-vectors needed to apply operator (input followed by outputs)
-  CeedScalar **edata;
-  uint64_t *inputstate;  /// State counter of inputs
-  CeedVector *evecsin;   /// Input E-vectors needed to apply operator
-  CeedVector *evecsout;  /// Output E-vectors needed to apply operator
+  CeedOperatorFieldPlan_Ref *planin;   /// Input fields resolved at setup
+  CeedOperatorFieldPlan_Ref *planout;  /// Output fields resolved at setup
+  CeedVector *evecsin;   /// Single element input E-vectors
+  CeedVector *evecsout;  /// Single element output E-vectors
   CeedVector *qvecsin;   /// Input Q-vectors needed to apply operator
   CeedVector *qvecsout;  /// Output Q-vectors needed to apply operator
+  CeedVector *qvecsfused;  /// Interpolated values followed by gradients
   CeedInt    numein;
   CeedInt    numeout;
+  CeedOperatorBlockJacobi_Ref
+  *blkjac;  /// Element block-Jacobi inverse applied instead of the fields
 } CeedOperator_Ref;
 
-CEED_INTERN int CeedVectorCreate_Ref(CeedInt n, CeedVector vec);
+// Round a scratch length up so consecutive arrays stay CEED_ALIGN aligned
+static inline size_t CeedWorkspaceAlign_Ref(size_t n) {
+  const size_t align = CEED_ALIGN/sizeof(CeedScalar);
+  return ((n + align - 1)/align)*align;
+}
+
+CEED_INTERN int CeedWorkspaceGet_Ref(CeedWorkspacePool_Ref *pool,
+                                     size_t size, CeedWorkspace_Ref **work);
+
+CEED_INTERN int CeedWorkspaceRestore_Ref(CeedWorkspacePool_Ref *pool,
+    CeedWorkspace_Ref **work);
+
+CEED_INTERN size_t CeedWorkspacePoolGetMemoryUsage_Ref(
+  CeedWorkspacePool_Ref *pool);
+
+CEED_INTERN int CeedWorkspacePoolDestroy_Ref(CeedWorkspacePool_Ref *pool);
+
+// Error check between CeedWorkspaceGet_Ref and CeedWorkspaceRestore_Ref,
+//   returning the workspace to its pool before passing the error on
+#define CeedWorkspaceChk_Ref(ierr, pool, work) \
+  do { \
+    if (ierr) { \
+      CeedWorkspaceRestore_Ref(pool, work); \
+      return ierr; \
+    } \
+  } while (0)
+
+CEED_INTERN int CeedGetBlockSizeOption_Ref(Ceed ceed, const char *resource,
+    CeedInt *blksize, bool *autotune);
+
+CEED_INTERN int CeedVectorCreate_Ref(CeedSize n, CeedVector vec);
 
 CEED_INTERN int CeedElemRestrictionCreate_Ref(CeedMemType mtype,
     CeedCopyMode cmode, const CeedInt *indices, CeedElemRestriction r);
 
+CEED_INTERN int CeedElemRestrictionCreate64_Ref(CeedMemType mtype,
+    CeedCopyMode cmode, const CeedSize *offsets, CeedElemRestriction r);
+
+CEED_INTERN int CeedElemRestrictionApply_Ref(CeedElemRestriction r,
+    CeedTransposeMode tmode, CeedVector u, CeedVector v, CeedRequest *request);
+
+CEED_INTERN int CeedElemRestrictionSetupTransposeMap_Ref(
+  CeedElemRestriction r);
+
 CEED_INTERN int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P1d,
     CeedInt Q1d, const CeedScalar *interp1d, const CeedScalar *grad1d,
     const CeedScalar *qref1d, const CeedScalar *qweight1d, CeedBasis basis);
@@ -82,6 +197,15 @@ CEED_INTERN int CeedBasisCreateH1_Ref(CeedElemTopology topo,
                                       const CeedScalar *qweight,
                                       CeedBasis basis);
 
+CEED_INTERN int CeedBasisCreateCollapsed_Ref(CeedElemTopology topo,
+    CeedInt dim, CeedInt P1d, CeedInt Q1d, const CeedScalar *interp1d,
+    const CeedScalar *grad1d, const CeedScalar *dcollapsed, CeedBasis basis);
+
+CEED_INTERN int CeedBasisApplyCore_Ref(CeedBasis basis, CeedInt nelem,
+                                       CeedTransposeMode tmode,
+                                       CeedEvalMode emode, const CeedScalar *u,
+                                       CeedScalar *v);
+
 CEED_INTERN int CeedTensorContractCreate_Ref(CeedBasis basis,
     CeedTensorContract contract);
 
@@ -25,22 +25,27 @@
 //------------------------------------------------------------------------------
 static int CeedInit_Xsmm_Blocked(const char *resource, Ceed ceed) {
   int ierr;
-  if (strcmp(resource, "/cpu/self") && strcmp(resource, "/cpu/self/xsmm")
-      && strcmp(resource, "/cpu/self/xsmm/blocked"))
+  char *resourceroot;
+  ierr = CeedGetResourceRoot(ceed, resource, &resourceroot); CeedChk(ierr);
+  if (strcmp(resourceroot, "/cpu/self")
+      && strcmp(resourceroot, "/cpu/self/xsmm")
+      && strcmp(resourceroot, "/cpu/self/xsmm/blocked"))
     // LCOV_EXCL_START
     return CeedError(ceed, 1, "blocked libXSMM backend cannot use resource: %s",
                      resource);
   // LCOV_EXCL_STOP
+  ierr = CeedFree(&resourceroot); CeedChk(ierr);
   ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
 
   // Create reference CEED that implementation will be dispatched
   //   through unless overridden
   Ceed ceedref;
-  CeedInit("/cpu/self/opt/blocked", &ceedref);
+  CeedInitDelegate("/cpu/self/opt/blocked", resource, &ceedref);
   ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate",
                                 CeedTensorContractCreate_Xsmm); CeedChk(ierr);
+  ierr = CeedSetKernelCache_Xsmm(ceed); CeedChk(ierr);
 
   return 0;
 }
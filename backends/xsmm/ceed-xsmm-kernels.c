@@ -0,0 +1,138 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <libxsmm.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "ceed-xsmm.h"
+
+// Kernels may be requested by operators applied concurrently; lookups are lock
+//   free, since entries are fully built before they are linked into a bucket
+//   and stay until the last libXSMM Ceed is destroyed, and only inserting
+//   takes the lock
+static CeedKernelCache_Xsmm cache_xsmm;
+
+//------------------------------------------------------------------------------
+// Kernel Cache Find
+//------------------------------------------------------------------------------
+static inline CeedKernelCacheEntry_Xsmm *CeedKernelCacheFind_Xsmm(
+  CeedKernelCacheEntry_Xsmm *entry, CeedInt B, CeedInt C, CeedInt J,
+  CeedInt tmode, CeedInt add) {
+  for (; entry; entry = entry->next)
+    if (entry->B == B && entry->C == C && entry->J == J &&
+        entry->tmode == tmode && entry->add == add)
+      return entry;
+  return NULL;
+}
+
+//------------------------------------------------------------------------------
+// Kernel Cache Get
+//------------------------------------------------------------------------------
+// Get the kernel for a contraction shape, building it on first request; the
+//   kernel is NULL for shapes libXSMM does not build, such as ones past its
+//   JIT limits, and the caller falls back to libxsmm_dgemm
+int CeedKernelCacheGet_Xsmm(Ceed ceed, CeedKernelCache_Xsmm *cache,
+                            CeedInt B, CeedInt C, CeedInt J, CeedInt tmode,
+                            CeedInt add, libxsmm_dmmfunction *kernel) {
+  int ierr;
+  // C grows with the number of elements, so hash without signed overflow
+  const uint64_t hash = (((uint64_t)B*31 + (uint64_t)C)*31 + (uint64_t)J)*4 +
+                        tmode*2 + !!add;
+  const CeedInt bucket = hash % CEED_XSMM_CACHE_BUCKETS;
+
+  // Look for a kernel built earlier
+  CeedKernelCacheEntry_Xsmm *entry =
+    CeedKernelCacheFind_Xsmm(CeedAtomicLoad(cache->buckets[bucket]),
+                             B, C, J, tmode, add);
+  if (entry) {
+    *kernel = entry->kernel;
+    return 0;
+  }
+
+  // Build kernel outside the lock; libXSMM dispatch is thread safe and gives
+  //   the same kernel to threads racing on a new shape. Shapes it does not
+  //   build are cached too, so they are not dispatched again
+  const int flags = LIBXSMM_GEMM_FLAGS('N', tmode ? 'T' : 'N');
+  CeedScalar alpha = 1.0, beta = add ? 1.0 : 0.0;
+  *kernel = libxsmm_dmmdispatch(C, J, B, NULL, NULL, NULL, &alpha, &beta,
+                                &flags, NULL);
+  CeedKernelCacheEntry_Xsmm *newentry;
+  ierr = CeedCalloc(1, &newentry); CeedChk(ierr);
+  *newentry = (CeedKernelCacheEntry_Xsmm) {
+    .B = B, .C = C, .J = J, .tmode = tmode, .add = add, .kernel = *kernel
+  };
+
+  // Insert kernel, unless another thread got there first
+  CeedSpinLock(cache->lock);
+  newentry->next = cache->buckets[bucket];
+  entry = CeedKernelCacheFind_Xsmm(newentry->next, B, C, J, tmode, add);
+  if (!entry)
+    CeedAtomicStore(cache->buckets[bucket], newentry);
+  CeedSpinUnlock(cache->lock);
+  if (entry) {
+    ierr = CeedFree(&newentry); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+// Drop the reference held by a Ceed, releasing every kernel with the last one
+static int CeedDestroy_Xsmm(Ceed ceed) {
+  int ierr;
+  Ceed_Xsmm *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  CeedKernelCache_Xsmm *cache = data->cache;
+
+  CeedSpinLock(cache->lock);
+  if (--cache->refcount == 0)
+    for (CeedInt i=0; i<CEED_XSMM_CACHE_BUCKETS; i++)
+      while (cache->buckets[i]) {
+        CeedKernelCacheEntry_Xsmm *entry = cache->buckets[i];
+        cache->buckets[i] = entry->next;
+        if (entry->kernel)
+          libxsmm_release_kernel(&entry->kernel);
+        CeedFree(&entry);
+      }
+  CeedSpinUnlock(cache->lock);
+
+  ierr = CeedFree(&data); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Set Kernel Cache
+//------------------------------------------------------------------------------
+// Reference the process-wide kernel cache from a libXSMM Ceed
+int CeedSetKernelCache_Xsmm(Ceed ceed) {
+  int ierr;
+  Ceed_Xsmm *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+
+  CeedSpinLock(cache_xsmm.lock);
+  cache_xsmm.refcount++;
+  CeedSpinUnlock(cache_xsmm.lock);
+  data->cache = &cache_xsmm;
+
+  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
+                                CeedDestroy_Xsmm); CeedChk(ierr);
+  return 0;
+}
+//------------------------------------------------------------------------------
@@ -16,8 +16,6 @@
 
 #include <ceed.h>
 #include <ceed-backend.h>
-#include <ceed-hash.h>
-#include <ceed-khash.h>
 #include <libxsmm.h>
 #include <stddef.h>
 #include "ceed-xsmm.h"
@@ -63,18 +61,30 @@ static int CeedTensorContractApply_Xsmm(CeedTensorContract contract, CeedInt A,
   CeedTensorContract_Xsmm *impl;
   ierr = CeedTensorContractGetData(contract, &impl); CeedChk(ierr);
 
-  // Get kernel
-  libxsmm_dmmfunction kernel;
-  CeedHashIJKLMKey key = {B, C, J, tmode, add};
-  khint_t k = kh_get(m32, impl->lookup, key);
-  CeedHashGetValue(impl->lookup, k, kernel);
+  // Get kernel from the shared cache, building it on first use
+  libxsmm_dmmfunction kernel = NULL;
+  if (C != 1) {
+    Ceed ceed;
+    ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChk(ierr);
+    ierr = CeedKernelCacheGet_Xsmm(ceed, impl->cache, B, C, J, tmode, add,
+                                   &kernel); CeedChk(ierr);
+  }
 
   // Run kernel or fallback to default implementation
-  if (C != 1)
+  if (C != 1 && kernel) {
     for (CeedInt a=0; a<A; a++)
       kernel(&u[a*B*C], &t[0], &v[a*J*C], NULL, NULL, NULL);
-  else
+  } else if (C != 1) {
+    // Shape past the JIT limits, same product through libXSMM GEMM
+    CeedScalar alpha = 1.0, beta = add ? 1.0 : 0.0;
+    char transu = 'N', transt = tmode == CEED_TRANSPOSE ? 'T' : 'N';
+    for (CeedInt a=0; a<A; a++)
+      libxsmm_dgemm(&transu, &transt, &C, &J, &B,
+                    &alpha, &u[(CeedSize)a*B*C], NULL, &t[0], NULL,
+                    &beta, &v[(CeedSize)a*J*C], NULL);
+  } else {
     CeedTensorContract_Xsmm_C1(contract, A, B, C, J, t, tmode, add, u, v);
+  }
 
   return 0;
 }
@@ -85,12 +95,8 @@ static int CeedTensorContractApply_Xsmm(CeedTensorContract contract, CeedInt A,
 static int CeedTensorContractDestroy_Xsmm(CeedTensorContract contract) {
   int ierr;
   CeedTensorContract_Xsmm *impl;
-  libxsmm_dmmfunction kernel;
 
   ierr = CeedTensorContractGetData(contract, &impl); CeedChk(ierr);
-  // Free kernels
-  kh_foreach_value(impl->lookup, kernel, libxsmm_release_kernel(&kernel));
-  kh_destroy(m32, impl->lookup);
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
 }
@@ -103,80 +109,13 @@ int CeedTensorContractCreate_Xsmm(CeedBasis basis,
   int ierr;
   Ceed ceed;
   ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChk(ierr);
+  Ceed_Xsmm *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
   CeedTensorContract_Xsmm *impl;
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
 
-  // Setup kernels hash table
-  impl->lookup = kh_init(m32);
-
-  // Set up pointers to kernels
-  ierr = CeedBasisIsTensor(basis, &impl->isTensor); CeedChk(ierr);
-  if (impl->isTensor) {
-    ierr = CeedBasisGetNumNodes1D(basis, &impl->P); CeedChk(ierr);
-    ierr = CeedBasisGetNumQuadraturePoints1D(basis, &impl->Q); CeedChk(ierr);
-    ierr = CeedBasisGetDimension(basis, &impl->dim); CeedChk(ierr);
-    // Build all required kernels
-    for (CeedInt nelem = 1; nelem <= 8; nelem+=7)
-      for (CeedInt add = 0; add <= 1; add++)
-        for (CeedInt tmode = 0; tmode <= 1; tmode++)
-          for (CeedInt grad = 0; grad <=1; grad++)
-            for (CeedInt dim = 0; dim < impl->dim; dim++) {
-              const int flags = LIBXSMM_GEMM_FLAGS('N', tmode ? 'T' : 'N');
-              CeedInt B = grad ? impl->Q : (tmode ? impl->Q : impl->P),
-                      J = grad ? impl->Q : (tmode ? impl->P : impl->Q),
-                      C = nelem*CeedIntPow(J, dim);
-              // Add key, kernel pair to hash table
-              CeedHashIJKLMKey key = {B, C, J, tmode, add};
-              int new_item;
-              khint_t k = kh_put(m32, impl->lookup, key, &new_item);
-              if (new_item) {
-                // Build kernel
-                CeedScalar alpha = 1.0, beta = 1.0;
-                if (!add) beta = 0.0;
-                libxsmm_dmmfunction kernel = libxsmm_dmmdispatch(
-                                               C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
-                if (!kernel)
-                  // LCOV_EXCL_START
-                  return CeedError(ceed, 1, "LIBXSMM kernel failed to build.");
-                // LCOV_EXCL_STOP
-                // Add kernel to hash table
-                kh_value(impl->lookup, k) = kernel;
-              }
-            }
-  } else {
-    ierr = CeedBasisGetNumNodes(basis, &impl->P); CeedChk(ierr);
-    ierr = CeedBasisGetNumQuadraturePoints(basis, &impl->Q); CeedChk(ierr);
-    ierr = CeedBasisGetDimension(basis, &impl->dim); CeedChk(ierr);
-    // Build all required kernels
-    for (CeedInt nelem = 1; nelem <= 8; nelem+=7)
-      for (CeedInt add = 0; add <= 1; add++)
-        for (CeedInt tmode = 0; tmode <= 1; tmode++) {
-          CeedInt gradstride = CeedIntMax(impl->dim-1, 1);
-          for (CeedInt grad = 1; grad <= impl->dim; grad+=gradstride) {
-            const int flags = LIBXSMM_GEMM_FLAGS('N', tmode ? 'T' : 'N');
-            CeedInt B = tmode ? grad*impl->Q : impl->P,
-                    J = tmode ? impl->P : grad*impl->Q,
-                    C = nelem;
-            // Add key, kernel pair to hash table
-            CeedHashIJKLMKey key = {B, C, J, tmode, add};
-            int new_item;
-            khint_t k = kh_put(m32, impl->lookup, key, &new_item);
-            if (new_item) {
-              // Build kernel
-              CeedScalar alpha = 1.0, beta = 1.0;
-              if (!add) beta = 0.0;
-              libxsmm_dmmfunction kernel = libxsmm_dmmdispatch(
-                                             C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
-              if (!kernel)
-                // LCOV_EXCL_START
-                return CeedError(ceed, 1, "LIBXSMM kernel failed to build.");
-              // LCOV_EXCL_STOP
-              // Add kernel to hash table
-              kh_value(impl->lookup, k) = kernel;
-            }
-          }
-        }
-  }
+  // Kernels are built lazily in the cache shared by all bases
+  impl->cache = data->cache;
   ierr = CeedTensorContractSetData(contract, impl); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
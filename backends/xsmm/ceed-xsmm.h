@@ -19,18 +19,41 @@
 
 #include <ceed.h>
 #include <ceed-backend.h>
-#include <ceed-hash.h>
 #include <libxsmm.h>
+#include <stdbool.h>
 
-// Instantiate khash structs and methods
-CeedHashIJKLMInit(m32, libxsmm_dmmfunction)
+#define CEED_XSMM_CACHE_BUCKETS 256
+
+// Kernel for one contraction shape, never changed once in the cache
+typedef struct CeedKernelCacheEntry_Xsmm_private {
+  CeedInt B, C, J, tmode, add;  /// Contraction shape
+  libxsmm_dmmfunction kernel;   /// Kernel built for the shape, or NULL
+  struct CeedKernelCacheEntry_Xsmm_private *next; /// Next entry in the bucket
+} CeedKernelCacheEntry_Xsmm;
+
+// Process-wide cache of libXSMM kernels keyed on (B, C, J, tmode, add),
+//   shared by every basis of every libXSMM Ceed
+typedef struct {
+  bool lock;             /// Lock for inserting kernels and the refcount
+  CeedInt refcount;      /// Number of libXSMM Ceeds using the cache
+  CeedKernelCacheEntry_Xsmm *buckets[CEED_XSMM_CACHE_BUCKETS]; /// Kernels
+} CeedKernelCache_Xsmm;
 
 typedef struct {
-  bool isTensor;
-  CeedInt P, Q, dim;
-  khash_t(m32) *lookup;
+  CeedKernelCache_Xsmm *cache;
+} Ceed_Xsmm;
+
+typedef struct {
+  CeedKernelCache_Xsmm *cache;
 } CeedTensorContract_Xsmm;
 
+CEED_INTERN int CeedSetKernelCache_Xsmm(Ceed ceed);
+
+CEED_INTERN int CeedKernelCacheGet_Xsmm(Ceed ceed, CeedKernelCache_Xsmm *cache,
+                                        CeedInt B, CeedInt C, CeedInt J,
+                                        CeedInt tmode, CeedInt add,
+                                        libxsmm_dmmfunction *kernel);
+
 CEED_INTERN int CeedTensorContractCreate_Xsmm(CeedBasis basis,
     CeedTensorContract contract);
 
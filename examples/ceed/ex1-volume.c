@@ -45,6 +45,9 @@
 //TESTARGS -ceed {ceed_resource} -d 1 -t -g
 //TESTARGS -ceed {ceed_resource} -d 2 -t -g
 //TESTARGS -ceed {ceed_resource} -d 3 -t -g
+//TESTARGS -ceed {ceed_resource} -d 1 -t -o
+//TESTARGS -ceed {ceed_resource} -d 2 -t -o
+//TESTARGS -ceed {ceed_resource} -d 3 -t -o
 
 /// @file
 /// libCEED example using mass operator to compute volume
@@ -74,7 +77,7 @@ int main(int argc, const char *argv[]) {
   int sol_degree  = 4;             // polynomial degree for the solution
   int num_qpts   = sol_degree + 2; // number of 1D quadrature points
   int prob_size  = -1;             // approximate problem size
-  int help = 0, test = 0, gallery = 0;
+  int help = 0, test = 0, gallery = 0, onthefly = 0;
 
   // Process command line arguments.
   for (int ia = 1; ia < argc; ia++) {
@@ -99,6 +102,8 @@ int main(int argc, const char *argv[]) {
       test = 1;
     } else if (!strcmp(argv[ia],"-g")) {
       gallery = 1;
+    } else if (!strcmp(argv[ia],"-o")) {
+      onthefly = 1;
     }
     if (parse_error) {
       printf("Error parsing command line options.\n");
@@ -119,6 +124,8 @@ int main(int argc, const char *argv[]) {
     printf("  Num. 1D quadr. pts [-q] : %d\n", num_qpts);
     printf("  Approx. # unknowns [-s] : %d\n", prob_size);
     printf("  QFunction source   [-g] : %s\n", gallery?"gallery":"header");
+    printf("  Geometric factors  [-o] : %s\n",
+           onthefly?"computed on the fly":"stored");
     if (help) {
       printf("Test/quiet mode is %s\n", (test?"ON":"OFF (use -t to enable)"));
       return 0;
@@ -180,64 +187,77 @@ int main(int argc, const char *argv[]) {
   CeedQFunctionContextSetData(build_ctx, CEED_MEM_HOST, CEED_USE_POINTER,
                               sizeof(build_ctx_data), &build_ctx_data);
 
-  // Create the QFunction that builds the mass operator (i.e. computes its
-  // quadrature data) and set its context data.
-  CeedQFunction build_qfunc;
-  switch (gallery) {
-  case 0:
-    // This creates the QFunction directly.
-    CeedQFunctionCreateInterior(ceed, 1, f_build_mass,
-                                f_build_mass_loc, &build_qfunc);
-    CeedQFunctionAddInput(build_qfunc, "dx", ncompx*dim, CEED_EVAL_GRAD);
-    CeedQFunctionAddInput(build_qfunc, "weights", 1, CEED_EVAL_WEIGHT);
-    CeedQFunctionAddOutput(build_qfunc, "qdata", 1, CEED_EVAL_NONE);
-    CeedQFunctionSetContext(build_qfunc, build_ctx);
-    break;
-  case 1: {
-    // This creates the QFunction via the gallery.
-    char name[13] = "";
-    snprintf(name, sizeof name, "Mass%dDBuild", dim);
-    CeedQFunctionCreateInteriorByName(ceed, name, &build_qfunc);
-    break;
-  }
-  }
+  // Unless the mass operator computes the geometric factors on the fly
+  // from the mesh coordinates, build and store its quadrature data.
+  CeedQFunction build_qfunc = NULL;
+  CeedOperator build_oper = NULL;
+  CeedVector qdata = NULL;
+  if (!onthefly) {
+    // Create the QFunction that builds the mass operator (i.e. computes its
+    // quadrature data) and set its context data.
+    switch (gallery) {
+    case 0:
+      // This creates the QFunction directly.
+      CeedQFunctionCreateInterior(ceed, 1, f_build_mass,
+                                  f_build_mass_loc, &build_qfunc);
+      CeedQFunctionAddInput(build_qfunc, "dx", ncompx*dim, CEED_EVAL_GRAD);
+      CeedQFunctionAddInput(build_qfunc, "weights", 1, CEED_EVAL_WEIGHT);
+      CeedQFunctionAddOutput(build_qfunc, "qdata", 1, CEED_EVAL_NONE);
+      CeedQFunctionSetContext(build_qfunc, build_ctx);
+      break;
+    case 1: {
+      // This creates the QFunction via the gallery.
+      char name[13] = "";
+      snprintf(name, sizeof name, "Mass%dDBuild", dim);
+      CeedQFunctionCreateInteriorByName(ceed, name, &build_qfunc);
+      break;
+    }
+    }
 
-  // Create the operator that builds the quadrature data for the mass operator.
-  CeedOperator build_oper;
-  CeedOperatorCreate(ceed, build_qfunc, CEED_QFUNCTION_NONE,
-                     CEED_QFUNCTION_NONE, &build_oper);
-  CeedOperatorSetField(build_oper, "dx", mesh_restr, mesh_basis,
-                       CEED_VECTOR_ACTIVE);
-  CeedOperatorSetField(build_oper, "weights", CEED_ELEMRESTRICTION_NONE,
-                       mesh_basis, CEED_VECTOR_NONE);
-  CeedOperatorSetField(build_oper, "qdata", sol_restr_i, CEED_BASIS_COLLOCATED,
-                       CEED_VECTOR_ACTIVE);
+    // Create the operator that builds the quadrature data for the mass
+    // operator.
+    CeedOperatorCreate(ceed, build_qfunc, CEED_QFUNCTION_NONE,
+                       CEED_QFUNCTION_NONE, &build_oper);
+    CeedOperatorSetField(build_oper, "dx", mesh_restr, mesh_basis,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(build_oper, "weights", CEED_ELEMRESTRICTION_NONE,
+                         mesh_basis, CEED_VECTOR_NONE);
+    CeedOperatorSetField(build_oper, "qdata", sol_restr_i,
+                         CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
 
-  // Compute the quadrature data for the mass operator.
-  CeedVector qdata;
-  CeedInt elem_qpts = CeedIntPow(num_qpts, dim);
-  CeedInt num_elem = 1;
-  for (int d = 0; d < dim; d++)
-    num_elem *= nxyz[d];
-  CeedVectorCreate(ceed, num_elem*elem_qpts, &qdata);
-  CeedOperatorApply(build_oper, mesh_coords, qdata,
-                    CEED_REQUEST_IMMEDIATE);
+    // Compute the quadrature data for the mass operator.
+    CeedInt elem_qpts = CeedIntPow(num_qpts, dim);
+    CeedInt num_elem = 1;
+    for (int d = 0; d < dim; d++)
+      num_elem *= nxyz[d];
+    CeedVectorCreate(ceed, num_elem*elem_qpts, &qdata);
+    CeedOperatorApply(build_oper, mesh_coords, qdata,
+                      CEED_REQUEST_IMMEDIATE);
+  }
 
   // Create the QFunction that defines the action of the mass operator.
   CeedQFunction apply_qfunc;
-  switch (gallery) {
-  case 0:
-    // This creates the QFunction directly.
-    CeedQFunctionCreateInterior(ceed, 1, f_apply_mass,
-                                f_apply_mass_loc, &apply_qfunc);
-    CeedQFunctionAddInput(apply_qfunc, "u", 1, CEED_EVAL_INTERP);
-    CeedQFunctionAddInput(apply_qfunc, "qdata", 1, CEED_EVAL_NONE);
-    CeedQFunctionAddOutput(apply_qfunc, "v", 1, CEED_EVAL_INTERP);
-    break;
-  case 1:
-    // This creates the QFunction via the gallery.
-    CeedQFunctionCreateInteriorByName(ceed, "MassApply", &apply_qfunc);
-    break;
+  if (onthefly) {
+    // This creates the QFunction via the gallery, with the geometric factors
+    // computed from the gradient of the mesh coordinates.
+    char name[23] = "";
+    snprintf(name, sizeof name, "Mass%dDApplyOnTheFly", dim);
+    CeedQFunctionCreateInteriorByName(ceed, name, &apply_qfunc);
+  } else {
+    switch (gallery) {
+    case 0:
+      // This creates the QFunction directly.
+      CeedQFunctionCreateInterior(ceed, 1, f_apply_mass,
+                                  f_apply_mass_loc, &apply_qfunc);
+      CeedQFunctionAddInput(apply_qfunc, "u", 1, CEED_EVAL_INTERP);
+      CeedQFunctionAddInput(apply_qfunc, "qdata", 1, CEED_EVAL_NONE);
+      CeedQFunctionAddOutput(apply_qfunc, "v", 1, CEED_EVAL_INTERP);
+      break;
+    case 1:
+      // This creates the QFunction via the gallery.
+      CeedQFunctionCreateInteriorByName(ceed, "MassApply", &apply_qfunc);
+      break;
+    }
   }
 
   // Create the mass operator.
@@ -245,8 +265,14 @@ int main(int argc, const char *argv[]) {
   CeedOperatorCreate(ceed, apply_qfunc, CEED_QFUNCTION_NONE,
                      CEED_QFUNCTION_NONE, &oper);
   CeedOperatorSetField(oper, "u", sol_restr, sol_basis, CEED_VECTOR_ACTIVE);
-  CeedOperatorSetField(oper, "qdata", sol_restr_i, CEED_BASIS_COLLOCATED,
-                       qdata);
+  if (onthefly) {
+    CeedOperatorSetField(oper, "dx", mesh_restr, mesh_basis, mesh_coords);
+    CeedOperatorSetField(oper, "weights", CEED_ELEMRESTRICTION_NONE,
+                         mesh_basis, CEED_VECTOR_NONE);
+  } else {
+    CeedOperatorSetField(oper, "qdata", sol_restr_i, CEED_BASIS_COLLOCATED,
+                         qdata);
+  }
   CeedOperatorSetField(oper, "v", sol_restr, sol_basis, CEED_VECTOR_ACTIVE);
 
   // Create auxiliary solution-size vectors.
@@ -46,6 +46,9 @@
 //TESTARGS -ceed {ceed_resource} -d 1 -t -g
 //TESTARGS -ceed {ceed_resource} -d 2 -t -g
 //TESTARGS -ceed {ceed_resource} -d 3 -t -g
+//TESTARGS -ceed {ceed_resource} -d 1 -t -o
+//TESTARGS -ceed {ceed_resource} -d 2 -t -o
+//TESTARGS -ceed {ceed_resource} -d 3 -t -o
 
 /// @file
 /// libCEED example using diffusion operator to compute surface area
@@ -75,7 +78,7 @@ int main(int argc, const char *argv[]) {
   int sol_degree  = 4;             // polynomial degree for the solution
   int num_qpts   = sol_degree + 2; // number of 1D quadrature points
   int prob_size  = -1;             // approximate problem size
-  int help = 0, test = 0, gallery = 0;
+  int help = 0, test = 0, gallery = 0, onthefly = 0;
 
   // Process command line arguments.
   for (int ia = 1; ia < argc; ia++) {
@@ -100,6 +103,8 @@ int main(int argc, const char *argv[]) {
       test = 1;
     } else if (!strcmp(argv[ia],"-g")) {
       gallery = 1;
+    } else if (!strcmp(argv[ia],"-o")) {
+      onthefly = 1;
     }
     if (parse_error) {
       printf("Error parsing command line options.\n");
@@ -124,6 +129,8 @@ int main(int argc, const char *argv[]) {
     printf("  Num. 1D quadr. pts [-q] : %d\n", num_qpts);
     printf("  Approx. # unknowns [-s] : %d\n", prob_size);
     printf("  QFunction source   [-g] : %s\n", gallery?"gallery":"header");
+    printf("  Geometric factors  [-o] : %s\n",
+           onthefly?"computed on the fly":"stored");
     if (help) {
       printf("Test/quiet mode is %s\n", (test?"ON":"OFF (use -t to enable)"));
       return 0;
@@ -190,69 +197,83 @@ int main(int argc, const char *argv[]) {
   CeedQFunctionContextSetData(build_ctx, CEED_MEM_HOST, CEED_USE_POINTER,
                               sizeof(build_ctx_data), &build_ctx_data);
 
-  // Create the QFunction that builds the diffusion operator (i.e. computes its
-  // quadrature data) and set its context data.
-  CeedQFunction build_qfunc;
-  switch (gallery) {
-  case 0:
-    // This creates the QFunction directly.
-    CeedQFunctionCreateInterior(ceed, 1, f_build_diff,
-                                f_build_diff_loc, &build_qfunc);
-    CeedQFunctionAddInput(build_qfunc, "dx", ncompx*dim, CEED_EVAL_GRAD);
-    CeedQFunctionAddInput(build_qfunc, "weights", 1, CEED_EVAL_WEIGHT);
-    CeedQFunctionAddOutput(build_qfunc, "qdata", dim*(dim+1)/2, CEED_EVAL_NONE);
-    CeedQFunctionSetContext(build_qfunc, build_ctx);
-    break;
-  case 1: {
-    // This creates the QFunction via the gallery.
-    char name[16] = "";
-    snprintf(name, sizeof name, "Poisson%dDBuild", dim);
-    CeedQFunctionCreateInteriorByName(ceed, name, &build_qfunc);
-    break;
-  }
-  }
+  // Unless the diffusion operator computes the geometric factors on the fly
+  // from the mesh coordinates, build and store its quadrature data.
+  CeedQFunction build_qfunc = NULL;
+  CeedOperator build_oper = NULL;
+  CeedVector qdata = NULL;
+  if (!onthefly) {
+    // Create the QFunction that builds the diffusion operator (i.e. computes
+    // its quadrature data) and set its context data.
+    switch (gallery) {
+    case 0:
+      // This creates the QFunction directly.
+      CeedQFunctionCreateInterior(ceed, 1, f_build_diff,
+                                  f_build_diff_loc, &build_qfunc);
+      CeedQFunctionAddInput(build_qfunc, "dx", ncompx*dim, CEED_EVAL_GRAD);
+      CeedQFunctionAddInput(build_qfunc, "weights", 1, CEED_EVAL_WEIGHT);
+      CeedQFunctionAddOutput(build_qfunc, "qdata", dim*(dim+1)/2,
+                             CEED_EVAL_NONE);
+      CeedQFunctionSetContext(build_qfunc, build_ctx);
+      break;
+    case 1: {
+      // This creates the QFunction via the gallery.
+      char name[16] = "";
+      snprintf(name, sizeof name, "Poisson%dDBuild", dim);
+      CeedQFunctionCreateInteriorByName(ceed, name, &build_qfunc);
+      break;
+    }
+    }
 
-  // Create the operator that builds the quadrature data for the diffusion
-  // operator.
-  CeedOperator build_oper;
-  CeedOperatorCreate(ceed, build_qfunc, CEED_QFUNCTION_NONE,
-                     CEED_QFUNCTION_NONE, &build_oper);
-  CeedOperatorSetField(build_oper, "dx", mesh_restr, mesh_basis,
-                       CEED_VECTOR_ACTIVE);
-  CeedOperatorSetField(build_oper, "weights", CEED_ELEMRESTRICTION_NONE,
-                       mesh_basis, CEED_VECTOR_NONE);
-  CeedOperatorSetField(build_oper, "qdata", qdata_restr_i,
-                       CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
-
-  // Compute the quadrature data for the diffusion operator.
-  CeedVector qdata;
-  CeedInt elem_qpts = CeedIntPow(num_qpts, dim);
-  CeedInt num_elem = 1;
-  for (int d = 0; d < dim; d++)
-    num_elem *= nxyz[d];
-  CeedVectorCreate(ceed, num_elem*elem_qpts*dim*(dim+1)/2, &qdata);
-  CeedOperatorApply(build_oper, mesh_coords, qdata,
-                    CEED_REQUEST_IMMEDIATE);
+    // Create the operator that builds the quadrature data for the diffusion
+    // operator.
+    CeedOperatorCreate(ceed, build_qfunc, CEED_QFUNCTION_NONE,
+                       CEED_QFUNCTION_NONE, &build_oper);
+    CeedOperatorSetField(build_oper, "dx", mesh_restr, mesh_basis,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(build_oper, "weights", CEED_ELEMRESTRICTION_NONE,
+                         mesh_basis, CEED_VECTOR_NONE);
+    CeedOperatorSetField(build_oper, "qdata", qdata_restr_i,
+                         CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+
+    // Compute the quadrature data for the diffusion operator.
+    CeedInt elem_qpts = CeedIntPow(num_qpts, dim);
+    CeedInt num_elem = 1;
+    for (int d = 0; d < dim; d++)
+      num_elem *= nxyz[d];
+    CeedVectorCreate(ceed, num_elem*elem_qpts*dim*(dim+1)/2, &qdata);
+    CeedOperatorApply(build_oper, mesh_coords, qdata,
+                      CEED_REQUEST_IMMEDIATE);
+  }
 
   // Create the QFunction that defines the action of the diffusion operator.
   CeedQFunction apply_qfunc;
-  switch (gallery) {
-  case 0:
-    // This creates the QFunction directly.
-    CeedQFunctionCreateInterior(ceed, 1, f_apply_diff,
-                                f_apply_diff_loc, &apply_qfunc);
-    CeedQFunctionAddInput(apply_qfunc, "du", dim, CEED_EVAL_GRAD);
-    CeedQFunctionAddInput(apply_qfunc, "qdata", dim*(dim+1)/2, CEED_EVAL_NONE);
-    CeedQFunctionAddOutput(apply_qfunc, "dv", dim, CEED_EVAL_GRAD);
-    CeedQFunctionSetContext(apply_qfunc, build_ctx);
-    break;
-  case 1: {
-    // This creates the QFunction via the gallery.
-    char name[16] = "";
-    snprintf(name, sizeof name, "Poisson%dDApply", dim);
+  if (onthefly) {
+    // This creates the QFunction via the gallery, with the geometric factors
+    // computed from the gradient of the mesh coordinates.
+    char name[23] = "";
+    snprintf(name, sizeof name, "Poisson%dDApplyOnTheFly", dim);
     CeedQFunctionCreateInteriorByName(ceed, name, &apply_qfunc);
-    break;
-  }
+  } else {
+    switch (gallery) {
+    case 0:
+      // This creates the QFunction directly.
+      CeedQFunctionCreateInterior(ceed, 1, f_apply_diff,
+                                  f_apply_diff_loc, &apply_qfunc);
+      CeedQFunctionAddInput(apply_qfunc, "du", dim, CEED_EVAL_GRAD);
+      CeedQFunctionAddInput(apply_qfunc, "qdata", dim*(dim+1)/2,
+                            CEED_EVAL_NONE);
+      CeedQFunctionAddOutput(apply_qfunc, "dv", dim, CEED_EVAL_GRAD);
+      CeedQFunctionSetContext(apply_qfunc, build_ctx);
+      break;
+    case 1: {
+      // This creates the QFunction via the gallery.
+      char name[16] = "";
+      snprintf(name, sizeof name, "Poisson%dDApply", dim);
+      CeedQFunctionCreateInteriorByName(ceed, name, &apply_qfunc);
+      break;
+    }
+    }
   }
 
   // Create the diffusion operator.
@@ -260,8 +281,14 @@ int main(int argc, const char *argv[]) {
   CeedOperatorCreate(ceed, apply_qfunc, CEED_QFUNCTION_NONE,
                      CEED_QFUNCTION_NONE, &oper);
   CeedOperatorSetField(oper, "du", sol_restr, sol_basis, CEED_VECTOR_ACTIVE);
-  CeedOperatorSetField(oper, "qdata", qdata_restr_i, CEED_BASIS_COLLOCATED,
-                       qdata);
+  if (onthefly) {
+    CeedOperatorSetField(oper, "dx", mesh_restr, mesh_basis, mesh_coords);
+    CeedOperatorSetField(oper, "weights", CEED_ELEMRESTRICTION_NONE,
+                         mesh_basis, CEED_VECTOR_NONE);
+  } else {
+    CeedOperatorSetField(oper, "qdata", qdata_restr_i, CEED_BASIS_COLLOCATED,
+                         qdata);
+  }
   CeedOperatorSetField(oper, "dv", sol_restr, sol_basis, CEED_VECTOR_ACTIVE);
 
   // Create auxiliary solution-size vectors.
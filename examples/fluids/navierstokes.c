@@ -505,7 +505,8 @@ static int CreateVectorFromPetscVec(Ceed ceed, Vec p, CeedVector *v) {
 
 static int VectorPlacePetscVec(CeedVector c, Vec p) {
   PetscErrorCode ierr;
-  PetscInt mceed, mpetsc;
+  CeedSize mceed;
+  PetscInt mpetsc;
   PetscScalar *a;
 
   PetscFunctionBeginUser;
@@ -513,7 +514,7 @@ static int VectorPlacePetscVec(CeedVector c, Vec p) {
   ierr = VecGetLocalSize(p, &mpetsc); CHKERRQ(ierr);
   if (mceed != mpetsc) SETERRQ2(PETSC_COMM_SELF, PETSC_ERR_ARG_INCOMP,
                                   "Cannot place PETSc Vec of length %D in CeedVector of length %D",
-                                  mpetsc, mceed);
+                                  mpetsc, (PetscInt)mceed);
   ierr = VecGetArray(p, &a); CHKERRQ(ierr);
   CeedVectorSetArray(c, CEED_MEM_HOST, CEED_USE_POINTER, a);
   PetscFunctionReturn(0);
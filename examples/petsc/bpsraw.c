@@ -370,7 +370,7 @@ static PetscErrorCode ComputeErrorMax(User user, CeedOperator operror, Vec X,
   PetscScalar *x;
   PetscMemType memtype;
   CeedVector collocated_error;
-  CeedInt length;
+  CeedSize length;
 
   PetscFunctionBeginUser;
 
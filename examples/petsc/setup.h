@@ -899,7 +899,7 @@ static PetscErrorCode ComputeErrorMax(UserO user, CeedOperator op_error,
   PetscScalar *x;
   PetscMemType memtype;
   CeedVector collocated_error;
-  CeedInt length;
+  CeedSize length;
 
   PetscFunctionBeginUser;
   CeedVectorGetLength(target, &length);
@@ -802,7 +802,7 @@ static PetscErrorCode ComputeErrorMax(UserO user, CeedOperator op_error,
   PetscErrorCode ierr;
   PetscScalar *x;
   CeedVector collocated_error;
-  CeedInt length;
+  CeedSize length;
 
   PetscFunctionBeginUser;
   CeedVectorGetLength(target, &length);
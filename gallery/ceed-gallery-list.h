@@ -10,15 +10,21 @@
 // functions might depend on external libraries.
 
 MACRO(CeedQFunctionRegister_Identity)
+MACRO(CeedQFunctionRegister_Mass1DApplyOnTheFly)
 MACRO(CeedQFunctionRegister_Mass1DBuild)
+MACRO(CeedQFunctionRegister_Mass2DApplyOnTheFly)
 MACRO(CeedQFunctionRegister_Mass2DBuild)
+MACRO(CeedQFunctionRegister_Mass3DApplyOnTheFly)
 MACRO(CeedQFunctionRegister_Mass3DBuild)
 MACRO(CeedQFunctionRegister_MassApply)
 MACRO(CeedQFunctionRegister_Poisson1DApply)
+MACRO(CeedQFunctionRegister_Poisson1DApplyOnTheFly)
 MACRO(CeedQFunctionRegister_Poisson1DBuild)
 MACRO(CeedQFunctionRegister_Poisson2DApply)
+MACRO(CeedQFunctionRegister_Poisson2DApplyOnTheFly)
 MACRO(CeedQFunctionRegister_Poisson2DBuild)
 MACRO(CeedQFunctionRegister_Poisson3DApply)
+MACRO(CeedQFunctionRegister_Poisson3DApplyOnTheFly)
 MACRO(CeedQFunctionRegister_Poisson3DBuild)
 MACRO(CeedQFunctionRegister_Scale)
 MACRO(CeedQFunctionRegister_Template)
@@ -0,0 +1,44 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+/**
+  @brief Ceed QFunction for applying the 2D mass matrix,
+           computing the geometric data at each quadrature point
+**/
+
+#ifndef mass2dapplyonthefly_h
+#define mass2dapplyonthefly_h
+
+CEED_QFUNCTION(Mass2DApplyOnTheFly)(void *ctx, const CeedInt Q,
+                                    const CeedScalar *const *in,
+                                    CeedScalar *const *out) {
+  // in[0] is u, size (Q)
+  // in[1] is Jacobians with shape [2, nc=2, Q]
+  // in[2] is quadrature weights, size (Q)
+  const CeedScalar *u = in[0], *J = in[1], *qw = in[2];
+  // out[0] is v, size (Q)
+  CeedScalar *v = out[0];
+
+  // Quadrature point loop
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<Q; i++) {
+    v[i] = u[i] * (J[i+Q*0]*J[i+Q*3] - J[i+Q*1]*J[i+Q*2]) * qw[i];
+  } // End of Quadrature Point Loop
+
+  return 0;
+}
+
+#endif // mass2dapplyonthefly_h
@@ -0,0 +1,60 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+/**
+  @brief Ceed QFunction for applying the 2D Poisson operator,
+           computing the geometric data at each quadrature point
+**/
+
+#ifndef poisson2dapplyonthefly_h
+#define poisson2dapplyonthefly_h
+
+CEED_QFUNCTION(Poisson2DApplyOnTheFly)(void *ctx, const CeedInt Q,
+                                       const CeedScalar *const *in,
+                                       CeedScalar *const *out) {
+  // in[0] is gradient u, shape [2, nc=1, Q]
+  // in[1] is Jacobians with shape [2, nc=2, Q]
+  // in[2] is quadrature weights, size (Q)
+  const CeedScalar *ug = in[0], *J = in[1], *qw = in[2];
+
+  // out[0] is output to multiply against gradient v, shape [2, nc=1, Q]
+  CeedScalar *vg = out[0];
+
+  // Quadrature point loop
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<Q; i++) {
+    // Compute qw/det(J).adj(J).adj(J)^T, as in Poisson2DBuild
+    // J: 0 2   adj(J):  J22 -J12
+    //    1 3           -J21  J11
+    const CeedScalar J11 = J[i+Q*0];
+    const CeedScalar J21 = J[i+Q*1];
+    const CeedScalar J12 = J[i+Q*2];
+    const CeedScalar J22 = J[i+Q*3];
+    const CeedScalar w = qw[i] / (J11*J22 - J21*J12);
+    const CeedScalar dXdxdXdxT[3] = {  w * (J12*J12 + J22*J22),
+                                       w * (J11*J11 + J21*J21),
+                                     - w * (J11*J12 + J21*J22)
+                                    };
+
+    // Apply Poisson operator
+    vg[i+Q*0] = ug[i+Q*0]*dXdxdXdxT[0] + ug[i+Q*1]*dXdxdXdxT[2];
+    vg[i+Q*1] = ug[i+Q*0]*dXdxdXdxT[2] + ug[i+Q*1]*dXdxdXdxT[1];
+  } // End of Quadrature Point Loop
+
+  return 0;
+}
+
+#endif // poisson2dapplyonthefly_h
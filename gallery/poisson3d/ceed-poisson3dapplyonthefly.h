@@ -0,0 +1,62 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+/**
+  @brief Ceed QFunction for applying the 3D Poisson operator,
+           computing the geometric data at each quadrature point
+**/
+
+#ifndef poisson3dapplyonthefly_h
+#define poisson3dapplyonthefly_h
+
+CEED_QFUNCTION(Poisson3DApplyOnTheFly)(void *ctx, const CeedInt Q,
+                                       const CeedScalar *const *in,
+                                       CeedScalar *const *out) {
+  // in[0] is gradient u, shape [3, nc=1, Q]
+  // in[1] is Jacobians with shape [3, nc=3, Q]
+  // in[2] is quadrature weights, size (Q)
+  const CeedScalar *ug = in[0], *J = in[1], *qw = in[2];
+
+  // out[0] is output to multiply against gradient v, shape [3, nc=1, Q]
+  CeedScalar *vg = out[0];
+
+  // Quadrature point loop
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<Q; i++) {
+    // Compute the adjoint, as in Poisson3DBuild
+    CeedScalar A[3][3];
+    for (CeedInt j=0; j<3; j++)
+      for (CeedInt k=0; k<3; k++)
+        A[k][j] = J[i+Q*((j+1)%3+3*((k+1)%3))]*J[i+Q*((j+2)%3+3*((k+2)%3))] -
+                  J[i+Q*((j+1)%3+3*((k+2)%3))]*J[i+Q*((j+2)%3+3*((k+1)%3))];
+
+    // Compute quadrature weight / det(J)
+    const CeedScalar w = qw[i] / (J[i+Q*0]*A[0][0] + J[i+Q*1]*A[1][1] +
+                                  J[i+Q*2]*A[2][2]);
+
+    // Apply qw/det(J).adj(J).adj(J)^T as two products with adj(J), rather
+    //   than forming the symmetric matrix stored by Poisson3DBuild
+    CeedScalar t[3];
+    for (CeedInt k=0; k<3; k++)
+      t[k] = w * (A[0][k]*ug[i+Q*0] + A[1][k]*ug[i+Q*1] + A[2][k]*ug[i+Q*2]);
+    for (CeedInt j=0; j<3; j++)
+      vg[i+Q*j] = A[j][0]*t[0] + A[j][1]*t[1] + A[j][2]*t[2];
+  } // End of Quadrature Point Loop
+
+  return 0;
+}
+
+#endif // poisson3dapplyonthefly_h
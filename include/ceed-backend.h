@@ -30,6 +30,81 @@
 #define CEED_COMPOSITE_MAX 16
 #define CEED_EPSILON 1E-16
 
+/// Atomic operations for state shared by operators applied concurrently,
+///   such as reader counts and data built on first use; exchange and
+///   compare-exchange are for pointer fields, and compare-exchange stores the
+///   current value in expected when it fails
+#if defined(__GNUC__) || defined(__clang__) || defined(__INTEL_COMPILER)
+#  define CeedAtomicAdd(var, val) \
+  __atomic_add_fetch(&(var), (val), __ATOMIC_SEQ_CST)
+#  define CeedAtomicLoad(var) __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#  define CeedAtomicStore(var, val) \
+  __atomic_store_n(&(var), (val), __ATOMIC_RELEASE)
+#  define CeedAtomicExchange(var, val) \
+  __atomic_exchange_n(&(var), (val), __ATOMIC_ACQ_REL)
+#  define CeedAtomicCompareExchange(var, expected, desired) \
+  __atomic_compare_exchange_n(&(var), &(expected), (desired), false, \
+                              __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#  define CeedSpinLock(lock) \
+  while (__atomic_test_and_set(&(lock), __ATOMIC_ACQUIRE))
+#  define CeedSpinUnlock(lock) __atomic_clear(&(lock), __ATOMIC_RELEASE)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && \
+      !defined(__STDC_NO_ATOMICS__)
+#  include <stdatomic.h>
+#  include <stdint.h>
+// Shared state is held in plain bool, uint64_t, and pointer fields, accessed
+//   through the _Atomic type of the same size
+#  define CeedAtomicAdd(var, val) \
+  atomic_fetch_add_explicit((_Atomic uint64_t *)&(var), (val), \
+                            memory_order_seq_cst)
+#  define CeedAtomicLoad(var) _Generic((var), \
+  bool: atomic_load_explicit((_Atomic bool *)&(var), memory_order_acquire), \
+  default: atomic_load_explicit((void *_Atomic *)&(var), \
+                                memory_order_acquire))
+#  define CeedAtomicStore(var, val) _Generic((var), \
+  bool: atomic_store_explicit((_Atomic bool *)&(var), (bool)(val), \
+                              memory_order_release), \
+  default: atomic_store_explicit((void *_Atomic *)&(var), \
+                                 (void *)(uintptr_t)(val), \
+                                 memory_order_release))
+#  define CeedAtomicExchange(var, val) \
+  atomic_exchange_explicit((void *_Atomic *)&(var), (val), \
+                           memory_order_acq_rel)
+#  define CeedAtomicCompareExchange(var, expected, desired) \
+  atomic_compare_exchange_strong_explicit((void *_Atomic *)&(var), \
+      (void **)&(expected), (desired), memory_order_acq_rel, \
+      memory_order_acquire)
+#  define CeedSpinLock(lock) \
+  while (atomic_exchange_explicit((_Atomic bool *)&(lock), true, \
+                                  memory_order_acquire))
+#  define CeedSpinUnlock(lock) \
+  atomic_store_explicit((_Atomic bool *)&(lock), false, memory_order_release)
+#else
+// Without atomics, objects must not be used by several threads at once
+#  define CeedAtomicAdd(var, val) ((var) += (val))
+#  define CeedAtomicLoad(var) (var)
+#  define CeedAtomicStore(var, val) ((var) = (val))
+static inline void *CeedExchange(void **var, void *val) {
+  void *old = *var;
+  *var = val;
+  return old;
+}
+static inline bool CeedCompareExchange(void **var, void **expected,
+                                       void *desired) {
+  if (*var != *expected) {
+    *expected = *var;
+    return false;
+  }
+  *var = desired;
+  return true;
+}
+#  define CeedAtomicExchange(var, val) CeedExchange((void **)&(var), (val))
+#  define CeedAtomicCompareExchange(var, expected, desired) \
+  CeedCompareExchange((void **)&(var), (void **)&(expected), (desired))
+#  define CeedSpinLock(lock) ((lock) = true)
+#  define CeedSpinUnlock(lock) ((lock) = false)
+#endif
+
 /// CEED_DEBUG_COLOR default value, forward CeedDebug* declarations & macros
 #ifndef CEED_DEBUG_COLOR
 #define CEED_DEBUG_COLOR 0
@@ -90,12 +165,19 @@ CEED_EXTERN int CeedSetBackendFunction(Ceed ceed,
                                        const char *fname, int (*f)());
 CEED_EXTERN int CeedGetData(Ceed ceed, void *data);
 CEED_EXTERN int CeedSetData(Ceed ceed, void *data);
+CEED_EXTERN int CeedGetResourceRoot(Ceed ceed, const char *resource,
+                                    char **resourceroot);
+CEED_EXTERN int CeedGetResourceOption(Ceed ceed, const char *resource,
+                                      const char *key, char **value);
+CEED_EXTERN int CeedInitDelegate(const char *resource,
+                                 const char *parentresource, Ceed *ceed);
 
 CEED_EXTERN int CeedVectorGetCeed(CeedVector vec, Ceed *ceed);
 CEED_EXTERN int CeedVectorGetState(CeedVector vec, uint64_t *state);
 CEED_EXTERN int CeedVectorAddReference(CeedVector vec);
 CEED_EXTERN int CeedVectorGetData(CeedVector vec, void *data);
 CEED_EXTERN int CeedVectorSetData(CeedVector vec, void *data);
+CEED_EXTERN int CeedVectorGetMemoryUsage(CeedVector vec, CeedSize *bytes);
 
 CEED_EXTERN int CeedElemRestrictionGetCeed(CeedElemRestriction rstr,
     Ceed *ceed);
@@ -105,8 +187,17 @@ CEED_EXTERN int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr,
     CeedMemType mtype, const CeedInt **offsets);
 CEED_EXTERN int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr,
     const CeedInt **offsets);
+CEED_EXTERN int CeedElemRestrictionGetOffsets64(CeedElemRestriction rstr,
+    CeedMemType mtype, const CeedSize **offsets);
+CEED_EXTERN int CeedElemRestrictionRestoreOffsets64(CeedElemRestriction rstr,
+    const CeedSize **offsets);
+CEED_EXTERN int CeedElemRestrictionGetColoring(CeedElemRestriction rstr,
+    CeedInt *numcolors, const CeedInt **coloroffsets,
+    const CeedInt **colorblks);
 CEED_EXTERN int CeedElemRestrictionIsStrided(CeedElemRestriction rstr,
     bool *isstrided);
+CEED_EXTERN int CeedElemRestrictionHasOffsets64(CeedElemRestriction rstr,
+    bool *hasoffsets64);
 CEED_EXTERN int CeedElemRestrictionHasBackendStrides( CeedElemRestriction rstr,
     bool *hasbackendstrides);
 CEED_EXTERN int CeedElemRestrictionGetELayout(CeedElemRestriction rstr,
@@ -117,6 +208,8 @@ CEED_EXTERN int CeedElemRestrictionGetData(CeedElemRestriction rstr,
     void *data);
 CEED_EXTERN int CeedElemRestrictionSetData(CeedElemRestriction rstr,
     void *data);
+CEED_EXTERN int CeedElemRestrictionGetMemoryUsage(CeedElemRestriction rstr,
+    CeedSize *bytes);
 
 CEED_EXTERN int CeedBasisGetCollocatedGrad(CeedBasis basis,
     CeedScalar *colograd1d);
@@ -125,6 +218,7 @@ CEED_EXTERN int CeedHouseholderApplyQ(CeedScalar *A, const CeedScalar *Q,
                                       CeedInt k, CeedInt row, CeedInt col);
 CEED_EXTERN int CeedBasisGetCeed(CeedBasis basis, Ceed *ceed);
 CEED_EXTERN int CeedBasisIsTensor(CeedBasis basis, bool *istensor);
+CEED_EXTERN int CeedBasisIsCollapsed(CeedBasis basis, bool *iscollapsed);
 CEED_EXTERN int CeedBasisGetData(CeedBasis basis, void *data);
 CEED_EXTERN int CeedBasisSetData(CeedBasis basis, void *data);
 
@@ -135,6 +229,7 @@ CEED_EXTERN int CeedBasisGetTensorContract(CeedBasis basis,
     CeedTensorContract *contract);
 CEED_EXTERN int CeedBasisSetTensorContract(CeedBasis basis,
     CeedTensorContract *contract);
+CEED_EXTERN int CeedBasisGetMemoryUsage(CeedBasis basis, CeedSize *bytes);
 CEED_EXTERN int CeedTensorContractCreate(Ceed ceed, CeedBasis basis,
     CeedTensorContract *contract);
 CEED_EXTERN int CeedTensorContractApply(CeedTensorContract contract, CeedInt A,
@@ -206,6 +301,14 @@ CEED_EXTERN int CeedOperatorGetSubList(CeedOperator op,
 CEED_EXTERN int CeedOperatorGetData(CeedOperator op, void *data);
 CEED_EXTERN int CeedOperatorSetData(CeedOperator op, void *data);
 CEED_EXTERN int CeedOperatorSetSetupDone(CeedOperator op);
+CEED_EXTERN int CeedOperatorSetup(CeedOperator op);
+CEED_EXTERN int CeedOperatorGetMemoryUsage(CeedOperator op, CeedSize *bytes);
+CEED_EXTERN int CeedOperatorWorkspaceGetOperator(CeedOperatorWorkspace ws,
+    CeedOperator *op);
+CEED_EXTERN int CeedOperatorWorkspaceGetData(CeedOperatorWorkspace ws,
+    void *data);
+CEED_EXTERN int CeedOperatorWorkspaceSetData(CeedOperatorWorkspace ws,
+    void *data);
 
 CEED_EXTERN int CeedOperatorGetFields(CeedOperator op,
                                       CeedOperatorField **inputfields,
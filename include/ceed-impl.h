@@ -102,11 +102,15 @@ struct Ceed_private {
                va_list *);
   int (*GetPreferredMemType)(CeedMemType *);
   int (*Destroy)(Ceed);
-  int (*VectorCreate)(CeedInt, CeedVector);
+  int (*VectorCreate)(CeedSize, CeedVector);
   int (*ElemRestrictionCreate)(CeedMemType, CeedCopyMode,
                                const CeedInt *, CeedElemRestriction);
   int (*ElemRestrictionCreateBlocked)(CeedMemType, CeedCopyMode,
                                       const CeedInt *, CeedElemRestriction);
+  int (*ElemRestrictionCreate64)(CeedMemType, CeedCopyMode,
+                                 const CeedSize *, CeedElemRestriction);
+  int (*ElemRestrictionCreateBlocked64)(CeedMemType, CeedCopyMode,
+                                        const CeedSize *, CeedElemRestriction);
   int (*BasisCreateTensorH1)(CeedInt, CeedInt, CeedInt, const CeedScalar *,
                              const CeedScalar *, const CeedScalar *,
                              const CeedScalar *, CeedBasis);
@@ -114,6 +118,9 @@ struct Ceed_private {
                        const CeedScalar *,
                        const CeedScalar *, const CeedScalar *,
                        const CeedScalar *, CeedBasis);
+  int (*BasisCreateCollapsed)(CeedElemTopology, CeedInt, CeedInt, CeedInt,
+                              const CeedScalar *, const CeedScalar *,
+                              const CeedScalar *, CeedBasis);
   int (*TensorContractCreate)(CeedBasis, CeedTensorContract);
   int (*QFunctionCreate)(CeedQFunction);
   int (*QFunctionContextCreate)(CeedQFunctionContext);
@@ -139,9 +146,10 @@ struct CeedVector_private {
   int (*RestoreArrayRead)(CeedVector);
   int (*Norm)(CeedVector, CeedNormType, CeedScalar *);
   int (*Reciprocal)(CeedVector);
+  int (*GetMemoryUsage)(CeedVector, CeedSize *);
   int (*Destroy)(CeedVector);
   int refcount;
-  CeedInt length;
+  CeedSize length;
   uint64_t state;
   uint64_t numreaders;
   void *data;
@@ -154,17 +162,24 @@ struct CeedElemRestriction_private {
   int (*ApplyBlock)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector,
                     CeedVector, CeedRequest *);
   int (*GetOffsets)(CeedElemRestriction, CeedMemType, const CeedInt **);
+  int (*GetOffsets64)(CeedElemRestriction, CeedMemType, const CeedSize **);
+  int (*GetColoring)(CeedElemRestriction, CeedInt *, const CeedInt **,
+                     const CeedInt **);
+  int (*GetMultiplicity)(CeedElemRestriction, CeedVector);
+  int (*GetMemoryUsage)(CeedElemRestriction, CeedSize *);
   int (*Destroy)(CeedElemRestriction);
   int refcount;
   CeedInt nelem;            /* number of elements */
   CeedInt elemsize;         /* number of nodes per element */
   CeedInt ncomp;            /* number of components */
   CeedInt compstride;       /* Component stride for L-vector ordering */
-  CeedInt lsize;            /* size of the L-vector, can be used for checking
+  CeedSize lsize;           /* size of the L-vector, can be used for checking
                                  for correct vector sizes */
   CeedInt blksize;          /* number of elements in a batch */
   CeedInt nblk;             /* number of blocks of elements */
   CeedInt *strides;         /* strides between [nodes, components, elements] */
+  bool offsets64;           /* offsets are CeedSize, beyond the range of
+                                 CeedInt */
   CeedInt layout[3];        /* E-vector layout [nodes, components, elements] */
   uint64_t numreaders;      /* number of instances of offset read only access */
   void *data;               /* place for the backend to store any data */
@@ -174,9 +189,12 @@ struct CeedBasis_private {
   Ceed ceed;
   int (*Apply)(CeedBasis, CeedInt, CeedTransposeMode, CeedEvalMode,
                CeedVector, CeedVector);
+  int (*ApplyInterpGrad)(CeedBasis, CeedInt, CeedVector, CeedVector);
+  int (*GetMemoryUsage)(CeedBasis, CeedSize *);
   int (*Destroy)(CeedBasis);
   int refcount;
   bool tensorbasis;      /* flag for tensor basis */
+  bool collapsedbasis;   /* flag for collapsed-coordinate simplex basis */
   CeedInt dim;           /* topological dimension */
   CeedElemTopology topo; /* element topology */
   CeedInt ncomp;         /* number of field components (1 for scalar fields) */
@@ -194,13 +212,19 @@ struct CeedBasis_private {
                    nodal basis functions at quadrature points */
   CeedScalar
   *interp1d;  /* row-major matrix of shape [Q1d, P1d] expressing the values of
-                   nodal basis functions at quadrature points */
+                   nodal basis functions at quadrature points, or the
+                   collapsed coordinate factors of a collapsed basis */
   CeedScalar
   *grad;      /* row-major matrix of shape [dim*Q, P] matrix expressing
                    derivatives of nodal basis functions at quadrature points */
   CeedScalar
   *grad1d;    /* row-major matrix of shape [Q1d, P1d] matrix expressing
-                   derivatives of nodal basis functions at quadrature points */
+                   derivatives of nodal basis functions at quadrature points,
+                   or the derivatives of the collapsed coordinate factors */
+  CeedScalar
+  *dcollapsed; /* array of shape [Q, dim, dim] holding the derivatives of the
+                    collapsed coordinates with respect to the reference
+                    coordinates at quadrature points, for collapsed bases */
   CeedTensorContract contract; /* tensor contraction object */
   void *data;                  /* place for the backend to store any data */
 };
@@ -250,6 +274,7 @@ struct CeedQFunctionContext_private {
   int (*RestoreData)(CeedQFunctionContext);
   int (*Destroy)(CeedQFunctionContext);
   uint64_t state;
+  uint64_t numreaders;
   size_t ctxsize;
   void *data;
 };
@@ -298,13 +323,29 @@ struct CeedOperator_private {
                                           CeedRequest *);
   int (*LinearAssembleAddPointBlockDiagonal)(CeedOperator, CeedVector,
       CeedRequest *);
+  int (*LinearAssembleSymbolic)(CeedOperator, CeedSize *, CeedSize **,
+                                CeedSize **);
+  int (*LinearAssemble)(CeedOperator, CeedVector);
+  int (*AssembleElementMatrices)(CeedOperator, CeedVector *, CeedRequest *);
   int (*CreateFDMElementInverse)(CeedOperator, CeedOperator *, CeedRequest *);
+  int (*CreateElementBlockJacobiInverse)(CeedOperator, CeedOperator *,
+                                         CeedRequest *);
+  int (*Setup)(CeedOperator);
   int (*Apply)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAdd)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAddComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyJacobian)(CeedOperator, CeedVector, CeedVector, CeedVector,
                        CeedVector, CeedRequest *);
+  // One CeedOperatorSmoother iteration, see CeedOperatorSmootherStep()
+  int (*ApplyChebyshevStep)(CeedOperator, CeedVector, CeedVector, CeedVector,
+                            CeedScalar, CeedScalar, CeedVector, CeedVector,
+                            CeedVector, CeedVector, CeedRequest *);
+  int (*GetMemoryUsage)(CeedOperator, CeedSize *);
+  int (*WorkspaceCreate)(CeedOperator, CeedOperatorWorkspace);
+  int (*WorkspaceApplyAdd)(CeedOperatorWorkspace, CeedVector, CeedVector,
+                           CeedRequest *);
+  int (*WorkspaceDestroy)(CeedOperatorWorkspace);
   int (*Destroy)(CeedOperator);
   CeedOperatorField *inputfields;
   CeedOperatorField *outputfields;
@@ -317,9 +358,49 @@ struct CeedOperator_private {
   bool setupdone;
   bool composite;
   bool hasrestriction;
+  CeedScalarType precision; /// Precision of the element computations
+  CeedScalarType passiveprecision; /// Storage of passive CEED_EVAL_NONE inputs
   CeedOperator *suboperators;
   CeedInt numsub;
   void *data;
 };
 
+struct CeedOperatorWorkspace_private {
+  CeedOperator op;               /// Operator the workspace was created for
+  CeedOperatorWorkspace *subws;  /// Workspaces of the suboperators
+  void *data;                    /// Backend scratch data
+  CeedOperator clone;            /// Shallow copy owning the scratch data, for
+                                 ///   backends without workspace support
+};
+
+// Number of Lanczos steps used to estimate the spectrum of the Jacobi
+//   preconditioned operator for Chebyshev smoothing
+#define CEED_SMOOTHER_LANCZOS_STEPS 10
+
+struct CeedOperatorSmoother_private {
+  CeedOperator op;  /// Operator being smoothed
+  CeedVector dinv;  /// Inverse of the operator diagonal
+  CeedVector r;     /// Residual
+  CeedVector d;     /// Chebyshev update direction
+  CeedVector z;     /// Operator applied to the update direction
+  CeedInt degree;   /// Number of Chebyshev iterations per application
+  CeedScalar lmin;  /// Lower end of the Chebyshev interval
+  CeedScalar lmax;  /// Upper end of the Chebyshev interval
+};
+
+// Levels are ordered from the coarsest, level 0, to the fine level
+struct CeedMultigridHierarchy_private {
+  CeedInt numlevels;           /// Number of levels, including the fine level
+  CeedInt *degrees;            /// Polynomial degree on each level
+  CeedOperator *ops;           /// Operator on each level
+  CeedOperator *opsprolong;    /// Prolongation from level l-1 to level l
+  CeedOperator *opsrestrict;   /// Restriction from level l to level l-1
+  CeedElemRestriction *rstrs;  /// Active restriction on each level
+  CeedVector *diags;           /// Assembled operator diagonal on each level
+  CeedVector *mults;           /// Multiplicity of each level restriction
+  CeedInt numbases;            /// Number of distinct coarse bases
+  CeedBasis *bases;            /// Coarse bases, shared between levels and
+                               ///   sub-operators with the same (P, Q)
+};
+
 #endif
@@ -105,6 +105,7 @@
 #  endif
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -113,6 +114,10 @@
 /// Integer type, used for indexing
 /// @ingroup Ceed
 typedef int32_t CeedInt;
+/// Integer type, used for vector lengths and L-vector sizes, which may
+///   exceed the range of CeedInt
+/// @ingroup Ceed
+typedef ptrdiff_t CeedSize;
 /// Scalar (floating point) type
 /// @ingroup Ceed
 typedef double CeedScalar;
@@ -147,6 +152,18 @@ typedef struct CeedQFunctionContext_private *CeedQFunctionContext;
 ///   acting on the vector \f$u\f$.
 /// @ingroup CeedOperatorUser
 typedef struct CeedOperator_private *CeedOperator;
+/// Handle for per-caller scratch state used to apply a shared CeedOperator
+///   concurrently from several threads
+/// @ingroup CeedOperatorUser
+typedef struct CeedOperatorWorkspace_private *CeedOperatorWorkspace;
+/// Handle for a Chebyshev polynomial smoother with Jacobi preconditioning
+///   built around a linear CeedOperator
+/// @ingroup CeedOperatorUser
+typedef struct CeedOperatorSmoother_private *CeedOperatorSmoother;
+/// Handle for a p-multigrid hierarchy of CeedOperators, level transfer
+///   operators, diagonals, and multiplicities built from a fine CeedOperator
+/// @ingroup CeedOperatorUser
+typedef struct CeedMultigridHierarchy_private *CeedMultigridHierarchy;
 
 CEED_EXTERN int CeedInit(const char *resource, Ceed *ceed);
 CEED_EXTERN int CeedGetResource(Ceed ceed, const char **resource);
@@ -236,7 +253,7 @@ typedef enum {
 
 CEED_EXTERN const char *const CeedCopyModes[];
 
-CEED_EXTERN int CeedVectorCreate(Ceed ceed, CeedInt len, CeedVector *vec);
+CEED_EXTERN int CeedVectorCreate(Ceed ceed, CeedSize len, CeedVector *vec);
 CEED_EXTERN int CeedVectorSetArray(CeedVector vec, CeedMemType mtype,
                                    CeedCopyMode cmode, CeedScalar *array);
 CEED_EXTERN int CeedVectorSetValue(CeedVector vec, CeedScalar value);
@@ -254,7 +271,7 @@ CEED_EXTERN int CeedVectorNorm(CeedVector vec, CeedNormType type,
                                CeedScalar *norm);
 CEED_EXTERN int CeedVectorReciprocal(CeedVector vec);
 CEED_EXTERN int CeedVectorView(CeedVector vec, const char *fpfmt, FILE *stream);
-CEED_EXTERN int CeedVectorGetLength(CeedVector vec, CeedInt *length);
+CEED_EXTERN int CeedVectorGetLength(CeedVector vec, CeedSize *length);
 CEED_EXTERN int CeedVectorDestroy(CeedVector *vec);
 
 CEED_EXTERN CeedRequest *const CEED_REQUEST_IMMEDIATE;
@@ -306,19 +323,27 @@ CEED_EXTERN const char *const CeedTransposeModes[];
 CEED_EXTERN const CeedInt CEED_STRIDES_BACKEND[3];
 
 CEED_EXTERN int CeedElemRestrictionCreate(Ceed ceed, CeedInt nelem,
-    CeedInt elemsize, CeedInt ncomp, CeedInt compstride, CeedInt lsize,
+    CeedInt elemsize, CeedInt ncomp, CeedInt compstride, CeedSize lsize,
     CeedMemType mtype, CeedCopyMode cmode, const CeedInt *offsets,
     CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreate64(Ceed ceed, CeedInt nelem,
+    CeedInt elemsize, CeedInt ncomp, CeedInt compstride, CeedSize lsize,
+    CeedMemType mtype, CeedCopyMode cmode, const CeedSize *offsets,
+    CeedElemRestriction *rstr);
 CEED_EXTERN int CeedElemRestrictionCreateStrided(Ceed ceed,
-    CeedInt nelem, CeedInt elemsize, CeedInt ncomp, CeedInt lsize,
+    CeedInt nelem, CeedInt elemsize, CeedInt ncomp, CeedSize lsize,
     const CeedInt strides[3], CeedElemRestriction *rstr);
 CEED_EXTERN int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt nelem,
     CeedInt elemsize, CeedInt blksize, CeedInt ncomp, CeedInt compstride,
-    CeedInt lsize, CeedMemType mtype, CeedCopyMode cmode,
+    CeedSize lsize, CeedMemType mtype, CeedCopyMode cmode,
     const CeedInt *offsets, CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreateBlocked64(Ceed ceed, CeedInt nelem,
+    CeedInt elemsize, CeedInt blksize, CeedInt ncomp, CeedInt compstride,
+    CeedSize lsize, CeedMemType mtype, CeedCopyMode cmode,
+    const CeedSize *offsets, CeedElemRestriction *rstr);
 CEED_EXTERN int CeedElemRestrictionCreateBlockedStrided(Ceed ceed,
     CeedInt nelem, CeedInt elemsize, CeedInt blksize, CeedInt ncomp,
-    CeedInt lsize, const CeedInt strides[3], CeedElemRestriction *rstr);
+    CeedSize lsize, const CeedInt strides[3], CeedElemRestriction *rstr);
 CEED_EXTERN int CeedElemRestrictionCreateVector(CeedElemRestriction rstr,
     CeedVector *lvec, CeedVector *evec);
 CEED_EXTERN int CeedElemRestrictionApply(CeedElemRestriction rstr,
@@ -333,7 +358,7 @@ CEED_EXTERN int CeedElemRestrictionGetNumElements(CeedElemRestriction rstr,
 CEED_EXTERN int CeedElemRestrictionGetElementSize(CeedElemRestriction rstr,
     CeedInt *elemsize);
 CEED_EXTERN int CeedElemRestrictionGetLVectorSize(CeedElemRestriction rstr,
-    CeedInt *lsize);
+    CeedSize *lsize);
 CEED_EXTERN int CeedElemRestrictionGetNumComponents(CeedElemRestriction rstr,
     CeedInt *numcomp);
 CEED_EXTERN int CeedElemRestrictionGetNumBlocks(CeedElemRestriction rstr,
@@ -406,6 +431,32 @@ typedef enum {
 
 CEED_EXTERN const char *const CeedElemTopologies[];
 
+/// Floating point precision of the element computations of a CeedOperator
+/// @ingroup CeedOperator
+typedef enum {
+  /// Single precision
+  CEED_SCALAR_FP32 = 0,
+  /// Double precision
+  CEED_SCALAR_FP64 = 1,
+  /// Brain floating point, 8 exponent and 7 mantissa bits; storage only
+  CEED_SCALAR_BF16 = 2,
+} CeedScalarType;
+
+CEED_EXTERN const char *const CeedScalarTypes[];
+
+/// Degree schedule for the coarse levels of a CeedMultigridHierarchy
+/// @ingroup CeedOperator
+typedef enum {
+  /// Halve the polynomial degree on each level down to degree 1
+  CEED_MULTIGRID_COARSEN_HALF = 0,
+  /// Coarsen directly from the fine degree to degree 1
+  CEED_MULTIGRID_COARSEN_LINEAR = 1,
+  /// Use a list of coarse degrees given by the user
+  CEED_MULTIGRID_COARSEN_USER = 2,
+} CeedMultigridCoarsenMode;
+
+CEED_EXTERN const char *const CeedMultigridCoarsenModes[];
+
 CEED_EXTERN int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim,
     CeedInt ncomp, CeedInt P, CeedInt Q, CeedQuadMode qmode, CeedBasis *basis);
 CEED_EXTERN int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt ncomp,
@@ -422,6 +473,9 @@ CEED_EXTERN int CeedBasisCreateH1(Ceed ceed, CeedElemTopology topo,
                                   const CeedScalar *grad,
                                   const CeedScalar *qref,
                                   const CeedScalar *qweight, CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateSimplex(Ceed ceed, CeedElemTopology topo,
+                                       CeedInt ncomp, CeedInt degree,
+                                       CeedInt Q1d, CeedBasis *basis);
 CEED_EXTERN int CeedBasisView(CeedBasis basis, FILE *stream);
 CEED_EXTERN int CeedBasisApply(CeedBasis basis, CeedInt nelem,
                                CeedTransposeMode tmode,
@@ -507,6 +561,10 @@ CEED_EXTERN int CeedQFunctionContextGetData(CeedQFunctionContext ctx,
     void *data);
 CEED_EXTERN int CeedQFunctionContextRestoreData(CeedQFunctionContext ctx,
     void *data);
+CEED_EXTERN int CeedQFunctionContextGetDataRead(CeedQFunctionContext ctx,
+    CeedMemType mtype, void *data);
+CEED_EXTERN int CeedQFunctionContextRestoreDataRead(CeedQFunctionContext ctx,
+    void *data);
 CEED_EXTERN int CeedQFunctionContextView(CeedQFunctionContext ctx,
     FILE *stream);
 CEED_EXTERN int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx);
@@ -520,6 +578,12 @@ CEED_EXTERN int CeedOperatorSetField(CeedOperator op, const char *fieldname,
                                      CeedVector v);
 CEED_EXTERN int CeedCompositeOperatorAddSub(CeedOperator compositeop,
     CeedOperator subop);
+CEED_EXTERN int CeedOperatorSetPrecision(CeedOperator op, CeedScalarType prec);
+CEED_EXTERN int CeedOperatorGetPrecision(CeedOperator op, CeedScalarType *prec);
+CEED_EXTERN int CeedOperatorSetPassivePrecision(CeedOperator op,
+    CeedScalarType prec);
+CEED_EXTERN int CeedOperatorGetPassivePrecision(CeedOperator op,
+    CeedScalarType *prec);
 CEED_EXTERN int CeedOperatorLinearAssembleQFunction(CeedOperator op,
     CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request);
 CEED_EXTERN int CeedOperatorLinearAssembleDiagonal(CeedOperator op,
@@ -530,6 +594,11 @@ CEED_EXTERN int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op,
     CeedVector assembled, CeedRequest *request);
 CEED_EXTERN int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op,
     CeedVector assembled, CeedRequest *request);
+CEED_EXTERN int CeedOperatorLinearAssembleSymbolic(CeedOperator op,
+    CeedSize *nentries, CeedSize **rows, CeedSize **cols);
+CEED_EXTERN int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values);
+CEED_EXTERN int CeedOperatorAssembleElementMatrices(CeedOperator op,
+    CeedVector *assembled, CeedRequest *request);
 CEED_EXTERN int CeedOperatorMultigridLevelCreate(CeedOperator opFine,
     CeedVector PMultFine, CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
     CeedOperator *opCoarse, CeedOperator *opProlong, CeedOperator *opRestrict);
@@ -543,6 +612,8 @@ CEED_EXTERN int CeedOperatorMultigridLevelCreateH1(CeedOperator opFine,
     CeedOperator *opProlong, CeedOperator *opRestrict);
 CEED_EXTERN int CeedOperatorCreateFDMElementInverse(CeedOperator op,
     CeedOperator *fdminv, CeedRequest *request);
+CEED_EXTERN int CeedOperatorCreateElementBlockJacobiInverse(CeedOperator op,
+    CeedOperator *blkinv, CeedRequest *request);
 CEED_EXTERN int CeedOperatorView(CeedOperator op, FILE *stream);
 CEED_EXTERN int CeedOperatorApply(CeedOperator op, CeedVector in,
                                   CeedVector out, CeedRequest *request);
@@ -550,6 +621,35 @@ CEED_EXTERN int CeedOperatorApplyAdd(CeedOperator op, CeedVector in,
                                      CeedVector out, CeedRequest *request);
 CEED_EXTERN int CeedOperatorDestroy(CeedOperator *op);
 
+CEED_EXTERN int CeedOperatorWorkspaceCreate(CeedOperator op,
+    CeedOperatorWorkspace *ws);
+CEED_EXTERN int CeedOperatorWorkspaceApply(CeedOperatorWorkspace ws,
+    CeedVector in, CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorWorkspaceApplyAdd(CeedOperatorWorkspace ws,
+    CeedVector in, CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorWorkspaceDestroy(CeedOperatorWorkspace *ws);
+
+CEED_EXTERN int CeedOperatorSmootherCreateChebyshev(CeedOperator op,
+    CeedVector diag, CeedInt degree, CeedOperatorSmoother *smoother);
+CEED_EXTERN int CeedOperatorSmootherGetEigenvalueBounds(
+  CeedOperatorSmoother smoother, CeedScalar *lmin, CeedScalar *lmax);
+CEED_EXTERN int CeedOperatorSmootherApply(CeedOperatorSmoother smoother,
+    CeedVector b, CeedVector x, CeedRequest *request);
+CEED_EXTERN int CeedOperatorSmootherDestroy(CeedOperatorSmoother *smoother);
+
+CEED_EXTERN int CeedMultigridHierarchyCreate(CeedOperator opFine,
+    CeedMultigridCoarsenMode mode, CeedInt numdegrees, const CeedInt *degrees,
+    CeedMultigridHierarchy *hierarchy);
+CEED_EXTERN int CeedMultigridHierarchyGetNumLevels(
+  CeedMultigridHierarchy hierarchy, CeedInt *numlevels);
+CEED_EXTERN int CeedMultigridHierarchyGetLevel(CeedMultigridHierarchy hierarchy,
+    CeedInt level, CeedInt *degree, CeedOperator *op, CeedOperator *opProlong,
+    CeedOperator *opRestrict, CeedVector *diag, CeedVector *mult);
+CEED_EXTERN int CeedMultigridHierarchyGetMemoryUsage(
+  CeedMultigridHierarchy hierarchy, CeedSize *bytes);
+CEED_EXTERN int CeedMultigridHierarchyDestroy(
+  CeedMultigridHierarchy *hierarchy);
+
 /**
   @brief Return integer power
 
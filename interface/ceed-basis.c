@@ -176,6 +176,204 @@ static int CeedScalarView(const char *name, const char *fpformat, CeedInt m,
   return 0;
 }
 
+/**
+  @brief Evaluate the Jacobi polynomial P_n^(alpha,beta) by its three-term
+           recurrence
+
+  @param n      Polynomial degree, 0 is returned for n < 0
+  @param alpha  First Jacobi parameter
+  @param beta   Second Jacobi parameter
+  @param x      Point in [-1, 1] to evaluate at
+
+  @return Value of the polynomial at x
+
+  @ref Developer
+**/
+static CeedScalar CeedJacobiPolynomial(CeedInt n, CeedScalar alpha,
+                                       CeedScalar beta, CeedScalar x) {
+  if (n < 0) return 0.0;
+  CeedScalar p0 = 1.0, p1 = 0.5*(alpha - beta + (alpha + beta + 2.0)*x);
+  if (n == 0) return p0;
+  for (CeedInt k=2; k<=n; k++) {
+    const CeedScalar s = 2*k + alpha + beta,
+                     a1 = 2*k*(k + alpha + beta)*(s - 2),
+                     a2 = (s - 1)*(alpha*alpha - beta*beta),
+                     a3 = (s - 2)*(s - 1)*s,
+                     a4 = 2*(k + alpha - 1)*(k + beta - 1)*s;
+    const CeedScalar p2 = ((a2 + a3*x)*p1 - a4*p0) / a1;
+    p0 = p1; p1 = p2;
+  }
+  return p1;
+}
+
+/**
+  @brief Tabulate the collapsed-coordinate factors of an orthonormal simplex
+           basis
+
+  The mode (i, j, k) of degree i + j + k <= degree is the product
+    A_i(a) B_ij(b) C_ijk(c) of Jacobi polynomials in the collapsed
+    coordinates (a, b, c) in [-1, 1]^dim, with modes ordered with k fastest.
+    The factors of each collapsed coordinate are stored one after the other;
+    the A_i form one row-major (Q1d * (degree + 1)) block, each B_ij for fixed
+    i forms a (Q1d * (degree - i + 1)) block, and, in 3D, each C_ijk for fixed
+    (i, j) forms a (Q1d * (degree - i - j + 1)) block.
+
+  @param dim            Topological dimension, 2 or 3
+  @param degree         Polynomial degree of the basis
+  @param Q1d            Number of quadrature points in each collapsed coordinate
+  @param qref1d         Gauss points of length Q1d on [-1, 1]
+  @param[out] interp1d  Factors at the quadrature points
+  @param[out] grad1d    Derivatives of the factors at the quadrature points
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisCollapsedFactors(CeedInt dim, CeedInt degree, CeedInt Q1d,
+                                     const CeedScalar *qref1d,
+                                     CeedScalar *interp1d,
+                                     CeedScalar *grad1d) {
+  const CeedInt p = degree, nij = (p+1)*(p+2)/2;
+  // Orthonormal on the reference simplex of volume 1/2 or 1/6
+  const CeedScalar scale = dim == 2 ? 2.0 : sqrt(8.0);
+
+  for (CeedInt q=0; q<Q1d; q++) {
+    const CeedScalar x = qref1d[q], w = 0.5*(1.0 - x);
+    // A_i(a) = P_i(a)
+    for (CeedInt i=0; i<=p; i++) {
+      const CeedScalar n = scale*sqrt(0.5*(2*i + 1));
+      interp1d[q*(p+1)+i] = n*CeedJacobiPolynomial(i, 0, 0, x);
+      grad1d[q*(p+1)+i] = n*0.5*(i + 1)*CeedJacobiPolynomial(i-1, 1, 1, x);
+    }
+    // B_ij(b) = ((1 - b)/2)^i P_j^(2i+1,0)(b)
+    CeedScalar *interpB = &interp1d[Q1d*(p+1)], *gradB = &grad1d[Q1d*(p+1)];
+    for (CeedInt i=0, ij=0; i<=p; ij+=p-i+1, i++)
+      for (CeedInt j=0; j<=p-i; j++) {
+        const CeedScalar n = sqrt(i + j + 1.0), wi = pow(w, i),
+                         pj = CeedJacobiPolynomial(j, 2*i+1, 0, x);
+        interpB[Q1d*ij + q*(p-i+1) + j] = n*wi*pj;
+        gradB[Q1d*ij + q*(p-i+1) + j] =
+          n*((i ? -0.5*i*pow(w, i-1)*pj : 0.0) +
+             wi*0.5*(j + 2*i + 2)*CeedJacobiPolynomial(j-1, 2*i+2, 1, x));
+      }
+    if (dim < 3) continue;
+    // C_ijk(c) = ((1 - c)/2)^(i+j) P_k^(2i+2j+2,0)(c)
+    CeedScalar *interpC = &interp1d[Q1d*(p+1+nij)],
+                *gradC = &grad1d[Q1d*(p+1+nij)];
+    for (CeedInt i=0, ijk=0; i<=p; i++)
+      for (CeedInt j=0; j<=p-i; ijk+=p-i-j+1, j++)
+        for (CeedInt k=0; k<=p-i-j; k++) {
+          const CeedInt m = i + j;
+          const CeedScalar n = sqrt(0.5*(2*k + 2*m + 3)), wm = pow(w, m),
+                           pk = CeedJacobiPolynomial(k, 2*m+2, 0, x);
+          interpC[Q1d*ijk + q*(p-m+1) + k] = n*wm*pk;
+          gradC[Q1d*ijk + q*(p-m+1) + k] =
+            n*((m ? -0.5*m*pow(w, m-1)*pk : 0.0) +
+               wm*0.5*(k + 2*m + 3)*CeedJacobiPolynomial(k-1, 2*m+3, 1, x));
+        }
+  }
+  return 0;
+}
+
+/**
+  @brief Assemble the full interpolation and gradient matrices of a
+           collapsed-coordinate simplex basis from its factors
+
+  @param basis  CeedBasis created with CeedBasisCreateSimplex()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisCollapsedAssemble(CeedBasis basis) {
+  int ierr;
+  const CeedInt dim = basis->dim, p = basis->P1d - 1, Q1d = basis->Q1d,
+                P = basis->P, Q = basis->Q, nij = (p+1)*(p+2)/2;
+  const CeedInt offset[3] = {0, Q1d*(p+1), Q1d*(p+1+nij)};
+
+  ierr = CeedCalloc(Q*P, &basis->interp); CeedChk(ierr);
+  ierr = CeedCalloc(dim*Q*P, &basis->grad); CeedChk(ierr);
+  for (CeedInt q=0; q<Q; q++) {
+    // Quadrature point in each collapsed coordinate, the last one fastest
+    CeedInt qd[3] = {0, 0, 0};
+    for (CeedInt d=dim-1, r=q; d>=0; r/=Q1d, d--)
+      qd[d] = r % Q1d;
+    for (CeedInt i=0, ij=0, node=0; i<=p; i++)
+      for (CeedInt j=0; j<=p-i; ij++, j++)
+        for (CeedInt k=0; k<=(dim == 3 ? p-i-j : 0); node++, k++) {
+          // Position of the mode factors in each block
+          const CeedInt ind[3] = {offset[0] + qd[0]*(p+1) + i,
+                                  offset[1] + Q1d*(ij-j) + qd[1]*(p-i+1) + j,
+                                  offset[2] + Q1d*(node-k) + qd[2]*(p-i-j+1) + k
+                                 };
+          CeedScalar val = 1.0;
+          for (CeedInt d=0; d<dim; d++)
+            val *= basis->interp1d[ind[d]];
+          basis->interp[q*P+node] = val;
+          // Chain rule through the collapsed coordinates
+          for (CeedInt dc=0; dc<dim; dc++) {
+            CeedScalar dval = 1.0;
+            for (CeedInt d=0; d<dim; d++)
+              dval *= d == dc ? basis->grad1d[ind[d]] : basis->interp1d[ind[d]];
+            for (CeedInt d=0; d<dim; d++)
+              basis->grad[(d*Q+q)*P+node] +=
+                basis->dcollapsed[(q*dim+dc)*dim+d]*dval;
+          }
+        }
+  }
+  return 0;
+}
+
+/**
+  @brief Evaluate interpolated values followed by gradients with two separate
+           basis applications, for backends without a fused evaluation
+
+  @param basis  CeedBasis to evaluate
+  @param nelem  The number of elements to apply the basis evaluation to
+  @param u      Input CeedVector
+  @param v      Output CeedVector, holding the interpolated values followed
+                  by the gradients
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisApplyInterpGradSplit(CeedBasis basis, CeedInt nelem,
+    CeedVector u, CeedVector v) {
+  int ierr;
+  CeedInt nqpt;
+  CeedMemType mtype;
+  CeedScalar *varray, *temp;
+  CeedVector vinterp, vgrad;
+
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &nqpt); CeedChk(ierr);
+  const CeedSize interpsize = (CeedSize)nelem*basis->ncomp*nqpt;
+
+  // Views of the two parts of the output in the backend's preferred memory
+  ierr = CeedGetPreferredMemType(basis->ceed, &mtype); CeedChk(ierr);
+  ierr = CeedVectorGetArray(v, mtype, &varray); CeedChk(ierr);
+  ierr = CeedVectorCreate(basis->ceed, interpsize, &vinterp); CeedChk(ierr);
+  ierr = CeedVectorSetArray(vinterp, mtype, CEED_USE_POINTER, varray);
+  CeedChk(ierr);
+  ierr = CeedVectorCreate(basis->ceed, basis->dim*interpsize, &vgrad);
+  CeedChk(ierr);
+  ierr = CeedVectorSetArray(vgrad, mtype, CEED_USE_POINTER,
+                            varray + interpsize); CeedChk(ierr);
+
+  ierr = basis->Apply(basis, nelem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u,
+                      vinterp); CeedChk(ierr);
+  ierr = basis->Apply(basis, nelem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, u,
+                      vgrad); CeedChk(ierr);
+
+  // Taking the arrays back syncs the results into the output
+  ierr = CeedVectorTakeArray(vinterp, mtype, &temp); CeedChk(ierr);
+  ierr = CeedVectorTakeArray(vgrad, mtype, &temp); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&vinterp); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&vgrad); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(v, &varray); CeedChk(ierr);
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -263,6 +461,22 @@ int CeedBasisIsTensor(CeedBasis basis, bool *istensor) {
   return 0;
 }
 
+/**
+  @brief Return whether a CeedBasis is a collapsed-coordinate simplex basis
+           created with CeedBasisCreateSimplex()
+
+  @param basis             CeedBasis
+  @param[out] iscollapsed  Variable to store collapsed status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisIsCollapsed(CeedBasis basis, bool *iscollapsed) {
+  *iscollapsed = basis->collapsedbasis;
+  return 0;
+}
+
 /**
   @brief Get backend data of a CeedBasis
 
@@ -338,6 +552,50 @@ int CeedBasisSetTensorContract(CeedBasis basis, CeedTensorContract *contract) {
   return 0;
 }
 
+/**
+  @brief Get the memory held by a CeedBasis
+
+  This counts the matrices and quadrature data held by the interface, and
+    the data the backend reports for the basis, such as precomputed matrices
+    on the host or copies on devices.
+
+  @param basis       CeedBasis
+  @param[out] bytes  Number of bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisGetMemoryUsage(CeedBasis basis, CeedSize *bytes) {
+  int ierr;
+  const CeedInt dim = basis->dim, P = basis->P, Q = basis->Q,
+                P1d = basis->P1d, Q1d = basis->Q1d;
+  CeedSize entries;
+
+  if (basis->tensorbasis) {
+    entries = 2*P1d*Q1d + 2*Q1d;
+  } else if (basis->collapsedbasis) {
+    const CeedInt p = P1d - 1, nij = (p+1)*(p+2)/2;
+    entries = 2*Q1d*(p + 1 + nij + (dim == 3 ? P : 0)) + Q*(dim + 1) +
+              Q*dim*dim;
+  } else {
+    entries = Q*(dim + 1);
+  }
+  // Full matrices, formed on request for tensor bases
+  if (basis->interp)
+    entries += (CeedSize)Q*P;
+  if (basis->grad)
+    entries += (CeedSize)dim*Q*P;
+  *bytes = entries*(CeedSize)sizeof(CeedScalar);
+
+  if (basis->GetMemoryUsage) {
+    CeedSize backendbytes;
+    ierr = basis->GetMemoryUsage(basis, &backendbytes); CeedChk(ierr);
+    *bytes += backendbytes;
+  }
+  return 0;
+}
+
 /**
   @brief Return a reference implementation of matrix multiplication C = A B.
            Note, this is a reference implementation for CPU CeedScalar pointers
@@ -602,6 +860,152 @@ int CeedBasisCreateH1(Ceed ceed, CeedElemTopology topo, CeedInt ncomp,
   return 0;
 }
 
+/**
+  @brief Create an orthonormal basis on a simplex that is applied by sum
+           factorization in collapsed coordinates
+
+  The triangle (0,0), (1,0), (0,1) or tetrahedron (0,0,0), (1,0,0), (0,1,0),
+    (0,0,1) is the image of [-1, 1]^dim under the collapsed (Duffy) map, in 3D
+    x = (1+a)(1-b)(1-c)/8, y = (1+b)(1-c)/4, z = (1+c)/2. The basis functions
+    are the (degree+1)(degree+2)/2 or (degree+1)(degree+2)(degree+3)/6
+    Dubiner polynomials, products of Jacobi polynomials in a, b, and c that are
+    orthonormal on the reference simplex. The nodes are therefore modal
+    coefficients, suited to L^2 fields and to projections, rather than values
+    shared at element interfaces. Quadrature uses Q1d Gauss points in each
+    collapsed coordinate, with the quadrature point index running fastest in the
+    last coordinate, and is exact for polynomials of degree 2*Q1d-dim on the
+    simplex.
+
+  Backends that support it apply the basis with O(degree^(dim+1)) work per
+    element and component instead of the O(degree^(2*dim)) of a dense
+    CeedBasisCreateH1() basis; other backends receive the equivalent dense
+    matrices.
+
+  @param ceed        A Ceed object where the CeedBasis will be created
+  @param topo        Topology of element, \ref CEED_TRIANGLE or \ref CEED_TET
+  @param ncomp       Number of field components (1 for scalar fields)
+  @param degree      Polynomial degree of the basis
+  @param Q1d         Number of quadrature points in each collapsed coordinate
+  @param[out] basis  Address of the variable where the newly created
+                       CeedBasis will be stored.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateSimplex(Ceed ceed, CeedElemTopology topo, CeedInt ncomp,
+                           CeedInt degree, CeedInt Q1d, CeedBasis *basis) {
+  int ierr;
+
+  if (!ceed->BasisCreateH1) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "Basis"); CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Backend does not support BasisCreateH1");
+    // LCOV_EXCL_STOP
+
+    ierr = CeedBasisCreateSimplex(delegate, topo, ncomp, degree, Q1d, basis);
+    CeedChk(ierr);
+    return 0;
+  }
+
+  if (topo != CEED_TRIANGLE && topo != CEED_TET)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Collapsed coordinate bases require a triangle "
+                     "or tetrahedron");
+  // LCOV_EXCL_STOP
+  if (degree < 0 || Q1d < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Simplex basis needs degree >= 0 and Q1d >= 1");
+  // LCOV_EXCL_STOP
+
+  CeedInt dim = 0;
+  ierr = CeedBasisGetTopologyDimension(topo, &dim); CeedChk(ierr);
+  const CeedInt p = degree, nij = (p+1)*(p+2)/2,
+                P = dim == 2 ? nij : (p+1)*(p+2)*(p+3)/6,
+                Q = CeedIntPow(Q1d, dim);
+
+  ierr = CeedCalloc(1, basis); CeedChk(ierr);
+  (*basis)->ceed = ceed;
+  ceed->refcount++;
+  (*basis)->refcount = 1;
+  (*basis)->tensorbasis = 0;
+  (*basis)->collapsedbasis = 1;
+  (*basis)->dim = dim;
+  (*basis)->topo = topo;
+  (*basis)->ncomp = ncomp;
+  (*basis)->P1d = p + 1;
+  (*basis)->Q1d = Q1d;
+  (*basis)->P = P;
+  (*basis)->Q = Q;
+
+  // Collapsed coordinate factors
+  CeedScalar *x1d, *w1d;
+  const CeedInt nfactors = Q1d*(p + 1 + nij + (dim == 3 ? P : 0));
+  ierr = CeedMalloc(Q1d, &x1d); CeedChk(ierr);
+  ierr = CeedMalloc(Q1d, &w1d); CeedChk(ierr);
+  ierr = CeedGaussQuadrature(Q1d, x1d, w1d); CeedChk(ierr);
+  ierr = CeedCalloc(nfactors, &(*basis)->interp1d); CeedChk(ierr);
+  ierr = CeedCalloc(nfactors, &(*basis)->grad1d); CeedChk(ierr);
+  ierr = CeedBasisCollapsedFactors(dim, p, Q1d, x1d, (*basis)->interp1d,
+                                   (*basis)->grad1d); CeedChk(ierr);
+
+  // Quadrature points, weights, and derivatives of the collapsed coordinates
+  ierr = CeedMalloc(Q*dim, &(*basis)->qref1d); CeedChk(ierr);
+  ierr = CeedMalloc(Q, &(*basis)->qweight1d); CeedChk(ierr);
+  ierr = CeedCalloc(Q*dim*dim, &(*basis)->dcollapsed); CeedChk(ierr);
+  for (CeedInt q=0; q<Q; q++) {
+    const CeedInt qa = dim == 2 ? q / Q1d : q / (Q1d*Q1d),
+                  qb = dim == 2 ? q % Q1d : (q / Q1d) % Q1d,
+                  qc = q % Q1d;
+    const CeedScalar a = x1d[qa], b = x1d[qb], c = dim == 2 ? -1.0 : x1d[qc];
+    CeedScalar *qref = (*basis)->qref1d,
+                *dcol = &(*basis)->dcollapsed[q*dim*dim];
+    if (dim == 2) {
+      qref[0*Q+q] = (1 + a)*(1 - b)/4;
+      qref[1*Q+q] = (1 + b)/2;
+      (*basis)->qweight1d[q] = w1d[qa]*w1d[qb]*(1 - b)/8;
+      dcol[0*2+0] = 4/(1 - b);
+      dcol[0*2+1] = 2*(1 + a)/(1 - b);
+      dcol[1*2+1] = 2;
+    } else {
+      // 1 - y - z and 1 - z
+      const CeedScalar r = (1 - b)*(1 - c)/4, s = (1 - c)/2;
+      qref[0*Q+q] = (1 + a)*(1 - b)*(1 - c)/8;
+      qref[1*Q+q] = (1 + b)*(1 - c)/4;
+      qref[2*Q+q] = (1 + c)/2;
+      (*basis)->qweight1d[q] = w1d[qa]*w1d[qb]*w1d[qc]*
+                               (1 - b)*(1 - c)*(1 - c)/64;
+      dcol[0*3+0] = 2/r;
+      dcol[0*3+1] = (1 + a)/r;
+      dcol[0*3+2] = (1 + a)/r;
+      dcol[1*3+1] = 2/s;
+      dcol[1*3+2] = (1 + b)/s;
+      dcol[2*3+2] = 2;
+    }
+  }
+  ierr = CeedFree(&x1d); CeedChk(ierr);
+  ierr = CeedFree(&w1d); CeedChk(ierr);
+
+  if (ceed->BasisCreateCollapsed) {
+    ierr = ceed->BasisCreateCollapsed(topo, dim, p + 1, Q1d,
+                                      (*basis)->interp1d, (*basis)->grad1d,
+                                      (*basis)->dcollapsed, *basis);
+    CeedChk(ierr);
+  } else {
+    // Fall back to the dense matrices
+    const CeedScalar *interp, *grad;
+    ierr = CeedBasisGetInterp(*basis, &interp); CeedChk(ierr);
+    ierr = CeedBasisGetGrad(*basis, &grad); CeedChk(ierr);
+    ierr = ceed->BasisCreateH1(topo, dim, P, Q, interp, grad,
+                               (*basis)->qref1d, (*basis)->qweight1d, *basis);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
 /**
   @brief View a CeedBasis
 
@@ -627,6 +1031,9 @@ int CeedBasisView(CeedBasis basis, FILE *stream) {
     ierr = CeedScalarView("grad1d", "\t% 12.8f", basis->Q1d, basis->P1d,
                           basis->grad1d, stream); CeedChk(ierr);
   } else {
+    const CeedScalar *interp, *grad;
+    ierr = CeedBasisGetInterp(basis, &interp); CeedChk(ierr);
+    ierr = CeedBasisGetGrad(basis, &grad); CeedChk(ierr);
     fprintf(stream, "CeedBasis: dim=%d P=%d Q=%d\n", basis->dim, basis->P,
             basis->Q);
     ierr = CeedScalarView("qref", "\t% 12.8f", 1, basis->Q*basis->dim,
@@ -635,9 +1042,9 @@ int CeedBasisView(CeedBasis basis, FILE *stream) {
     ierr = CeedScalarView("qweight", "\t% 12.8f", 1, basis->Q, basis->qweight1d,
                           stream); CeedChk(ierr);
     ierr = CeedScalarView("interp", "\t% 12.8f", basis->Q, basis->P,
-                          basis->interp, stream); CeedChk(ierr);
+                          interp, stream); CeedChk(ierr);
     ierr = CeedScalarView("grad", "\t% 12.8f", basis->dim*basis->Q, basis->P,
-                          basis->grad, stream); CeedChk(ierr);
+                          grad, stream); CeedChk(ierr);
   }
   return 0;
 }
@@ -655,7 +1062,12 @@ int CeedBasisView(CeedBasis basis, FILE *stream) {
   @param emode   \ref CEED_EVAL_NONE to use values directly,
                    \ref CEED_EVAL_INTERP to use interpolated values,
                    \ref CEED_EVAL_GRAD to use gradients,
-                   \ref CEED_EVAL_WEIGHT to use quadrature weights.
+                   \ref CEED_EVAL_WEIGHT to use quadrature weights,
+                   or `CEED_EVAL_INTERP | CEED_EVAL_GRAD` with
+                   \ref CEED_NOTRANSPOSE to evaluate the interpolated values
+                   followed by the gradients in one pass, sharing the work
+                   between them where the basis allows; backends without a
+                   fused evaluation apply the two modes in turn
   @param[in] u   Input CeedVector
   @param[out] v  Output CeedVector
 
@@ -666,7 +1078,8 @@ int CeedBasisView(CeedBasis basis, FILE *stream) {
 int CeedBasisApply(CeedBasis basis, CeedInt nelem, CeedTransposeMode tmode,
                    CeedEvalMode emode, CeedVector u, CeedVector v) {
   int ierr;
-  CeedInt ulength = 0, vlength, nnodes, nqpt;
+  CeedSize ulength = 0, vlength;
+  CeedInt nnodes, nqpt;
   if (!basis->Apply)
     // LCOV_EXCL_START
     return CeedError(basis->ceed, 1, "Backend does not support BasisApply");
@@ -686,6 +1099,22 @@ int CeedBasisApply(CeedBasis basis, CeedInt nelem, CeedTransposeMode tmode,
     return CeedError(basis->ceed, 1, "Length of input/output vectors "
                      "incompatible with basis dimensions");
 
+  if (emode == (CEED_EVAL_INTERP | CEED_EVAL_GRAD) &&
+      tmode != CEED_NOTRANSPOSE)
+    // LCOV_EXCL_START
+    return CeedError(basis->ceed, 1, "Fused interpolation and gradient "
+                     "requires CEED_NOTRANSPOSE");
+  // LCOV_EXCL_STOP
+
+  if (emode == (CEED_EVAL_INTERP | CEED_EVAL_GRAD)) {
+    if (basis->ApplyInterpGrad) {
+      ierr = basis->ApplyInterpGrad(basis, nelem, u, v); CeedChk(ierr);
+    } else {
+      ierr = CeedBasisApplyInterpGradSplit(basis, nelem, u, v); CeedChk(ierr);
+    }
+    return 0;
+  }
+
   ierr = basis->Apply(basis, nelem, tmode, emode, u, v); CeedChk(ierr);
   return 0;
 }
@@ -753,6 +1182,9 @@ int CeedBasisGetNumNodes(CeedBasis basis, CeedInt *P) {
 /**
   @brief Get total number of nodes (in 1 dimension) of a CeedBasis
 
+  For a collapsed-coordinate simplex basis this is the polynomial degree
+    plus one.
+
   @param basis     CeedBasis
   @param[out] P1d  Variable to store number of nodes
 
@@ -761,7 +1193,7 @@ int CeedBasisGetNumNodes(CeedBasis basis, CeedInt *P) {
   @ref Backend
 **/
 int CeedBasisGetNumNodes1D(CeedBasis basis, CeedInt *P1d) {
-  if (!basis->tensorbasis)
+  if (!basis->tensorbasis && !basis->collapsedbasis)
     // LCOV_EXCL_START
     return CeedError(basis->ceed, 1, "Cannot supply P1d for non-tensor basis");
   // LCOV_EXCL_STOP
@@ -788,6 +1220,9 @@ int CeedBasisGetNumQuadraturePoints(CeedBasis basis, CeedInt *Q) {
 /**
   @brief Get total number of quadrature points (in 1 dimension) of a CeedBasis
 
+  For a collapsed-coordinate simplex basis this is the number of points in
+    each collapsed coordinate.
+
   @param basis     CeedBasis
   @param[out] Q1d  Variable to store number of quadrature points
 
@@ -796,7 +1231,7 @@ int CeedBasisGetNumQuadraturePoints(CeedBasis basis, CeedInt *Q) {
   @ref Backend
 **/
 int CeedBasisGetNumQuadraturePoints1D(CeedBasis basis, CeedInt *Q1d) {
-  if (!basis->tensorbasis)
+  if (!basis->tensorbasis && !basis->collapsedbasis)
     // LCOV_EXCL_START
     return CeedError(basis->ceed, 1, "Cannot supply Q1d for non-tensor basis");
   // LCOV_EXCL_STOP
@@ -848,7 +1283,10 @@ int CeedBasisGetQWeights(CeedBasis basis, const CeedScalar **qweight) {
   @ref Backend
 **/
 int CeedBasisGetInterp(CeedBasis basis, const CeedScalar **interp) {
-  if (!basis->interp && basis->tensorbasis) {
+  if (!basis->interp && basis->collapsedbasis) {
+    int ierr;
+    ierr = CeedBasisCollapsedAssemble(basis); CeedChk(ierr);
+  } else if (!basis->interp && basis->tensorbasis) {
     // Allocate
     int ierr;
     ierr = CeedMalloc(basis->Q*basis->P, &basis->interp); CeedChk(ierr);
@@ -904,7 +1342,10 @@ int CeedBasisGetInterp1D(CeedBasis basis, const CeedScalar **interp1d) {
   @ref Backend
 **/
 int CeedBasisGetGrad(CeedBasis basis, const CeedScalar **grad) {
-  if (!basis->grad && basis->tensorbasis) {
+  if (!basis->grad && basis->collapsedbasis) {
+    int ierr;
+    ierr = CeedBasisCollapsedAssemble(basis); CeedChk(ierr);
+  } else if (!basis->grad && basis->tensorbasis) {
     // Allocate
     int ierr;
     ierr = CeedMalloc(basis->dim*basis->Q*basis->P, &basis->grad);
@@ -978,6 +1419,7 @@ int CeedBasisDestroy(CeedBasis *basis) {
   ierr = CeedFree(&(*basis)->grad1d); CeedChk(ierr);
   ierr = CeedFree(&(*basis)->qref1d); CeedChk(ierr);
   ierr = CeedFree(&(*basis)->qweight1d); CeedChk(ierr);
+  ierr = CeedFree(&(*basis)->dcollapsed); CeedChk(ierr);
   ierr = CeedDestroy(&(*basis)->ceed); CeedChk(ierr);
   ierr = CeedFree(basis); CeedChk(ierr);
   return 0;
@@ -18,6 +18,7 @@
 #include <ceed-backend.h>
 #include <ceed-impl.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 
 /// @file
@@ -59,6 +60,57 @@ int CeedPermutePadOffsets(const CeedInt *offsets, CeedInt *blkoffsets,
   return 0;
 }
 
+/**
+  @brief Permute and pad 64-bit offsets for a blocked restriction
+
+  @param offsets    Array of shape [@a nelem, @a elemsize] of 64-bit offsets
+  @param blkoffsets Array of permuted and padded offsets of
+                      shape [@a nblk, @a elemsize, @a blksize].
+  @param nblk       Number of blocks
+  @param nelem      Number of elements
+  @param blksize    Number of elements in a block
+  @param elemsize   Size of each element
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Utility
+**/
+int CeedPermutePadOffsets64(const CeedSize *offsets, CeedSize *blkoffsets,
+                            CeedInt nblk, CeedInt nelem, CeedInt blksize,
+                            CeedInt elemsize) {
+  for (CeedInt e = 0; e < nblk*blksize; e+=blksize)
+    for (int j = 0; j < blksize; j++)
+      for (int k = 0; k < elemsize; k++)
+        blkoffsets[e*elemsize + k*blksize + j]
+          = offsets[CeedIntMin(e+j,nelem-1)*elemsize + k];
+  return 0;
+}
+
+/**
+  @brief Check that the offsets of a restriction stay within its L-vector
+
+  Offsets are added to component strides in CeedSize, so only the farthest
+    L-vector entry reached limits the restriction, not the L-vector size.
+
+  @param ceed       Ceed object for error handling
+  @param maxoffset  Largest offset of the restriction
+  @param ncomp      Number of field components per interpolation node
+  @param compstride Stride between components for the same L-vector node
+  @param lsize      The size of the L-vector
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionCheckReach(Ceed ceed, CeedSize maxoffset,
+    CeedInt ncomp, CeedInt compstride, CeedSize lsize) {
+  const CeedSize reach = maxoffset + (CeedSize)(ncomp - 1)*compstride;
+  if (reach >= lsize)
+    return CeedError(ceed, 1, "Restriction offsets reach L-vector entry %ld "
+                     "beyond L-vector size %ld", (long)reach, (long)lsize);
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -122,13 +174,19 @@ int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mtype,
                                   const CeedInt **offsets) {
   int ierr;
 
+  if (rstr->offsets64)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "ElemRestriction has 64-bit offsets, use "
+                     "CeedElemRestrictionGetOffsets64");
+  // LCOV_EXCL_STOP
+
   if (!rstr->GetOffsets)
     // LCOV_EXCL_START
     return CeedError(rstr->ceed, 1, "Backend does not support GetOffsets");
   // LCOV_EXCL_STOP
 
   ierr = rstr->GetOffsets(rstr, mtype, offsets); CeedChk(ierr);
-  rstr->numreaders++;
+  CeedAtomicAdd(rstr->numreaders, 1);
   return 0;
 }
 
@@ -145,7 +203,92 @@ int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mtype,
 int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr,
                                       const CeedInt **offsets) {
   *offsets = NULL;
-  rstr->numreaders--;
+  CeedAtomicAdd(rstr->numreaders, -1);
+  return 0;
+}
+
+/**
+  @brief Get read-only access to the 64-bit offsets array of a
+           CeedElemRestriction created with CeedElemRestrictionCreate64()
+
+  @param rstr         CeedElemRestriction to retrieve offsets
+  @param mtype        Memory type on which to access the array
+  @param[out] offsets Array on memory type mtype
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetOffsets64(CeedElemRestriction rstr,
+                                    CeedMemType mtype,
+                                    const CeedSize **offsets) {
+  int ierr;
+
+  if (!rstr->offsets64)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "ElemRestriction has 32-bit offsets, use "
+                     "CeedElemRestrictionGetOffsets");
+  // LCOV_EXCL_STOP
+
+  if (!rstr->GetOffsets64)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "Backend does not support GetOffsets64");
+  // LCOV_EXCL_STOP
+
+  ierr = rstr->GetOffsets64(rstr, mtype, offsets); CeedChk(ierr);
+  CeedAtomicAdd(rstr->numreaders, 1);
+  return 0;
+}
+
+/**
+  @brief Restore an offsets array obtained using
+           CeedElemRestrictionGetOffsets64()
+
+  @param rstr    CeedElemRestriction to restore
+  @param offsets Array of offset data
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionRestoreOffsets64(CeedElemRestriction rstr,
+                                        const CeedSize **offsets) {
+  *offsets = NULL;
+  CeedAtomicAdd(rstr->numreaders, -1);
+  return 0;
+}
+
+/**
+  @brief Get a coloring of the element blocks of a CeedElemRestriction
+
+  Blocks of the same color share no L-vector entries, so the transpose
+    restriction of all blocks in one color may be applied concurrently.
+    The blocks of color c are colorblks[coloroffsets[c]:coloroffsets[c+1]].
+    For a non-blocked restriction, each block is a single element.
+
+  @param rstr               CeedElemRestriction
+  @param[out] numcolors     Variable to store number of colors
+  @param[out] coloroffsets  Array of length numcolors+1 of offsets into
+                              colorblks
+  @param[out] colorblks     Array of block indices, grouped by color
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetColoring(CeedElemRestriction rstr,
+                                   CeedInt *numcolors,
+                                   const CeedInt **coloroffsets,
+                                   const CeedInt **colorblks) {
+  int ierr;
+
+  if (!rstr->GetColoring)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "Backend does not implement GetColoring");
+  // LCOV_EXCL_STOP
+
+  ierr = rstr->GetColoring(rstr, numcolors, coloroffsets, colorblks);
+  CeedChk(ierr);
   return 0;
 }
 
@@ -164,6 +307,24 @@ int CeedElemRestrictionIsStrided(CeedElemRestriction rstr, bool *isstrided) {
   return 0;
 }
 
+/**
+  @brief Get the 64-bit offset status of a CeedElemRestriction
+
+  @param rstr             CeedElemRestriction
+  @param[out] hasoffsets64 Variable to store status, true if the restriction
+                             was created with 64-bit offsets beyond the range
+                             of CeedInt
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionHasOffsets64(CeedElemRestriction rstr,
+                                    bool *hasoffsets64) {
+  *hasoffsets64 = rstr->offsets64;
+  return 0;
+}
+
 /**
   @brief Get the backend stride status of a CeedElemRestriction
 
@@ -266,6 +427,32 @@ int CeedElemRestrictionSetData(CeedElemRestriction rstr, void *data) {
   return 0;
 }
 
+/**
+  @brief Get the memory held by a CeedElemRestriction
+
+  Backends report the offsets they copied and any maps they built for the
+    restriction, on the host and on devices; offsets given with
+    @ref CEED_USE_POINTER are not counted. Backends without this query report
+    no memory.
+
+  @param rstr        CeedElemRestriction, or NULL for one not yet created
+  @param[out] bytes  Number of bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetMemoryUsage(CeedElemRestriction rstr,
+                                      CeedSize *bytes) {
+  int ierr;
+
+  *bytes = 0;
+  if (rstr && rstr->GetMemoryUsage) {
+    ierr = rstr->GetMemoryUsage(rstr, bytes); CeedChk(ierr);
+  }
+  return 0;
+}
+
 /// @}
 
 /// @cond DOXYGEN_SKIP
@@ -299,6 +486,8 @@ const CeedElemRestriction CEED_ELEMRESTRICTION_NONE =
                         offsets[i + k*elemsize] + j*compstride.
   @param lsize      The size of the L-vector. This vector may be larger than
                       the elements and fields given by this restriction.
+                      Offsets are CeedInt, but components are reached in
+                      CeedSize, so @a lsize may exceed INT32_MAX.
   @param mtype      Memory type of the @a offsets array, see CeedMemType
   @param cmode      Copy mode for the @a offsets array, see CeedCopyMode
   @param offsets    Array of shape [@a nelem, @a elemsize]. Row i holds the
@@ -315,7 +504,7 @@ const CeedElemRestriction CEED_ELEMRESTRICTION_NONE =
 **/
 int CeedElemRestrictionCreate(Ceed ceed, CeedInt nelem, CeedInt elemsize,
                               CeedInt ncomp, CeedInt compstride,
-                              CeedInt lsize, CeedMemType mtype,
+                              CeedSize lsize, CeedMemType mtype,
                               CeedCopyMode cmode, const CeedInt *offsets,
                               CeedElemRestriction *rstr) {
   int ierr;
@@ -336,6 +525,14 @@ int CeedElemRestrictionCreate(Ceed ceed, CeedInt nelem, CeedInt elemsize,
     return 0;
   }
 
+  if (mtype == CEED_MEM_HOST) {
+    CeedInt maxoffset = 0;
+    for (CeedSize i = 0; i < (CeedSize)nelem*elemsize; i++)
+      maxoffset = CeedIntMax(maxoffset, offsets[i]);
+    ierr = CeedElemRestrictionCheckReach(ceed, maxoffset, ncomp, compstride,
+                                         lsize); CeedChk(ierr);
+  }
+
   ierr = CeedCalloc(1, rstr); CeedChk(ierr);
   (*rstr)->ceed = ceed;
   ceed->refcount++;
@@ -352,6 +549,95 @@ int CeedElemRestrictionCreate(Ceed ceed, CeedInt nelem, CeedInt elemsize,
   return 0;
 }
 
+/**
+  @brief Create a CeedElemRestriction with 64-bit offsets
+
+  Offsets that all fit in CeedInt are narrowed and the restriction is created
+    as with CeedElemRestrictionCreate(), so only restrictions reaching nodes
+    beyond INT32_MAX pay for 64-bit offsets.
+
+  @param ceed       A Ceed object where the CeedElemRestriction will be created
+  @param nelem      Number of elements described in the @a offsets array
+  @param elemsize   Size (number of "nodes") per element
+  @param ncomp      Number of field components per interpolation node
+                      (1 for scalar fields)
+  @param compstride Stride between components for the same L-vector "node".
+                      Data for node i, component j, element k can be found in
+                      the L-vector at index
+                        offsets[i + k*elemsize] + j*compstride.
+  @param lsize      The size of the L-vector. This vector may be larger than
+                      the elements and fields given by this restriction.
+  @param mtype      Memory type of the @a offsets array, see CeedMemType
+  @param cmode      Copy mode for the @a offsets array, see CeedCopyMode
+  @param offsets    Array of shape [@a nelem, @a elemsize] of CeedSize
+                      offsets, as for CeedElemRestrictionCreate()
+  @param[out] rstr  Address of the variable where the newly created
+                      CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreate64(Ceed ceed, CeedInt nelem, CeedInt elemsize,
+                                CeedInt ncomp, CeedInt compstride,
+                                CeedSize lsize, CeedMemType mtype,
+                                CeedCopyMode cmode, const CeedSize *offsets,
+                                CeedElemRestriction *rstr) {
+  int ierr;
+
+  if (mtype == CEED_MEM_HOST) {
+    CeedSize maxoffset = 0;
+    for (CeedSize i = 0; i < (CeedSize)nelem*elemsize; i++)
+      maxoffset = offsets[i] > maxoffset ? offsets[i] : maxoffset;
+    ierr = CeedElemRestrictionCheckReach(ceed, maxoffset, ncomp, compstride,
+                                         lsize); CeedChk(ierr);
+
+    // Offsets within the range of CeedInt keep the 32-bit restriction
+    if (maxoffset <= INT32_MAX) {
+      CeedInt *offsets32;
+      ierr = CeedMalloc((CeedSize)nelem*elemsize, &offsets32); CeedChk(ierr);
+      for (CeedSize i = 0; i < (CeedSize)nelem*elemsize; i++)
+        offsets32[i] = offsets[i];
+      if (cmode == CEED_OWN_POINTER) {
+        ierr = CeedFree(&offsets); CeedChk(ierr);
+      }
+      return CeedElemRestrictionCreate(ceed, nelem, elemsize, ncomp,
+                                       compstride, lsize, CEED_MEM_HOST,
+                                       CEED_OWN_POINTER, offsets32, rstr);
+    }
+  }
+
+  while (!ceed->ElemRestrictionCreate64) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
+    CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Backend does not support "
+                       "ElemRestrictionCreate64");
+    // LCOV_EXCL_STOP
+
+    ceed = delegate;
+  }
+
+  ierr = CeedCalloc(1, rstr); CeedChk(ierr);
+  (*rstr)->ceed = ceed;
+  ceed->refcount++;
+  (*rstr)->refcount = 1;
+  (*rstr)->nelem = nelem;
+  (*rstr)->elemsize = elemsize;
+  (*rstr)->ncomp = ncomp;
+  (*rstr)->compstride = compstride;
+  (*rstr)->lsize = lsize;
+  (*rstr)->nblk = nelem;
+  (*rstr)->blksize = 1;
+  (*rstr)->offsets64 = true;
+  ierr = ceed->ElemRestrictionCreate64(mtype, cmode, offsets, *rstr);
+  CeedChk(ierr);
+  return 0;
+}
+
 /**
   @brief Create a strided CeedElemRestriction
 
@@ -376,7 +662,7 @@ int CeedElemRestrictionCreate(Ceed ceed, CeedInt nelem, CeedInt elemsize,
   @ref User
 **/
 int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt nelem, CeedInt elemsize,
-                                     CeedInt ncomp, CeedInt lsize,
+                                     CeedInt ncomp, CeedSize lsize,
                                      const CeedInt strides[3],
                                      CeedElemRestriction *rstr) {
   int ierr;
@@ -431,6 +717,8 @@ int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt nelem, CeedInt elemsize,
                         offsets[i + k*elemsize] + j*compstride.
   @param lsize      The size of the L-vector. This vector may be larger than
                       the elements and fields given by this restriction.
+                      Offsets are CeedInt, but components are reached in
+                      CeedSize, so @a lsize may exceed INT32_MAX.
   @param mtype      Memory type of the @a offsets array, see CeedMemType
   @param cmode      Copy mode for the @a offsets array, see CeedCopyMode
   @param offsets    Array of shape [@a nelem, @a elemsize]. Row i holds the
@@ -450,7 +738,7 @@ int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt nelem, CeedInt elemsize,
  **/
 int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt nelem, CeedInt elemsize,
                                      CeedInt blksize, CeedInt ncomp,
-                                     CeedInt compstride, CeedInt lsize,
+                                     CeedInt compstride, CeedSize lsize,
                                      CeedMemType mtype, CeedCopyMode cmode,
                                      const CeedInt *offsets,
                                      CeedElemRestriction *rstr) {
@@ -476,6 +764,14 @@ int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt nelem, CeedInt elemsize,
     return 0;
   }
 
+  if (mtype == CEED_MEM_HOST) {
+    CeedInt maxoffset = 0;
+    for (CeedSize i = 0; i < (CeedSize)nelem*elemsize; i++)
+      maxoffset = CeedIntMax(maxoffset, offsets[i]);
+    ierr = CeedElemRestrictionCheckReach(ceed, maxoffset, ncomp, compstride,
+                                         lsize); CeedChk(ierr);
+  }
+
   ierr = CeedCalloc(1, rstr); CeedChk(ierr);
 
   ierr = CeedCalloc(nblk*blksize*elemsize, &blkoffsets); CeedChk(ierr);
@@ -503,6 +799,117 @@ int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt nelem, CeedInt elemsize,
   return 0;
 }
 
+/**
+  @brief Create a blocked CeedElemRestriction with 64-bit offsets, typically
+           only called by backends
+
+  Offsets that all fit in CeedInt are narrowed and the restriction is created
+    as with CeedElemRestrictionCreateBlocked().
+
+  @param ceed       A Ceed object where the CeedElemRestriction will be created.
+  @param nelem      Number of elements described in the @a offsets array.
+  @param elemsize   Size (number of unknowns) per element
+  @param blksize    Number of elements in a block
+  @param ncomp      Number of field components per interpolation node
+                      (1 for scalar fields)
+  @param compstride Stride between components for the same L-vector "node".
+                      Data for node i, component j, element k can be found in
+                      the L-vector at index
+                        offsets[i + k*elemsize] + j*compstride.
+  @param lsize      The size of the L-vector. This vector may be larger than
+                      the elements and fields given by this restriction.
+  @param mtype      Memory type of the @a offsets array, see CeedMemType
+  @param cmode      Copy mode for the @a offsets array, see CeedCopyMode
+  @param offsets    Array of shape [@a nelem, @a elemsize] of CeedSize
+                      offsets, as for CeedElemRestrictionCreateBlocked()
+  @param rstr       Address of the variable where the newly created
+                      CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+ **/
+int CeedElemRestrictionCreateBlocked64(Ceed ceed, CeedInt nelem,
+                                       CeedInt elemsize, CeedInt blksize,
+                                       CeedInt ncomp, CeedInt compstride,
+                                       CeedSize lsize, CeedMemType mtype,
+                                       CeedCopyMode cmode,
+                                       const CeedSize *offsets,
+                                       CeedElemRestriction *rstr) {
+  int ierr;
+  CeedSize *blkoffsets;
+  CeedInt nblk = (nelem / blksize) + !!(nelem % blksize);
+
+  if (mtype != CEED_MEM_HOST)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Blocked restrictions with 64-bit offsets "
+                     "require host offsets");
+  // LCOV_EXCL_STOP
+
+  CeedSize maxoffset = 0;
+  for (CeedSize i = 0; i < (CeedSize)nelem*elemsize; i++)
+    maxoffset = offsets[i] > maxoffset ? offsets[i] : maxoffset;
+  ierr = CeedElemRestrictionCheckReach(ceed, maxoffset, ncomp, compstride,
+                                       lsize); CeedChk(ierr);
+
+  // Offsets within the range of CeedInt keep the 32-bit restriction
+  if (maxoffset <= INT32_MAX) {
+    CeedInt *offsets32;
+    ierr = CeedMalloc((CeedSize)nelem*elemsize, &offsets32); CeedChk(ierr);
+    for (CeedSize i = 0; i < (CeedSize)nelem*elemsize; i++)
+      offsets32[i] = offsets[i];
+    if (cmode == CEED_OWN_POINTER) {
+      ierr = CeedFree(&offsets); CeedChk(ierr);
+    }
+    return CeedElemRestrictionCreateBlocked(ceed, nelem, elemsize, blksize,
+                                            ncomp, compstride, lsize,
+                                            CEED_MEM_HOST, CEED_OWN_POINTER,
+                                            offsets32, rstr);
+  }
+
+  while (!ceed->ElemRestrictionCreateBlocked64) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
+    CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Backend does not support "
+                       "ElemRestrictionCreateBlocked64");
+    // LCOV_EXCL_STOP
+
+    ceed = delegate;
+  }
+
+  ierr = CeedCalloc(1, rstr); CeedChk(ierr);
+
+  ierr = CeedCalloc((CeedSize)nblk*blksize*elemsize, &blkoffsets);
+  CeedChk(ierr);
+  ierr = CeedPermutePadOffsets64(offsets, blkoffsets, nblk, nelem, blksize,
+                                 elemsize);
+  CeedChk(ierr);
+
+  (*rstr)->ceed = ceed;
+  ceed->refcount++;
+  (*rstr)->refcount = 1;
+  (*rstr)->nelem = nelem;
+  (*rstr)->elemsize = elemsize;
+  (*rstr)->ncomp = ncomp;
+  (*rstr)->compstride = compstride;
+  (*rstr)->lsize = lsize;
+  (*rstr)->nblk = nblk;
+  (*rstr)->blksize = blksize;
+  (*rstr)->offsets64 = true;
+  ierr = ceed->ElemRestrictionCreateBlocked64(CEED_MEM_HOST, CEED_OWN_POINTER,
+         (const CeedSize *) blkoffsets, *rstr); CeedChk(ierr);
+
+  if (cmode == CEED_OWN_POINTER) {
+    ierr = CeedFree(&offsets); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
 /**
   @brief Create a blocked strided CeedElemRestriction
 
@@ -528,7 +935,7 @@ int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt nelem, CeedInt elemsize,
   @ref User
 **/
 int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt nelem,
-    CeedInt elemsize, CeedInt blksize, CeedInt ncomp, CeedInt lsize,
+    CeedInt elemsize, CeedInt blksize, CeedInt ncomp, CeedSize lsize,
     const CeedInt strides[3], CeedElemRestriction *rstr) {
   int ierr;
   CeedInt nblk = (nelem / blksize) + !!(nelem % blksize);
@@ -584,9 +991,9 @@ int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt nelem,
 int CeedElemRestrictionCreateVector(CeedElemRestriction rstr, CeedVector *lvec,
                                     CeedVector *evec) {
   int ierr;
-  CeedInt n, m;
+  CeedSize n, m;
   m = rstr->lsize;
-  n = rstr->nblk * rstr->blksize * rstr->elemsize * rstr->ncomp;
+  n = (CeedSize)rstr->nblk * rstr->blksize * rstr->elemsize * rstr->ncomp;
   if (lvec) {
     ierr = CeedVectorCreate(rstr->ceed, m, lvec); CeedChk(ierr);
   }
@@ -614,25 +1021,27 @@ int CeedElemRestrictionCreateVector(CeedElemRestriction rstr, CeedVector *lvec,
 int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode tmode,
                              CeedVector u, CeedVector ru,
                              CeedRequest *request) {
-  CeedInt m,n;
+  CeedSize m,n;
   int ierr;
 
   if (tmode == CEED_NOTRANSPOSE) {
-    m = rstr->nblk * rstr->blksize * rstr->elemsize * rstr->ncomp;
+    m = (CeedSize)rstr->nblk * rstr->blksize * rstr->elemsize * rstr->ncomp;
     n = rstr->lsize;
   } else {
     m = rstr->lsize;
-    n = rstr->nblk * rstr->blksize * rstr->elemsize * rstr->ncomp;
+    n = (CeedSize)rstr->nblk * rstr->blksize * rstr->elemsize * rstr->ncomp;
   }
   if (n != u->length)
     // LCOV_EXCL_START
-    return CeedError(rstr->ceed, 2, "Input vector size %d not compatible with "
-                     "element restriction (%d, %d)", u->length, m, n);
+    return CeedError(rstr->ceed, 2, "Input vector size %ld not compatible with "
+                     "element restriction (%ld, %ld)", (long)u->length,
+                     (long)m, (long)n);
   // LCOV_EXCL_STOP
   if (m != ru->length)
     // LCOV_EXCL_START
-    return CeedError(rstr->ceed, 2, "Output vector size %d not compatible with "
-                     "element restriction (%d, %d)", ru->length, m, n);
+    return CeedError(rstr->ceed, 2, "Output vector size %ld not compatible "
+                     "with element restriction (%ld, %ld)", (long)ru->length,
+                     (long)m, (long)n);
   // LCOV_EXCL_STOP
   ierr = rstr->Apply(rstr, tmode, u, ru, request); CeedChk(ierr);
 
@@ -660,7 +1069,7 @@ int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode tmode,
 int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block,
                                   CeedTransposeMode tmode, CeedVector u,
                                   CeedVector ru, CeedRequest *request) {
-  CeedInt m,n;
+  CeedSize m,n;
   int ierr;
 
   if (tmode == CEED_NOTRANSPOSE) {
@@ -672,13 +1081,15 @@ int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block,
   }
   if (n != u->length)
     // LCOV_EXCL_START
-    return CeedError(rstr->ceed, 2, "Input vector size %d not compatible with "
-                     "element restriction (%d, %d)", u->length, m, n);
+    return CeedError(rstr->ceed, 2, "Input vector size %ld not compatible with "
+                     "element restriction (%ld, %ld)", (long)u->length,
+                     (long)m, (long)n);
   // LCOV_EXCL_STOP
   if (m != ru->length)
     // LCOV_EXCL_START
-    return CeedError(rstr->ceed, 2, "Output vector size %d not compatible with "
-                     "element restriction (%d, %d)", ru->length, m, n);
+    return CeedError(rstr->ceed, 2, "Output vector size %ld not compatible "
+                     "with element restriction (%ld, %ld)", (long)ru->length,
+                     (long)m, (long)n);
   // LCOV_EXCL_STOP
   if (rstr->blksize*block > rstr->nelem)
     // LCOV_EXCL_START
@@ -751,7 +1162,7 @@ int CeedElemRestrictionGetElementSize(CeedElemRestriction rstr,
   @ref Backend
 **/
 int CeedElemRestrictionGetLVectorSize(CeedElemRestriction rstr,
-                                      CeedInt *lsize) {
+                                      CeedSize *lsize) {
   *lsize = rstr->lsize;
   return 0;
 }
@@ -820,6 +1231,12 @@ int CeedElemRestrictionGetMultiplicity(CeedElemRestriction rstr,
   int ierr;
   CeedVector evec;
 
+  // Backend version
+  if (rstr->GetMultiplicity) {
+    ierr = rstr->GetMultiplicity(rstr, mult); CeedChk(ierr);
+    return 0;
+  }
+
   // Create and set evec
   ierr = CeedElemRestrictionCreateVector(rstr, NULL, &evec); CeedChk(ierr);
   ierr = CeedVectorSetValue(evec, 1.0); CeedChk(ierr);
@@ -853,9 +1270,9 @@ int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream) {
   else
     sprintf(stridesstr, "%d", rstr->compstride);
 
-  fprintf(stream, "%sCeedElemRestriction from (%d, %d) to %d elements with %d "
+  fprintf(stream, "%sCeedElemRestriction from (%ld, %d) to %d elements with %d "
           "nodes each and %s %s\n", rstr->blksize > 1 ? "Blocked " : "",
-          rstr->lsize, rstr->ncomp, rstr->nelem, rstr->elemsize,
+          (long)rstr->lsize, rstr->ncomp, rstr->nelem, rstr->elemsize,
           rstr->strides ? "strides" : "component stride", stridesstr);
   return 0;
 }
@@ -145,6 +145,23 @@ void fCeedVectorCreate(int *ceed, int *length, int *vec, int *err) {
   }
 }
 
+// Lengths beyond the range of a default Fortran integer, passed as integer*8
+#define fCeedVectorCreate64 FORTRAN_NAME(ceedvectorcreate64,CEEDVECTORCREATE64)
+void fCeedVectorCreate64(int *ceed, int64_t *length, int *vec, int *err) {
+  if (CeedVector_count == CeedVector_count_max) {
+    CeedVector_count_max += CeedVector_count_max/2 + 1;
+    CeedRealloc(CeedVector_count_max, &CeedVector_dict);
+  }
+
+  CeedVector *vec_ = &CeedVector_dict[CeedVector_count];
+  *err = CeedVectorCreate(Ceed_dict[*ceed], *length, vec_);
+
+  if (*err == 0) {
+    *vec = CeedVector_count++;
+    CeedVector_n++;
+  }
+}
+
 #define fCeedVectorSetArray FORTRAN_NAME(ceedvectorsetarray,CEEDVECTORSETARRAY)
 void fCeedVectorSetArray(int *vec, int *memtype, int *copymode,
                          CeedScalar *array, int64_t *offset, int *err) {
@@ -20,6 +20,7 @@
 #include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 /// @file
@@ -72,6 +73,14 @@ int CeedOperatorCreateFallback(CeedOperator op) {
   opref->data = NULL;
   opref->setupdone = 0;
   opref->ceed = ceedref;
+  if (op->composite) {
+    // Suboperators are shared with the parent operator; the reference
+    //   composite operator holds no backend data to destroy
+    opref->Destroy = NULL;
+    ierr = ceedref->CompositeOperatorCreate(opref); CeedChk(ierr);
+    op->opfallback = opref;
+    return 0;
+  }
   ierr = ceedref->OperatorCreate(opref); CeedChk(ierr);
   op->opfallback = opref;
 
@@ -380,6 +389,14 @@ static int CeedOperatorMultigridLevel_Core(CeedOperator opFine,
                               CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
   CeedChk(ierr);
 
+  // Coarse level and transfer operators compute in the fine precision
+  (*opCoarse)->precision = opFine->precision;
+  (*opProlong)->precision = opFine->precision;
+  (*opRestrict)->precision = opFine->precision;
+  (*opCoarse)->passiveprecision = opFine->passiveprecision;
+  (*opProlong)->passiveprecision = opFine->passiveprecision;
+  (*opRestrict)->passiveprecision = opFine->passiveprecision;
+
   // Cleanup
   ierr = CeedVectorDestroy(&multVec); CeedChk(ierr);
   ierr = CeedBasisDestroy(&basisCtoF); CeedChk(ierr);
@@ -389,6 +406,451 @@ static int CeedOperatorMultigridLevel_Core(CeedOperator opFine,
   return 0;
 }
 
+/**
+  @brief Create a CeedOperator sharing the QFunctions, restrictions, bases, and
+           passive vectors of another CeedOperator, but with its own backend data
+
+  @param[in] op      CeedOperator to copy
+  @param[out] copy   Address of the variable where the new CeedOperator will be
+                       stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorCreateShallowCopy(CeedOperator op, CeedOperator *copy) {
+  int ierr;
+
+  if (op->composite) {
+    ierr = CeedCompositeOperatorCreate(op->ceed, copy); CeedChk(ierr);
+    for (CeedInt i=0; i<op->numsub; i++) {
+      CeedOperator subcopy;
+      ierr = CeedOperatorCreateShallowCopy(op->suboperators[i], &subcopy);
+      CeedChk(ierr);
+      ierr = CeedCompositeOperatorAddSub(*copy, subcopy); CeedChk(ierr);
+      ierr = CeedOperatorDestroy(&subcopy); CeedChk(ierr);
+    }
+  } else {
+    ierr = CeedOperatorCreate(op->ceed, op->qf, op->dqf, op->dqfT, copy);
+    CeedChk(ierr);
+    for (CeedInt i=0; i<op->qf->numinputfields; i++) {
+      CeedOperatorField field = op->inputfields[i];
+      ierr = CeedOperatorSetField(*copy, field->fieldname, field->Erestrict,
+                                  field->basis, field->vec); CeedChk(ierr);
+    }
+    for (CeedInt i=0; i<op->qf->numoutputfields; i++) {
+      CeedOperatorField field = op->outputfields[i];
+      ierr = CeedOperatorSetField(*copy, field->fieldname, field->Erestrict,
+                                  field->basis, field->vec); CeedChk(ierr);
+    }
+  }
+  (*copy)->precision = op->precision;
+  (*copy)->passiveprecision = op->passiveprecision;
+
+  return 0;
+}
+
+/**
+  @brief Find the largest eigenvalue of a symmetric tridiagonal matrix by
+           Sturm sequence bisection
+
+  @param m          Size of the matrix
+  @param alpha      Diagonal, of length @a m
+  @param beta       Off-diagonal, of length @a m - 1
+  @param[out] lmax  Largest eigenvalue
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedTridiagonalMaxEigenvalue(CeedInt m, const CeedScalar *alpha,
+                                        const CeedScalar *beta,
+                                        CeedScalar *lmax) {
+  // Gershgorin bounds
+  CeedScalar lo = alpha[0], hi = alpha[0];
+  for (CeedInt i=0; i<m; i++) {
+    CeedScalar radius = (i > 0 ? fabs(beta[i-1]) : 0) +
+                        (i < m-1 ? fabs(beta[i]) : 0);
+    lo = alpha[i] - radius < lo ? alpha[i] - radius : lo;
+    hi = alpha[i] + radius > hi ? alpha[i] + radius : hi;
+  }
+
+  // Bisect on the number of eigenvalues below x
+  for (CeedInt it=0; it<100 && hi - lo > 1e-14*fabs(hi); it++) {
+    CeedScalar x = (lo + hi) / 2, d = 1;
+    CeedInt count = 0;
+    for (CeedInt i=0; i<m; i++) {
+      d = alpha[i] - x - (i > 0 ? beta[i-1]*beta[i-1] / d : 0);
+      if (d == 0)
+        d = 1e-300;
+      count += d < 0;
+    }
+    if (count == m)
+      hi = x;
+    else
+      lo = x;
+  }
+  *lmax = hi;
+  return 0;
+}
+
+/**
+  @brief Estimate the extreme eigenvalues of the Jacobi preconditioned
+           operator D^{-1} A of a CeedOperatorSmoother
+
+  A few Lanczos steps in the D inner product give the largest eigenvalue of
+    D^{-1} A; the Chebyshev interval is then [0.1, 1.1] times this estimate.
+
+  @param smoother  CeedOperatorSmoother to estimate eigenvalues for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSmootherEstimateEigenvalues(CeedOperatorSmoother
+    smoother) {
+  int ierr;
+  CeedVector q = smoother->r, qprev = smoother->d, aq = smoother->z;
+  CeedScalar *qarray, *qprevarray, alpha[CEED_SMOOTHER_LANCZOS_STEPS],
+             beta[CEED_SMOOTHER_LANCZOS_STEPS];
+  const CeedScalar *dinv, *aqarray;
+  CeedSize n;
+  ierr = CeedVectorGetLength(q, &n); CeedChk(ierr);
+
+  // Deterministic starting vector, normalized in the D inner product
+  ierr = CeedVectorSetValue(qprev, 0.0); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(smoother->dinv, CEED_MEM_HOST, &dinv);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArray(q, CEED_MEM_HOST, &qarray); CeedChk(ierr);
+  CeedScalar norm = 0;
+  for (CeedSize i=0; i<n; i++) {
+    qarray[i] = 1.0 + sin(i+1.0)/2;
+    norm += qarray[i]*qarray[i] / dinv[i];
+  }
+  norm = sqrt(norm);
+  for (CeedSize i=0; i<n; i++)
+    qarray[i] /= norm;
+  ierr = CeedVectorRestoreArray(q, &qarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(smoother->dinv, &dinv); CeedChk(ierr);
+
+  CeedInt m = 0;
+  for (CeedInt j=0; j<CEED_SMOOTHER_LANCZOS_STEPS; j++) {
+    ierr = CeedOperatorApply(smoother->op, q, aq, CEED_REQUEST_IMMEDIATE);
+    CeedChk(ierr);
+    ierr = CeedVectorGetArrayRead(smoother->dinv, CEED_MEM_HOST, &dinv);
+    CeedChk(ierr);
+    ierr = CeedVectorGetArrayRead(aq, CEED_MEM_HOST, &aqarray); CeedChk(ierr);
+    ierr = CeedVectorGetArray(q, CEED_MEM_HOST, &qarray); CeedChk(ierr);
+    ierr = CeedVectorGetArray(qprev, CEED_MEM_HOST, &qprevarray);
+    CeedChk(ierr);
+    // -- alpha_j = q_j^T A q_j
+    alpha[j] = 0;
+    for (CeedSize i=0; i<n; i++)
+      alpha[j] += qarray[i]*aqarray[i];
+    // -- w = D^{-1} A q_j - alpha_j q_j - beta_{j-1} q_{j-1}
+    const CeedScalar betaprev = j > 0 ? beta[j-1] : 0;
+    norm = 0;
+    for (CeedSize i=0; i<n; i++) {
+      CeedScalar w = dinv[i]*aqarray[i] - alpha[j]*qarray[i] -
+                     betaprev*qprevarray[i];
+      qprevarray[i] = qarray[i];
+      qarray[i] = w;
+      norm += w*w / dinv[i];
+    }
+    beta[j] = sqrt(norm);
+    for (CeedSize i=0; i<n && beta[j] > 0; i++)
+      qarray[i] /= beta[j];
+    ierr = CeedVectorRestoreArray(qprev, &qprevarray); CeedChk(ierr);
+    ierr = CeedVectorRestoreArray(q, &qarray); CeedChk(ierr);
+    ierr = CeedVectorRestoreArrayRead(aq, &aqarray); CeedChk(ierr);
+    ierr = CeedVectorRestoreArrayRead(smoother->dinv, &dinv); CeedChk(ierr);
+    m++;
+    // -- Invariant subspace found
+    if (beta[j] <= 1e-12*fabs(alpha[j]))
+      break;
+  }
+
+  CeedScalar lmax;
+  ierr = CeedTridiagonalMaxEigenvalue(m, alpha, beta, &lmax); CeedChk(ierr);
+  smoother->lmin = 0.1*lmax;
+  smoother->lmax = 1.1*lmax;
+  return 0;
+}
+
+/**
+  @brief Run one Chebyshev iteration of a CeedOperatorSmoother
+
+  This computes r = rin - A u, d = c1 d + c2 D^{-1} r, and x += d, where u is
+    either x or the update direction d and rin is either the right hand side
+    or r. Backends with ApplyChebyshevStep apply these updates inside the
+    operator application, as the output restriction of each element block
+    completes entries of A u; otherwise A u is computed into the smoother's
+    work vector z and the updates take one more pass over the vectors.
+
+  @param smoother  CeedOperatorSmoother
+  @param u         CeedVector the operator is applied to, x or the smoother's
+                     update direction
+  @param rin       CeedVector the residual is computed from, the right hand
+                     side or the smoother's residual
+  @param c1        Coefficient of the previous update direction
+  @param c2        Coefficient of the scaled residual
+  @param x         CeedVector containing the approximate solution
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSmootherStep(CeedOperatorSmoother smoother,
+                                    CeedVector u, CeedVector rin,
+                                    CeedScalar c1, CeedScalar c2,
+                                    CeedVector x, CeedRequest *request) {
+  int ierr;
+  CeedOperator op = smoother->op;
+
+  // Fused in the backend, which leaves z zeroed for the next step
+  if (op->ApplyChebyshevStep) {
+    ierr = op->ApplyChebyshevStep(op, u, rin, smoother->dinv, c1, c2,
+                                  smoother->r, smoother->d, x, smoother->z,
+                                  request); CeedChk(ierr);
+    return 0;
+  }
+
+  const CeedScalar *rinarray, *dinv, *zarray;
+  CeedScalar *xarray, *rarray, *darray;
+  CeedSize n;
+  ierr = CeedVectorGetLength(x, &n); CeedChk(ierr);
+  ierr = CeedOperatorApply(op, u, smoother->z, request); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(smoother->dinv, CEED_MEM_HOST, &dinv);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(smoother->z, CEED_MEM_HOST, &zarray);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArray(smoother->r, CEED_MEM_HOST, &rarray); CeedChk(ierr);
+  ierr = CeedVectorGetArray(smoother->d, CEED_MEM_HOST, &darray); CeedChk(ierr);
+  ierr = CeedVectorGetArray(x, CEED_MEM_HOST, &xarray); CeedChk(ierr);
+  if (rin == smoother->r) {
+    rinarray = rarray;
+  } else {
+    ierr = CeedVectorGetArrayRead(rin, CEED_MEM_HOST, &rinarray); CeedChk(ierr);
+  }
+  for (CeedSize i=0; i<n; i++) {
+    rarray[i] = rinarray[i] - zarray[i];
+    darray[i] = c1*darray[i] + c2*dinv[i]*rarray[i];
+    xarray[i] += darray[i];
+  }
+  if (rin != smoother->r) {
+    ierr = CeedVectorRestoreArrayRead(rin, &rinarray); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(x, &xarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(smoother->d, &darray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(smoother->r, &rarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(smoother->z, &zarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(smoother->dinv, &dinv); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Determine the quadrature rule of a tensor product CeedBasis
+
+  @param basis       Tensor product CeedBasis
+  @param[out] qmode  Quadrature mode matching the quadrature points of @a basis
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMultigridBasisGetQuadMode(CeedBasis basis,
+    CeedQuadMode *qmode) {
+  int ierr;
+  const CeedInt Q = basis->Q1d;
+  const CeedQuadMode modes[2] = {CEED_GAUSS, CEED_GAUSS_LOBATTO};
+  CeedScalar *qref, *qweight;
+
+  ierr = CeedMalloc(Q, &qref); CeedChk(ierr);
+  ierr = CeedMalloc(Q, &qweight); CeedChk(ierr);
+  for (CeedInt m=0; m<2; m++) {
+    if (modes[m] == CEED_GAUSS) {
+      ierr = CeedGaussQuadrature(Q, qref, qweight); CeedChk(ierr);
+    } else {
+      ierr = CeedLobattoQuadrature(Q, qref, qweight); CeedChk(ierr);
+    }
+    bool match = true;
+    for (CeedInt i=0; i<Q; i++)
+      match = match && fabs(qref[i] - basis->qref1d[i]) < 1e-12;
+    if (match) {
+      *qmode = modes[m];
+      ierr = CeedFree(&qref); CeedChk(ierr);
+      ierr = CeedFree(&qweight); CeedChk(ierr);
+      return 0;
+    }
+  }
+  ierr = CeedFree(&qref); CeedChk(ierr);
+  ierr = CeedFree(&qweight); CeedChk(ierr);
+  // LCOV_EXCL_START
+  return CeedError(basis->ceed, 1, "Automatic multigrid hierarchy requires "
+                   "Gauss or Gauss-Lobatto quadrature");
+  // LCOV_EXCL_STOP
+}
+
+/// Coarse node of a CeedMultigridHierarchy level, identified by the sorted
+///   L-vector offsets of the fine nodes nearest to it
+typedef struct {
+  CeedInt numkeys;
+  CeedInt keys[8];
+  CeedInt index;
+} CeedMultigridCoarseNode;
+
+/**
+  @brief Compare coarse nodes by their fine node keys, for qsort
+
+  @ref Developer
+**/
+static int CeedMultigridCoarseNodeCompare(const void *a, const void *b) {
+  const CeedMultigridCoarseNode *na = a, *nb = b;
+  if (na->numkeys != nb->numkeys)
+    return na->numkeys < nb->numkeys ? -1 : 1;
+  for (CeedInt i=0; i<na->numkeys; i++)
+    if (na->keys[i] != nb->keys[i])
+      return na->keys[i] < nb->keys[i] ? -1 : 1;
+  return 0;
+}
+
+/**
+  @brief Create a lower degree H1 CeedElemRestriction on the same mesh as a
+           tensor product H1 CeedElemRestriction
+
+  Each coarse node is matched with the one to 2^dim fine nodes closest to its
+    position in the element, along each direction the fine nodes at
+    floor(a (Pf - 1) / (Pc - 1)) and ceil(a (Pf - 1) / (Pc - 1)) for coarse
+    index a. These sets are invariant under the symmetries of the element, so
+    neighboring elements identify their shared coarse nodes by the same fine
+    L-vector offsets. The coarse L-vector uses a component stride of the
+    number of coarse nodes.
+
+  @param rstrFine         Fine grid CeedElemRestriction
+  @param dim              Topological dimension of the elements
+  @param Pf               Number of fine nodes in one dimension
+  @param Pc               Number of coarse nodes in one dimension
+  @param[out] rstrCoarse  Address of the variable where the newly created
+                            CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMultigridCreateCoarseRestriction(CeedElemRestriction rstrFine,
+    CeedInt dim, CeedInt Pf, CeedInt Pc, CeedElemRestriction *rstrCoarse) {
+  int ierr;
+  Ceed ceed = rstrFine->ceed;
+  const CeedInt nelem = rstrFine->nelem, ncomp = rstrFine->ncomp;
+  const CeedInt esizef = CeedIntPow(Pf, dim), esizec = CeedIntPow(Pc, dim);
+  bool isstrided;
+
+  if (rstrFine->elemsize != esizef)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Active restriction element size %d does not "
+                     "match tensor basis size %d", rstrFine->elemsize, esizef);
+  // LCOV_EXCL_STOP
+
+  // Discontinuous spaces stay strided
+  ierr = CeedElemRestrictionIsStrided(rstrFine, &isstrided); CeedChk(ierr);
+  if (isstrided) {
+    CeedInt strides[3] = {1, esizec, esizec*ncomp};
+    ierr = CeedElemRestrictionCreateStrided(ceed, nelem, esizec, ncomp,
+                                            (CeedSize)nelem*esizec*ncomp,
+                                            strides, rstrCoarse); CeedChk(ierr);
+    return 0;
+  }
+
+  // Key each coarse node by the fine nodes nearest to it
+  const CeedInt *offsetsf;
+  CeedMultigridCoarseNode *nodes;
+  ierr = CeedElemRestrictionGetOffsets(rstrFine, CEED_MEM_HOST, &offsetsf);
+  CeedChk(ierr);
+  ierr = CeedMalloc(nelem*esizec, &nodes); CeedChk(ierr);
+  for (CeedInt e=0; e<nelem; e++)
+    for (CeedInt n=0; n<esizec; n++) {
+      CeedMultigridCoarseNode *node = &nodes[e*esizec + n];
+      CeedInt lo[3], hi[3];
+      for (CeedInt d=0, a=n; d<dim; d++, a/=Pc) {
+        lo[d] = (a%Pc)*(Pf-1) / (Pc-1);
+        hi[d] = ((a%Pc)*(Pf-1) + Pc-2) / (Pc-1);
+      }
+      node->index = e*esizec + n;
+      node->numkeys = 0;
+      for (CeedInt c=0; c<(1 << dim); c++) {
+        CeedInt f = 0;
+        for (CeedInt d=dim-1; d>=0; d--)
+          f = f*Pf + ((c >> d) & 1 ? hi[d] : lo[d]);
+        const CeedInt key = offsetsf[e*esizef + f];
+        // -- Sorted insertion, skipping duplicates
+        CeedInt k = node->numkeys;
+        while (k > 0 && node->keys[k-1] > key) k--;
+        if (k > 0 && node->keys[k-1] == key) continue;
+        for (CeedInt j=node->numkeys; j>k; j--)
+          node->keys[j] = node->keys[j-1];
+        node->keys[k] = key;
+        node->numkeys++;
+      }
+    }
+  ierr = CeedElemRestrictionRestoreOffsets(rstrFine, &offsetsf); CeedChk(ierr);
+
+  // Number coarse nodes with equal keys together
+  CeedInt *offsetsc, numnodes = 0;
+  qsort(nodes, nelem*esizec, sizeof(nodes[0]), CeedMultigridCoarseNodeCompare);
+  ierr = CeedMalloc(nelem*esizec, &offsetsc); CeedChk(ierr);
+  for (CeedInt i=0; i<nelem*esizec; i++) {
+    if (i > 0 && CeedMultigridCoarseNodeCompare(&nodes[i-1], &nodes[i]))
+      numnodes++;
+    offsetsc[nodes[i].index] = numnodes;
+  }
+  numnodes++;
+  ierr = CeedFree(&nodes); CeedChk(ierr);
+
+  ierr = CeedElemRestrictionCreate(ceed, nelem, esizec, ncomp, numnodes,
+                                   (CeedSize)ncomp*numnodes, CEED_MEM_HOST,
+                                   CEED_OWN_POINTER, offsetsc, rstrCoarse);
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Get a coarse basis for a CeedMultigridHierarchy, reusing a
+           previously created basis with the same shape when possible
+
+  @param hierarchy         CeedMultigridHierarchy holding the coarse bases
+  @param basisFine         Fine grid tensor product active basis
+  @param Pc                Number of coarse nodes in one dimension
+  @param[out] basisCoarse  Coarse basis, owned by @a hierarchy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMultigridHierarchyGetBasis(CeedMultigridHierarchy hierarchy,
+    CeedBasis basisFine, CeedInt Pc, CeedBasis *basisCoarse) {
+  int ierr;
+  CeedQuadMode qmode;
+  ierr = CeedMultigridBasisGetQuadMode(basisFine, &qmode); CeedChk(ierr);
+
+  for (CeedInt b=0; b<hierarchy->numbases; b++) {
+    CeedBasis basis = hierarchy->bases[b];
+    if (basis->dim == basisFine->dim && basis->ncomp == basisFine->ncomp &&
+        basis->P1d == Pc && basis->Q1d == basisFine->Q1d &&
+        !memcmp(basis->qref1d, basisFine->qref1d,
+                basis->Q1d*sizeof(basis->qref1d[0]))) {
+      *basisCoarse = basis;
+      return 0;
+    }
+  }
+  ierr = CeedBasisCreateTensorH1Lagrange(basisFine->ceed, basisFine->dim,
+                                         basisFine->ncomp, Pc, basisFine->Q1d,
+                                         qmode, basisCoarse); CeedChk(ierr);
+  hierarchy->bases[hierarchy->numbases++] = *basisCoarse;
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -618,6 +1080,112 @@ int CeedOperatorSetSetupDone(CeedOperator op) {
   return 0;
 }
 
+/**
+  @brief Run the backend setup of a CeedOperator and of its suboperators
+
+  Backends that set up the E-vectors and other scratch data of a CeedOperator
+    on its first application may provide a setup function so that this work
+    can be done ahead of time, e.g. before a CeedOperatorWorkspace is applied
+    from several threads at once.
+
+  @param op              CeedOperator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorSetup(CeedOperator op) {
+  int ierr;
+
+  for (CeedInt i=0; i<op->numsub; i++) {
+    ierr = CeedOperatorSetup(op->suboperators[i]); CeedChk(ierr);
+  }
+  if (op->Setup) {
+    ierr = op->Setup(op); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Get the memory held by the backend for a CeedOperator
+
+  Backends report the E- and Q-vectors, blocked restrictions, and other data
+    they set up for the operator and its suboperators. The fields of the
+    operator are not included. Backends without this query report no memory.
+
+  @param op          CeedOperator
+  @param[out] bytes  Number of bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetMemoryUsage(CeedOperator op, CeedSize *bytes) {
+  int ierr;
+
+  *bytes = 0;
+  for (CeedInt i=0; i<op->numsub; i++) {
+    CeedSize subbytes;
+    ierr = CeedOperatorGetMemoryUsage(op->suboperators[i], &subbytes);
+    CeedChk(ierr);
+    *bytes += subbytes;
+  }
+  if (op->GetMemoryUsage) {
+    CeedSize backendbytes;
+    ierr = op->GetMemoryUsage(op, &backendbytes); CeedChk(ierr);
+    *bytes += backendbytes;
+  }
+  return 0;
+}
+
+/**
+  @brief Get the CeedOperator a CeedOperatorWorkspace was created for
+
+  @param ws        CeedOperatorWorkspace
+  @param[out] op   Variable to store CeedOperator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorWorkspaceGetOperator(CeedOperatorWorkspace ws,
+                                     CeedOperator *op) {
+  *op = ws->op;
+  return 0;
+}
+
+/**
+  @brief Get the backend data of a CeedOperatorWorkspace
+
+  @param ws          CeedOperatorWorkspace
+  @param[out] data   Variable to store data
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorWorkspaceGetData(CeedOperatorWorkspace ws, void *data) {
+  *(void **)data = ws->data;
+  return 0;
+}
+
+/**
+  @brief Set the backend data of a CeedOperatorWorkspace
+
+  @param[out] ws   CeedOperatorWorkspace
+  @param data      Data to set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorWorkspaceSetData(CeedOperatorWorkspace ws, void *data) {
+  ws->data = data;
+  return 0;
+}
+
 /**
   @brief Get the CeedOperatorFields of a CeedOperator
 
@@ -752,6 +1320,8 @@ int CeedOperatorCreate(Ceed ceed, CeedQFunction qf, CeedQFunction dqf,
     (*op)->dqfT = dqfT;
     dqfT->refcount++;
   }
+  (*op)->precision = CEED_SCALAR_FP64;
+  (*op)->passiveprecision = CEED_SCALAR_FP64;
   ierr = CeedCalloc(16, &(*op)->inputfields); CeedChk(ierr);
   ierr = CeedCalloc(16, &(*op)->outputfields); CeedChk(ierr);
   ierr = ceed->OperatorCreate(*op); CeedChk(ierr);
@@ -785,7 +1355,10 @@ int CeedCompositeOperatorCreate(Ceed ceed, CeedOperator *op) {
   ierr = CeedCalloc(1, op); CeedChk(ierr);
   (*op)->ceed = ceed;
   ceed->refcount++;
+  (*op)->refcount = 1;
   (*op)->composite = true;
+  (*op)->precision = CEED_SCALAR_FP64;
+  (*op)->passiveprecision = CEED_SCALAR_FP64;
   ierr = CeedCalloc(16, &(*op)->suboperators); CeedChk(ierr);
 
   if (ceed->CompositeOperatorCreate) {
@@ -942,58 +1515,170 @@ int CeedCompositeOperatorAddSub(CeedOperator compositeop, CeedOperator subop) {
 }
 
 /**
-  @brief Assemble a linear CeedQFunction associated with a CeedOperator
+  @brief Set the floating point precision of the element computations of a
+           CeedOperator
 
-  This returns a CeedVector containing a matrix at each quadrature point
-    providing the action of the CeedQFunction associated with the CeedOperator.
-    The vector 'assembled' is of shape
-      [num_elements, num_input_fields, num_output_fields, num_quad_points]
-    and contains column-major matrices representing the action of the
-    CeedQFunction for a corresponding quadrature point on an element. Inputs and
-    outputs are in the order provided by the user when adding CeedOperator fields.
-    For example, a CeedQFunction with inputs 'u' and 'gradu' and outputs 'gradv' and
-    'v', provided in that order, would result in an assembled QFunction that
-    consists of (1 + dim) x (dim + 1) matrices at each quadrature point acting
-    on the input [u, du_0, du_1] and producing the output [dv_0, dv_1, v].
+  Vectors passed to CeedOperatorApply() and passive input and output vectors
+    remain in double precision; with @ref CEED_SCALAR_FP32, backends that
+    support it gather single precision E-vectors in the element restriction
+    and keep the Q-vectors in single precision, widening them only for the
+    QFunction and rounding its outputs back for the transpose basis action.
+    This is intended for preconditioners and multigrid smoothers, where the
+    accuracy of single precision suffices. Backends without a single precision
+    path compute in double precision. For a composite operator, the precision
+    of each suboperator is set.
 
-  @param op             CeedOperator to assemble CeedQFunction
-  @param[out] assembled CeedVector to store assembled CeedQFunction at
-                          quadrature points
-  @param[out] rstr      CeedElemRestriction for CeedVector containing assembled
-                          CeedQFunction
-  @param request        Address of CeedRequest for non-blocking completion, else
-                          @ref CEED_REQUEST_IMMEDIATE
+  @param op    CeedOperator
+  @param prec  Precision, @ref CEED_SCALAR_FP64 (default) or
+                 @ref CEED_SCALAR_FP32
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled,
-                                        CeedElemRestriction *rstr,
-                                        CeedRequest *request) {
+int CeedOperatorSetPrecision(CeedOperator op, CeedScalarType prec) {
   int ierr;
-  Ceed ceed = op->ceed;
-  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  if (op->setupdone)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot change the precision of an operator "
+                     "after it has been applied");
+  // LCOV_EXCL_STOP
+  if (prec == CEED_SCALAR_BF16)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "bfloat16 is only supported for the storage "
+                     "of passive inputs");
+  // LCOV_EXCL_STOP
 
-  // Backend version
-  if (op->LinearAssembleQFunction) {
-    ierr = op->LinearAssembleQFunction(op, assembled, rstr, request);
-    CeedChk(ierr);
-  } else {
-    // Fallback to reference Ceed
-    if (!op->opfallback) {
-      ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
-    }
-    // Assemble
-    ierr = op->opfallback->LinearAssembleQFunction(op->opfallback, assembled,
-           rstr, request); CeedChk(ierr);
+  op->precision = prec;
+  for (CeedInt i=0; i<op->numsub; i++) {
+    ierr = CeedOperatorSetPrecision(op->suboperators[i], prec); CeedChk(ierr);
   }
-
   return 0;
 }
 
 /**
-  @brief Assemble the diagonal of a square linear CeedOperator
+  @brief Get the floating point precision of the element computations of a
+           CeedOperator
+
+  @param op         CeedOperator
+  @param[out] prec  Variable to store precision
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorGetPrecision(CeedOperator op, CeedScalarType *prec) {
+  *prec = op->precision;
+  return 0;
+}
+
+/**
+  @brief Set the storage precision of the passive CEED_EVAL_NONE inputs of a
+           CeedOperator
+
+  Passive inputs without a basis, such as geometric factors stored at
+    quadrature points, are read on every application. With
+    @ref CEED_SCALAR_FP32 or @ref CEED_SCALAR_BF16, backends that support it
+    keep a copy of these inputs in the reduced precision, rebuilt whenever the
+    passive CeedVector changes, and widen each element block to double
+    precision before the QFunction. The active input and output and all
+    arithmetic remain in double precision, while the memory traffic for these
+    inputs drops by a factor of two or four. For a composite operator, the
+    storage precision of each suboperator is set.
+
+  @param op    CeedOperator
+  @param prec  Storage precision, @ref CEED_SCALAR_FP64 (default),
+                 @ref CEED_SCALAR_FP32, or @ref CEED_SCALAR_BF16
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSetPassivePrecision(CeedOperator op, CeedScalarType prec) {
+  int ierr;
+  if (op->setupdone)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot change the precision of an operator "
+                     "after it has been applied");
+  // LCOV_EXCL_STOP
+
+  op->passiveprecision = prec;
+  for (CeedInt i=0; i<op->numsub; i++) {
+    ierr = CeedOperatorSetPassivePrecision(op->suboperators[i], prec);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Get the storage precision of the passive CEED_EVAL_NONE inputs of a
+           CeedOperator
+
+  @param op         CeedOperator
+  @param[out] prec  Variable to store storage precision
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorGetPassivePrecision(CeedOperator op, CeedScalarType *prec) {
+  *prec = op->passiveprecision;
+  return 0;
+}
+
+/**
+  @brief Assemble a linear CeedQFunction associated with a CeedOperator
+
+  This returns a CeedVector containing a matrix at each quadrature point
+    providing the action of the CeedQFunction associated with the CeedOperator.
+    The vector 'assembled' is of shape
+      [num_elements, num_input_fields, num_output_fields, num_quad_points]
+    and contains column-major matrices representing the action of the
+    CeedQFunction for a corresponding quadrature point on an element. Inputs and
+    outputs are in the order provided by the user when adding CeedOperator fields.
+    For example, a CeedQFunction with inputs 'u' and 'gradu' and outputs 'gradv' and
+    'v', provided in that order, would result in an assembled QFunction that
+    consists of (1 + dim) x (dim + 1) matrices at each quadrature point acting
+    on the input [u, du_0, du_1] and producing the output [dv_0, dv_1, v].
+
+  @param op             CeedOperator to assemble CeedQFunction
+  @param[out] assembled CeedVector to store assembled CeedQFunction at
+                          quadrature points
+  @param[out] rstr      CeedElemRestriction for CeedVector containing assembled
+                          CeedQFunction
+  @param request        Address of CeedRequest for non-blocking completion, else
+                          @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled,
+                                        CeedElemRestriction *rstr,
+                                        CeedRequest *request) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+
+  // Backend version
+  if (op->LinearAssembleQFunction) {
+    ierr = op->LinearAssembleQFunction(op, assembled, rstr, request);
+    CeedChk(ierr);
+  } else {
+    // Fallback to reference Ceed
+    if (!op->opfallback) {
+      ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+    }
+    // Assemble
+    ierr = op->opfallback->LinearAssembleQFunction(op->opfallback, assembled,
+           rstr, request); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Assemble the diagonal of a square linear CeedOperator
 
   This overwrites a CeedVector with the diagonal of a linear CeedOperator.
 
@@ -1180,6 +1865,133 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op,
   return 0;
 }
 
+/**
+  @brief Compute the sparsity pattern of a linear CeedOperator in coordinate
+           (COO) format
+
+  The pattern depends only on the active element restrictions, so it can be
+    computed once and reused with @ref CeedOperatorLinearAssemble() whenever
+    the operator values change. Entries with the same row and column index
+    are to be summed.
+
+  Note: Currently only non-composite operators with a single field and
+    composite operators with single field sub-operators are supported.
+
+  @param op             CeedOperator to assemble
+  @param[out] nentries  Number of entries in the coordinate representation
+  @param[out] rows      Row indices of the entries, as CeedSize since
+                          L-vectors may exceed INT32_MAX, to be freed by the
+                          caller with free()
+  @param[out] cols      Column indices of the entries, to be freed by the
+                          caller with free()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *nentries,
+                                       CeedSize **rows, CeedSize **cols) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+
+  // Use backend version, if available
+  if (op->LinearAssembleSymbolic) {
+    ierr = op->LinearAssembleSymbolic(op, nentries, rows, cols); CeedChk(ierr);
+  } else {
+    // Fallback to reference Ceed
+    if (!op->opfallback) {
+      ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+    }
+    // Assemble
+    ierr = op->opfallback->LinearAssembleSymbolic(op->opfallback, nentries,
+           rows, cols); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Assemble the values of a linear CeedOperator in coordinate (COO)
+           format
+
+  The entries are ordered as the indices returned by
+    @ref CeedOperatorLinearAssembleSymbolic().
+
+  @param op           CeedOperator to assemble
+  @param[out] values  CeedVector of length nentries to store the values; other
+                        lengths are an error
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+
+  // Use backend version, if available
+  if (op->LinearAssemble) {
+    ierr = op->LinearAssemble(op, values); CeedChk(ierr);
+  } else {
+    // Fallback to reference Ceed
+    if (!op->opfallback) {
+      ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+    }
+    // Assemble
+    ierr = op->opfallback->LinearAssemble(op->opfallback, values);
+    CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Assemble the dense element matrices of a linear CeedOperator
+
+  The element matrices are stored contiguously, one after the other, with
+    shape [nelem, ncomp out, elemsize out, ncomp in, elemsize in]. Each
+    element matrix is row-major, so a column-major batched LAPACK routine
+    such as getrf factors its transpose, which is the matrix itself for
+    symmetric operators. For composite operators the element matrices of the
+    sub-operators follow each other in order. These are the values assembled
+    by @ref CeedOperatorLinearAssemble().
+
+  Note: Currently only non-composite operators with a single field and
+    composite operators with single field sub-operators are supported.
+
+  @param op              CeedOperator to assemble
+  @param[out] assembled  CeedVector to store the element matrices
+  @param request         Address of CeedRequest for non-blocking completion,
+                           else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorAssembleElementMatrices(CeedOperator op, CeedVector *assembled,
+                                        CeedRequest *request) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+
+  // Use backend version, if available
+  if (op->AssembleElementMatrices) {
+    ierr = op->AssembleElementMatrices(op, assembled, request); CeedChk(ierr);
+  } else {
+    // Fallback to reference Ceed
+    if (!op->opfallback) {
+      ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+    }
+    // Assemble
+    ierr = op->opfallback->AssembleElementMatrices(op->opfallback, assembled,
+           request); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
 /**
   @brief Create a multigrid coarse operator and level transfer operators
            for a CeedOperator, creating the prolongation basis from the
@@ -1463,6 +2275,56 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdminv,
   return 0;
 }
 
+/**
+  @brief Build the exact inverse of each element matrix of a CeedOperator
+
+  This returns a CeedOperator applying the element block-Jacobi inverse
+    sum_e R_e^T A_e^{-1} R_e, where A_e is the dense element matrix of the
+    CeedOperator and R_e its active element restriction. The element matrices
+    are assembled and factored once, here, so the returned CeedOperator does
+    not see later changes to the passive inputs of the CeedOperator. Unlike
+    @ref CeedOperatorCreateFDMElementInverse(), any basis, number of
+    components, and variable coefficient is supported. The CeedOperator must
+    be linear and non-composite, with the same active input and output
+    restriction. The returned CeedOperator cannot be assembled.
+
+  @param op             CeedOperator to create element inverses
+  @param[out] blkinv    CeedOperator to apply the action of the element inverses
+  @param request        Address of CeedRequest for non-blocking completion, else
+                          @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorCreateElementBlockJacobiInverse(CeedOperator op,
+    CeedOperator *blkinv, CeedRequest *request) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Element block-Jacobi inverse not supported for "
+                     "composite operators");
+  // LCOV_EXCL_STOP
+
+  // Use backend version, if available
+  if (op->CreateElementBlockJacobiInverse) {
+    ierr = op->CreateElementBlockJacobiInverse(op, blkinv, request);
+    CeedChk(ierr);
+  } else {
+    // Fallback to reference Ceed
+    if (!op->opfallback) {
+      ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+    }
+    // Assemble
+    ierr = op->opfallback->CreateElementBlockJacobiInverse(op->opfallback,
+           blkinv, request); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
 /**
   @brief View a CeedOperator
 
@@ -1675,10 +2537,14 @@ int CeedOperatorDestroy(CeedOperator *op) {
   ierr = CeedQFunctionDestroy(&(*op)->dqfT); CeedChk(ierr);
 
   // Destroy fallback
-  if ((*op)->opfallback) {
+  if ((*op)->qffallback) {
     ierr = (*op)->qffallback->Destroy((*op)->qffallback); CeedChk(ierr);
     ierr = CeedFree(&(*op)->qffallback); CeedChk(ierr);
-    ierr = (*op)->opfallback->Destroy((*op)->opfallback); CeedChk(ierr);
+  }
+  if ((*op)->opfallback) {
+    if ((*op)->opfallback->Destroy) {
+      ierr = (*op)->opfallback->Destroy((*op)->opfallback); CeedChk(ierr);
+    }
     ierr = CeedFree(&(*op)->opfallback); CeedChk(ierr);
   }
 
@@ -1689,4 +2555,680 @@ int CeedOperatorDestroy(CeedOperator *op) {
   return 0;
 }
 
+/**
+  @brief Create a CeedOperatorWorkspace holding the scratch data needed to apply
+           a CeedOperator
+
+  The E-vectors, Q-vectors, and other intermediate data used by a backend
+    during @ref CeedOperatorApply() are stored in the CeedOperator itself, so
+    a CeedOperator may not be applied from several threads at once. Each
+    thread may instead create its own CeedOperatorWorkspace and apply the
+    shared CeedOperator through it with @ref CeedOperatorWorkspaceApply().
+    The CeedOperator is set up here, and the workspace shares its blocked
+    restrictions, packed passive data, and other setup products; only the
+    E- and Q-vector scratch is allocated per workspace. Backends without
+    workspace support fall back to a set up copy of the CeedOperator.
+
+  Workspaces should be created and destroyed outside of any parallel region.
+    Passive output fields are shared by all workspaces, so an operator with
+    passive outputs may not be applied concurrently.
+
+  @param op      CeedOperator to create a workspace for
+  @param[out] ws Address of the variable where the newly created
+                   CeedOperatorWorkspace will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorWorkspaceCreate(CeedOperator op, CeedOperatorWorkspace *ws) {
+  int ierr;
+  ierr = CeedOperatorCheckReady(op->ceed, op); CeedChk(ierr);
+  // Setup products are made here rather than on first application, when
+  //   several workspaces may be applied at once
+  ierr = CeedOperatorSetup(op); CeedChk(ierr);
+
+  ierr = CeedCalloc(1, ws); CeedChk(ierr);
+  (*ws)->op = op;
+  op->refcount++;
+  if (op->composite) {
+    ierr = CeedCalloc(op->numsub, &(*ws)->subws);
+    for (CeedInt i=0; i<op->numsub && !ierr; i++)
+      ierr = CeedOperatorWorkspaceCreate(op->suboperators[i],
+                                         &(*ws)->subws[i]);
+  } else if (op->WorkspaceCreate) {
+    ierr = op->WorkspaceCreate(op, *ws);
+  } else {
+    ierr = CeedOperatorCreateShallowCopy(op, &(*ws)->clone);
+    if (!ierr)
+      ierr = CeedOperatorSetup((*ws)->clone);
+  }
+  if (ierr) {
+    // LCOV_EXCL_START
+    CeedOperatorWorkspaceDestroy(ws);
+    return ierr;
+    // LCOV_EXCL_STOP
+  }
+
+  return 0;
+}
+
+/**
+  @brief Apply a CeedOperator to a vector using the scratch data of a
+           CeedOperatorWorkspace
+
+  Several threads may call this function at the same time on workspaces created
+    for the same CeedOperator, provided each uses its own workspace and output
+    vector.
+
+  @param ws        CeedOperatorWorkspace to use
+  @param[in] in    CeedVector containing input state or @ref CEED_VECTOR_NONE if
+                     there are no active inputs
+  @param[out] out  CeedVector to store result of applying operator (must be
+                     distinct from @a in) or @ref CEED_VECTOR_NONE if there are no
+                     active outputs
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorWorkspaceApply(CeedOperatorWorkspace ws, CeedVector in,
+                               CeedVector out, CeedRequest *request) {
+  int ierr;
+  CeedOperator op = ws->op;
+
+  if (ws->clone) {
+    ierr = CeedOperatorApply(ws->clone, in, out, request); CeedChk(ierr);
+    return 0;
+  }
+
+  // Zero all output vectors
+  if (out != CEED_VECTOR_NONE) {
+    ierr = CeedVectorSetValue(out, 0.0); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<(op->composite ? op->numsub : 1); i++) {
+    CeedOperator subop = op->composite ? op->suboperators[i] : op;
+    for (CeedInt j=0; j<subop->qf->numoutputfields; j++) {
+      CeedVector vec = subop->outputfields[j]->vec;
+      if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) {
+        ierr = CeedVectorSetValue(vec, 0.0); CeedChk(ierr);
+      }
+    }
+  }
+  // Apply
+  ierr = CeedOperatorWorkspaceApplyAdd(ws, in, out, request); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Apply a CeedOperator to a vector and add the result to the output
+           vector using the scratch data of a CeedOperatorWorkspace
+
+  @param ws        CeedOperatorWorkspace to use
+  @param[in] in    CeedVector containing input state or NULL if there are no
+                     active inputs
+  @param[out] out  CeedVector to sum in result of applying operator (must be
+                     distinct from @a in) or NULL if there are no active outputs
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorWorkspaceApplyAdd(CeedOperatorWorkspace ws, CeedVector in,
+                                  CeedVector out, CeedRequest *request) {
+  int ierr;
+  CeedOperator op = ws->op;
+
+  if (ws->clone) {
+    ierr = CeedOperatorApplyAdd(ws->clone, in, out, request); CeedChk(ierr);
+  } else if (op->composite) {
+    for (CeedInt i=0; i<op->numsub; i++) {
+      ierr = CeedOperatorWorkspaceApplyAdd(ws->subws[i], in, out, request);
+      CeedChk(ierr);
+    }
+  } else if (op->numelements) {
+    ierr = op->WorkspaceApplyAdd(ws, in, out, request); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Destroy a CeedOperatorWorkspace
+
+  @param ws CeedOperatorWorkspace to destroy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorWorkspaceDestroy(CeedOperatorWorkspace *ws) {
+  int ierr;
+
+  if (!*ws) return 0;
+  CeedOperator op = (*ws)->op;
+  if ((*ws)->subws) {
+    for (CeedInt i=0; i<op->numsub; i++) {
+      ierr = CeedOperatorWorkspaceDestroy(&(*ws)->subws[i]); CeedChk(ierr);
+    }
+    ierr = CeedFree(&(*ws)->subws); CeedChk(ierr);
+  }
+  if ((*ws)->data) {
+    ierr = op->WorkspaceDestroy(*ws); CeedChk(ierr);
+  }
+  ierr = CeedOperatorDestroy(&(*ws)->clone); CeedChk(ierr);
+  ierr = CeedOperatorDestroy(&(*ws)->op); CeedChk(ierr);
+  ierr = CeedFree(ws); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a Chebyshev polynomial smoother with Jacobi preconditioning for
+           a linear CeedOperator
+
+  Each application of the smoother runs @a degree Chebyshev iterations on
+    D^{-1} A x = D^{-1} b, where D is the diagonal of A. The interval of the
+    Chebyshev polynomial is [0.1, 1.1] times the largest eigenvalue of
+    D^{-1} A, estimated here by a few Lanczos steps. The operator must be
+    symmetric positive definite.
+
+  @param op            CeedOperator to smooth
+  @param diag          Diagonal of @a op, as given by
+                         @ref CeedOperatorLinearAssembleDiagonal(), or NULL to
+                         assemble it here
+  @param degree        Number of Chebyshev iterations per application
+  @param[out] smoother Address of the variable where the newly created
+                         CeedOperatorSmoother will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSmootherCreateChebyshev(CeedOperator op, CeedVector diag,
+                                        CeedInt degree,
+                                        CeedOperatorSmoother *smoother) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  if (degree < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Chebyshev degree must be at least 1");
+  // LCOV_EXCL_STOP
+
+  ierr = CeedCalloc(1, smoother); CeedChk(ierr);
+  (*smoother)->op = op;
+  op->refcount++;
+  (*smoother)->degree = degree;
+
+  // Inverse diagonal
+  CeedSize n;
+  if (diag) {
+    const CeedScalar *diagarray;
+    ierr = CeedVectorGetLength(diag, &n); CeedChk(ierr);
+    ierr = CeedVectorCreate(ceed, n, &(*smoother)->dinv); CeedChk(ierr);
+    ierr = CeedVectorGetArrayRead(diag, CEED_MEM_HOST, &diagarray);
+    CeedChk(ierr);
+    ierr = CeedVectorSetArray((*smoother)->dinv, CEED_MEM_HOST,
+                              CEED_COPY_VALUES, (CeedScalar *)diagarray);
+    CeedChk(ierr);
+    ierr = CeedVectorRestoreArrayRead(diag, &diagarray); CeedChk(ierr);
+  } else {
+    CeedOperatorField *opfields;
+    CeedElemRestriction rstr = NULL;
+    CeedOperator subop = op->composite ? op->suboperators[0] : op;
+    ierr = CeedOperatorGetFields(subop, NULL, &opfields); CeedChk(ierr);
+    for (CeedInt i=0; i<subop->qf->numoutputfields; i++)
+      if (opfields[i]->vec == CEED_VECTOR_ACTIVE)
+        rstr = opfields[i]->Erestrict;
+    if (!rstr)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "No active output field set");
+    // LCOV_EXCL_STOP
+    ierr = CeedElemRestrictionGetLVectorSize(rstr, &n); CeedChk(ierr);
+    ierr = CeedVectorCreate(ceed, n, &(*smoother)->dinv); CeedChk(ierr);
+    ierr = CeedOperatorLinearAssembleDiagonal(op, (*smoother)->dinv,
+           CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  }
+  ierr = CeedVectorReciprocal((*smoother)->dinv); CeedChk(ierr);
+
+  // Work vectors
+  ierr = CeedVectorCreate(ceed, n, &(*smoother)->r); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed, n, &(*smoother)->d); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed, n, &(*smoother)->z); CeedChk(ierr);
+
+  ierr = CeedOperatorSmootherEstimateEigenvalues(*smoother); CeedChk(ierr);
+  // The first iteration scales a zero update direction, and backends fusing
+  //   the iteration expect a zeroed work vector
+  ierr = CeedVectorSetValue((*smoother)->d, 0.0); CeedChk(ierr);
+  ierr = CeedVectorSetValue((*smoother)->z, 0.0); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Get the eigenvalue interval of a Chebyshev CeedOperatorSmoother
+
+  @param smoother    CeedOperatorSmoother
+  @param[out] lmin   Lower end of the interval
+  @param[out] lmax   Upper end of the interval
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSmootherGetEigenvalueBounds(CeedOperatorSmoother smoother,
+    CeedScalar *lmin, CeedScalar *lmax) {
+  *lmin = smoother->lmin;
+  *lmax = smoother->lmax;
+  return 0;
+}
+
+/**
+  @brief Apply a CeedOperatorSmoother, updating an approximate solution
+
+  This improves the approximate solution @a x of A x = b in place. Backends
+    that support it update the residual, apply the diagonal scaling, and run
+    the Chebyshev recurrences for each L-vector entry as soon as the output
+    restriction of the last element block touching that entry completes it;
+    otherwise these updates take one pass over the vectors after each
+    application of the CeedOperator.
+
+  @param smoother   CeedOperatorSmoother to apply
+  @param[in] b      CeedVector containing the right hand side
+  @param[in,out] x  CeedVector containing the initial guess, overwritten with
+                      the smoothed solution (must be distinct from @a b)
+  @param request    Address of CeedRequest for non-blocking completion, else
+                      @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSmootherApply(CeedOperatorSmoother smoother, CeedVector b,
+                              CeedVector x, CeedRequest *request) {
+  int ierr;
+  const CeedScalar theta = (smoother->lmax + smoother->lmin) / 2,
+                   delta = (smoother->lmax - smoother->lmin) / 2,
+                   sigma = theta / delta;
+  CeedScalar rho = 1 / sigma;
+
+  // r = b - A x, d = D^{-1} r / theta, x += d
+  ierr = CeedOperatorSmootherStep(smoother, x, b, 0, 1 / theta, x, request);
+  CeedChk(ierr);
+
+  for (CeedInt k=1; k<smoother->degree; k++) {
+    // r -= A d, d = rho_k rho_{k-1} d + 2 rho_k / delta D^{-1} r, x += d
+    const CeedScalar rhonew = 1 / (2*sigma - rho);
+    ierr = CeedOperatorSmootherStep(smoother, smoother->d, smoother->r,
+                                    rhonew*rho, 2*rhonew / delta, x, request);
+    CeedChk(ierr);
+    rho = rhonew;
+  }
+  return 0;
+}
+
+/**
+  @brief Destroy a CeedOperatorSmoother
+
+  @param smoother CeedOperatorSmoother to destroy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSmootherDestroy(CeedOperatorSmoother *smoother) {
+  int ierr;
+
+  if (!*smoother) return 0;
+  ierr = CeedOperatorDestroy(&(*smoother)->op); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*smoother)->dinv); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*smoother)->r); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*smoother)->d); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*smoother)->z); CeedChk(ierr);
+  ierr = CeedFree(smoother); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a p-multigrid hierarchy for a linear CeedOperator
+
+  Starting from the fine grid operator, this creates the coarse restriction,
+    coarse operator, and level transfer operators of every coarser level with
+    @ref CeedOperatorMultigridLevelCreate(), along with the assembled diagonal
+    and the multiplicity of the restriction of every level. The active basis
+    must be a tensor product H1 Lagrange basis with Gauss or Gauss-Lobatto
+    quadrature; coarse restrictions are derived from the fine restriction, so
+    the hierarchy describes the process local problem. Composite operators
+    are supported when all sub-operators share the active restriction; the
+    sub-operators then share coarse bases with the same (P, Q) and a single
+    pair of transfer operators per level.
+
+  @param opFine          Fine grid CeedOperator
+  @param mode            Coarsening schedule, @ref CEED_MULTIGRID_COARSEN_HALF,
+                           @ref CEED_MULTIGRID_COARSEN_LINEAR, or
+                           @ref CEED_MULTIGRID_COARSEN_USER
+  @param numdegrees      Number of coarse degrees for
+                           @ref CEED_MULTIGRID_COARSEN_USER, else 0
+  @param degrees         Strictly decreasing coarse polynomial degrees for
+                           @ref CEED_MULTIGRID_COARSEN_USER, else NULL
+  @param[out] hierarchy  Address of the variable where the newly created
+                           CeedMultigridHierarchy will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridHierarchyCreate(CeedOperator opFine,
+                                 CeedMultigridCoarsenMode mode,
+                                 CeedInt numdegrees, const CeedInt *degrees,
+                                 CeedMultigridHierarchy *hierarchy) {
+  int ierr;
+  Ceed ceed = opFine->ceed;
+  ierr = CeedOperatorCheckReady(ceed, opFine); CeedChk(ierr);
+
+  // Active restriction and basis, shared by all sub-operators
+  CeedOperator *subops = opFine->composite ? opFine->suboperators : &opFine;
+  CeedInt numsub = opFine->composite ? opFine->numsub : 1;
+  CeedElemRestriction rstrFine = NULL;
+  CeedInt Pf = 0, dim = 0;
+  for (CeedInt s=0; s<numsub; s++) {
+    CeedBasis basis;
+    ierr = CeedOperatorGetActiveBasis(subops[s], &basis); CeedChk(ierr);
+    for (CeedInt i=0; i<subops[s]->qf->numinputfields; i++)
+      if (subops[s]->inputfields[i]->vec == CEED_VECTOR_ACTIVE) {
+        if (rstrFine && rstrFine != subops[s]->inputfields[i]->Erestrict)
+          // LCOV_EXCL_START
+          return CeedError(ceed, 1, "Sub-operators must share the active "
+                           "restriction for automatic multigrid setup");
+        // LCOV_EXCL_STOP
+        rstrFine = subops[s]->inputfields[i]->Erestrict;
+      }
+    if (!basis->tensorbasis || basis->collapsedbasis || basis->dim > 3 ||
+        (Pf && (basis->P1d != Pf || basis->dim != dim)))
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Automatic multigrid hierarchy requires "
+                       "matching tensor product H1 active bases");
+    // LCOV_EXCL_STOP
+    Pf = basis->P1d;
+    dim = basis->dim;
+  }
+
+  // Degree schedule
+  const CeedInt p = Pf - 1;
+  CeedInt numcoarse = 0, *coarsedegrees;
+  ierr = CeedMalloc(p > 1 ? p : 1, &coarsedegrees); CeedChk(ierr);
+  switch (mode) {
+  case CEED_MULTIGRID_COARSEN_HALF:
+    for (CeedInt d=p; d>1; )
+      coarsedegrees[numcoarse++] = d /= 2;
+    break;
+  case CEED_MULTIGRID_COARSEN_LINEAR:
+    if (p > 1)
+      coarsedegrees[numcoarse++] = 1;
+    break;
+  case CEED_MULTIGRID_COARSEN_USER:
+    for (CeedInt i=0; i<numdegrees; i++) {
+      if (degrees[i] < 1 || degrees[i] >= (i ? degrees[i-1] : p))
+        // LCOV_EXCL_START
+        return CeedError(ceed, 1, "Coarse degrees must be strictly "
+                         "decreasing and between 1 and %d", p - 1);
+      // LCOV_EXCL_STOP
+      coarsedegrees[numcoarse++] = degrees[i];
+    }
+    break;
+  }
+
+  // Allocate
+  CeedMultigridHierarchy h;
+  const CeedInt numlevels = numcoarse + 1, fine = numcoarse;
+  ierr = CeedCalloc(1, hierarchy); CeedChk(ierr);
+  h = *hierarchy;
+  h->numlevels = numlevels;
+  ierr = CeedCalloc(numlevels, &h->degrees); CeedChk(ierr);
+  ierr = CeedCalloc(numlevels, &h->ops); CeedChk(ierr);
+  ierr = CeedCalloc(numlevels, &h->opsprolong); CeedChk(ierr);
+  ierr = CeedCalloc(numlevels, &h->opsrestrict); CeedChk(ierr);
+  ierr = CeedCalloc(numlevels, &h->rstrs); CeedChk(ierr);
+  ierr = CeedCalloc(numlevels, &h->diags); CeedChk(ierr);
+  ierr = CeedCalloc(numlevels, &h->mults); CeedChk(ierr);
+  ierr = CeedCalloc(numcoarse*numsub + 1, &h->bases); CeedChk(ierr);
+  for (CeedInt l=0; l<numcoarse; l++)
+    h->degrees[l] = coarsedegrees[numcoarse - 1 - l];
+  h->degrees[fine] = p;
+  ierr = CeedFree(&coarsedegrees); CeedChk(ierr);
+  h->ops[fine] = opFine;
+  opFine->refcount++;
+  h->rstrs[fine] = rstrFine;
+  rstrFine->refcount++;
+
+  for (CeedInt l=fine; l>=0; l--) {
+    // Multiplicity and diagonal
+    ierr = CeedElemRestrictionCreateVector(h->rstrs[l], &h->mults[l], NULL);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetMultiplicity(h->rstrs[l], h->mults[l]);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionCreateVector(h->rstrs[l], &h->diags[l], NULL);
+    CeedChk(ierr);
+    ierr = CeedOperatorLinearAssembleDiagonal(h->ops[l], h->diags[l],
+           CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+    if (l == 0)
+      break;
+
+    // Coarse restriction
+    const CeedInt Pc = h->degrees[l-1] + 1;
+    ierr = CeedMultigridCreateCoarseRestriction(h->rstrs[l], dim,
+           h->degrees[l] + 1, Pc, &h->rstrs[l-1]); CeedChk(ierr);
+
+    // Coarse operator and transfer operators
+    CeedVector PMult;
+    ierr = CeedElemRestrictionCreateVector(h->rstrs[l], &PMult, NULL);
+    CeedChk(ierr);
+    ierr = CeedVectorSetValue(PMult, 1.0); CeedChk(ierr);
+    if (opFine->composite) {
+      ierr = CeedCompositeOperatorCreate(ceed, &h->ops[l-1]); CeedChk(ierr);
+    }
+    CeedOperator *levelsubops = h->ops[l]->composite ?
+                                h->ops[l]->suboperators : &h->ops[l];
+    for (CeedInt s=0; s<numsub; s++) {
+      CeedBasis basisFine, basisCoarse;
+      CeedOperator subCoarse, opProlong, opRestrict;
+      ierr = CeedOperatorGetActiveBasis(levelsubops[s], &basisFine);
+      CeedChk(ierr);
+      ierr = CeedMultigridHierarchyGetBasis(h, basisFine, Pc, &basisCoarse);
+      CeedChk(ierr);
+      ierr = CeedOperatorMultigridLevelCreate(levelsubops[s], PMult,
+             h->rstrs[l-1], basisCoarse, &subCoarse, &opProlong, &opRestrict);
+      CeedChk(ierr);
+      // -- Sub-operators share the active space, so one pair of transfer
+      //      operators serves all of them
+      if (s == 0) {
+        h->opsprolong[l] = opProlong;
+        h->opsrestrict[l] = opRestrict;
+      } else {
+        ierr = CeedOperatorDestroy(&opProlong); CeedChk(ierr);
+        ierr = CeedOperatorDestroy(&opRestrict); CeedChk(ierr);
+      }
+      if (opFine->composite) {
+        ierr = CeedCompositeOperatorAddSub(h->ops[l-1], subCoarse);
+        CeedChk(ierr);
+        ierr = CeedOperatorDestroy(&subCoarse); CeedChk(ierr);
+      } else {
+        h->ops[l-1] = subCoarse;
+      }
+    }
+    ierr = CeedVectorDestroy(&PMult); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Get the number of levels of a CeedMultigridHierarchy
+
+  @param hierarchy       CeedMultigridHierarchy
+  @param[out] numlevels  Number of levels, including the fine level
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridHierarchyGetNumLevels(CeedMultigridHierarchy hierarchy,
+                                       CeedInt *numlevels) {
+  *numlevels = hierarchy->numlevels;
+  return 0;
+}
+
+/**
+  @brief Get the objects of one level of a CeedMultigridHierarchy
+
+  Levels are numbered from the coarsest, level 0, to the fine level,
+    numlevels - 1. The returned objects are owned by the hierarchy. Any output
+    may be NULL if it is not needed.
+
+  @param hierarchy        CeedMultigridHierarchy
+  @param level            Level to query
+  @param[out] degree      Polynomial degree of the level
+  @param[out] op          Operator on the level
+  @param[out] opProlong   Prolongation from level - 1 to this level, or NULL
+                            on level 0
+  @param[out] opRestrict  Restriction from this level to level - 1, or NULL
+                            on level 0
+  @param[out] diag        Assembled diagonal of the operator on the level
+  @param[out] mult        Multiplicity of the L-vector nodes of the level
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridHierarchyGetLevel(CeedMultigridHierarchy hierarchy,
+                                   CeedInt level, CeedInt *degree,
+                                   CeedOperator *op, CeedOperator *opProlong,
+                                   CeedOperator *opRestrict, CeedVector *diag,
+                                   CeedVector *mult) {
+  if (level < 0 || level >= hierarchy->numlevels)
+    // LCOV_EXCL_START
+    return CeedError(hierarchy->ops[0]->ceed, 1,
+                     "Level %d out of range [0, %d)", level,
+                     hierarchy->numlevels);
+  // LCOV_EXCL_STOP
+
+  if (degree) *degree = hierarchy->degrees[level];
+  if (op) *op = hierarchy->ops[level];
+  if (opProlong) *opProlong = hierarchy->opsprolong[level];
+  if (opRestrict) *opRestrict = hierarchy->opsrestrict[level];
+  if (diag) *diag = hierarchy->diags[level];
+  if (mult) *mult = hierarchy->mults[level];
+  return 0;
+}
+
+/**
+  @brief Get the memory held by a CeedMultigridHierarchy
+
+  This counts the diagonal and multiplicity vectors of every level, the
+    coarse restrictions, the inverse multiplicities and bases of the level
+    transfer operators, the coarse bases, and the data the backend holds for
+    the coarse and transfer operators, such as E- and Q-vectors and blocked
+    restrictions. Backends set up operator data on first application, so the
+    count grows once the hierarchy is used. Memory of the fine grid operator
+    and of data shared with it, such as quadrature data, is not included.
+
+  Objects whose backend does not report its storage, such as GPU vectors,
+    contribute only the memory held by the interface.
+
+  @param hierarchy   CeedMultigridHierarchy
+  @param[out] bytes  Number of bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridHierarchyGetMemoryUsage(CeedMultigridHierarchy hierarchy,
+    CeedSize *bytes) {
+  int ierr;
+  const CeedInt fine = hierarchy->numlevels - 1;
+  CeedSize objbytes;
+  *bytes = 0;
+
+  for (CeedInt l=0; l<=fine; l++) {
+    ierr = CeedVectorGetMemoryUsage(hierarchy->diags[l], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+    ierr = CeedVectorGetMemoryUsage(hierarchy->mults[l], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+    if (l == fine)
+      continue;
+    // -- Coarse restriction and operator
+    ierr = CeedElemRestrictionGetMemoryUsage(hierarchy->rstrs[l], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+    ierr = CeedOperatorGetMemoryUsage(hierarchy->ops[l], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+  }
+  // Transfer operators, sharing an inverse multiplicity as their "scale" input
+  for (CeedInt l=1; l<=fine; l++) {
+    CeedOperator opProlong = hierarchy->opsprolong[l];
+    CeedBasis basisCtoF;
+    ierr = CeedVectorGetMemoryUsage(opProlong->inputfields[1]->vec, &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+    ierr = CeedOperatorGetActiveBasis(opProlong, &basisCtoF); CeedChk(ierr);
+    ierr = CeedBasisGetMemoryUsage(basisCtoF, &objbytes); CeedChk(ierr);
+    *bytes += objbytes;
+    ierr = CeedOperatorGetMemoryUsage(opProlong, &objbytes); CeedChk(ierr);
+    *bytes += objbytes;
+    ierr = CeedOperatorGetMemoryUsage(hierarchy->opsrestrict[l], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+  }
+  // Shared coarse bases
+  for (CeedInt b=0; b<hierarchy->numbases; b++) {
+    ierr = CeedBasisGetMemoryUsage(hierarchy->bases[b], &objbytes);
+    CeedChk(ierr);
+    *bytes += objbytes;
+  }
+
+  return 0;
+}
+
+/**
+  @brief Destroy a CeedMultigridHierarchy
+
+  @param hierarchy CeedMultigridHierarchy to destroy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridHierarchyDestroy(CeedMultigridHierarchy *hierarchy) {
+  int ierr;
+  CeedMultigridHierarchy h = *hierarchy;
+
+  if (!h) return 0;
+  for (CeedInt l=0; l<h->numlevels; l++) {
+    ierr = CeedOperatorDestroy(&h->ops[l]); CeedChk(ierr);
+    ierr = CeedOperatorDestroy(&h->opsprolong[l]); CeedChk(ierr);
+    ierr = CeedOperatorDestroy(&h->opsrestrict[l]); CeedChk(ierr);
+    ierr = CeedElemRestrictionDestroy(&h->rstrs[l]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&h->diags[l]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&h->mults[l]); CeedChk(ierr);
+  }
+  for (CeedInt b=0; b<h->numbases; b++) {
+    ierr = CeedBasisDestroy(&h->bases[b]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&h->degrees); CeedChk(ierr);
+  ierr = CeedFree(&h->ops); CeedChk(ierr);
+  ierr = CeedFree(&h->opsprolong); CeedChk(ierr);
+  ierr = CeedFree(&h->opsrestrict); CeedChk(ierr);
+  ierr = CeedFree(&h->rstrs); CeedChk(ierr);
+  ierr = CeedFree(&h->diags); CeedChk(ierr);
+  ierr = CeedFree(&h->mults); CeedChk(ierr);
+  ierr = CeedFree(&h->bases); CeedChk(ierr);
+  ierr = CeedFree(hierarchy); CeedChk(ierr);
+  return 0;
+}
+
 /// @}
@@ -180,6 +180,13 @@ int CeedQFunctionContextSetData(CeedQFunctionContext ctx, CeedMemType mtype,
                      "access lock is already in use");
   // LCOV_EXCL_STOP
 
+  if (ctx->numreaders > 0)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1,
+                     "Cannot grant CeedQFunctionContext data access, a "
+                     "process has read access");
+  // LCOV_EXCL_STOP
+
   ctx->ctxsize = size;
   ierr = ctx->SetData(ctx, mtype, cmode, data); CeedChk(ierr);
   ctx->state += 2;
@@ -220,6 +227,13 @@ int CeedQFunctionContextGetData(CeedQFunctionContext ctx, CeedMemType mtype,
                      "access lock is already in use");
   // LCOV_EXCL_STOP
 
+  if (ctx->numreaders > 0)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1,
+                     "Cannot grant CeedQFunctionContext data access, a "
+                     "process has read access");
+  // LCOV_EXCL_STOP
+
   ierr = ctx->GetData(ctx, mtype, data); CeedChk(ierr);
   ctx->state += 1;
 
@@ -258,6 +272,61 @@ int CeedQFunctionContextRestoreData(CeedQFunctionContext ctx, void *data) {
   return 0;
 }
 
+/**
+  @brief Get read-only access to a CeedQFunctionContext via the specified memory
+           type. Restore access with @ref CeedQFunctionContextRestoreDataRead().
+
+  Any number of readers may hold access at the same time, so this is the access
+    used by backends when applying a CeedQFunction.
+
+  @param ctx        CeedQFunctionContext to access
+  @param mtype      Memory type on which to access the data. If the backend
+                    uses a different memory type, this will perform a copy.
+  @param[out] data  Data on memory type mtype
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextGetDataRead(CeedQFunctionContext ctx,
+                                    CeedMemType mtype, void *data) {
+  int ierr;
+
+  if (!ctx->GetData)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1, "Backend does not support GetData");
+  // LCOV_EXCL_STOP
+
+  if (ctx->state % 2 == 1)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1,
+                     "Cannot grant CeedQFunctionContext read-only data "
+                     "access, the access lock is already in use");
+  // LCOV_EXCL_STOP
+
+  ierr = ctx->GetData(ctx, mtype, data); CeedChk(ierr);
+  CeedAtomicAdd(ctx->numreaders, 1);
+
+  return 0;
+}
+
+/**
+  @brief Restore data obtained using @ref CeedQFunctionContextGetDataRead()
+
+  @param ctx     CeedQFunctionContext to restore
+  @param data    Data to restore
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextRestoreDataRead(CeedQFunctionContext ctx, void *data) {
+  *(void **)data = NULL;
+  CeedAtomicAdd(ctx->numreaders, -1);
+
+  return 0;
+}
+
 /**
   @brief View a CeedQFunctionContext
 
@@ -295,6 +364,12 @@ int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx) {
                      "Cannot destroy CeedQFunctionContext, the access "
                      "lock is in use");
   // LCOV_EXCL_STOP
+  if ((*ctx)->numreaders > 0)
+    // LCOV_EXCL_START
+    return CeedError((*ctx)->ceed, 1,
+                     "Cannot destroy CeedQFunctionContext, a process has "
+                     "read access");
+  // LCOV_EXCL_STOP
 
   if ((*ctx)->Destroy) {
     ierr = (*ctx)->Destroy(*ctx); CeedChk(ierr);
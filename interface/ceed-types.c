@@ -55,3 +55,15 @@ const char *const CeedElemTopologies[] = {
   [CEED_PRISM] = "prism",
   [CEED_HEX] = "hexahedron",
 };
+
+const char *const CeedScalarTypes[] = {
+  [CEED_SCALAR_FP32] = "single precision",
+  [CEED_SCALAR_FP64] = "double precision",
+  [CEED_SCALAR_BF16] = "bfloat16",
+};
+
+const char *const CeedMultigridCoarsenModes[] = {
+  [CEED_MULTIGRID_COARSEN_HALF] = "halve degree",
+  [CEED_MULTIGRID_COARSEN_LINEAR] = "linear",
+  [CEED_MULTIGRID_COARSEN_USER] = "user degrees",
+};
@@ -121,6 +121,30 @@ int CeedVectorSetData(CeedVector vec, void *data) {
   return 0;
 }
 
+/**
+  @brief Get the memory held by a CeedVector
+
+  Backends report the arrays they allocated for the vector, on the host and
+    on devices; arrays given with @ref CEED_USE_POINTER are not counted.
+    Backends without this query report no memory.
+
+  @param vec         CeedVector, or NULL for a vector not yet created
+  @param[out] bytes  Number of bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedVectorGetMemoryUsage(CeedVector vec, CeedSize *bytes) {
+  int ierr;
+
+  *bytes = 0;
+  if (vec && vec->GetMemoryUsage) {
+    ierr = vec->GetMemoryUsage(vec, bytes); CeedChk(ierr);
+  }
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -141,7 +165,7 @@ int CeedVectorSetData(CeedVector vec, void *data) {
 
   @ref User
 **/
-int CeedVectorCreate(Ceed ceed, CeedInt length, CeedVector *vec) {
+int CeedVectorCreate(Ceed ceed, CeedSize length, CeedVector *vec) {
   int ierr;
 
   if (!ceed->VectorCreate) {
@@ -228,7 +252,7 @@ int CeedVectorSetValue(CeedVector vec, CeedScalar value) {
   } else {
     CeedScalar *array;
     ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
-    for (int i=0; i<vec->length; i++) array[i] = value;
+    for (CeedSize i=0; i<vec->length; i++) array[i] = value;
     ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
   }
 
@@ -372,7 +396,7 @@ int CeedVectorGetArrayRead(CeedVector vec, CeedMemType mtype,
                      "access, the access lock is already in use");
 
   ierr = vec->GetArrayRead(vec, mtype, array); CeedChk(ierr);
-  vec->numreaders++;
+  CeedAtomicAdd(vec->numreaders, 1);
 
   return 0;
 }
@@ -426,7 +450,7 @@ int CeedVectorRestoreArrayRead(CeedVector vec, const CeedScalar **array) {
 
   ierr = vec->RestoreArrayRead(vec); CeedChk(ierr);
   *array = NULL;
-  vec->numreaders--;
+  CeedAtomicAdd(vec->numreaders, -1);
 
   return 0;
 }
@@ -461,17 +485,17 @@ int CeedVectorNorm(CeedVector vec, CeedNormType type, CeedScalar *norm) {
   *norm = 0.;
   switch (type) {
   case CEED_NORM_1:
-    for (int i=0; i<vec->length; i++) {
+    for (CeedSize i=0; i<vec->length; i++) {
       *norm += fabs(array[i]);
     }
     break;
   case CEED_NORM_2:
-    for (int i=0; i<vec->length; i++) {
+    for (CeedSize i=0; i<vec->length; i++) {
       *norm += fabs(array[i])*fabs(array[i]);
     }
     break;
   case CEED_NORM_MAX:
-    for (int i=0; i<vec->length; i++) {
+    for (CeedSize i=0; i<vec->length; i++) {
       const CeedScalar absi = fabs(array[i]);
       *norm = *norm > absi ? *norm : absi;
     }
@@ -509,11 +533,11 @@ int CeedVectorReciprocal(CeedVector vec) {
     return 0;
   }
 
-  CeedInt len;
+  CeedSize len;
   ierr = CeedVectorGetLength(vec, &len); CeedChk(ierr);
   CeedScalar *array;
   ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
-  for (CeedInt i=0; i<len; i++)
+  for (CeedSize i=0; i<len; i++)
     if (fabs(array[i]) > CEED_EPSILON)
       array[i] = 1./array[i];
   ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
@@ -540,7 +564,7 @@ int CeedVectorView(CeedVector vec, const char *fpfmt, FILE *stream) {
   char fmt[1024];
   fprintf(stream, "CeedVector length %ld\n", (long)vec->length);
   snprintf(fmt, sizeof fmt, "  %s\n", fpfmt ? fpfmt : "%g");
-  for (CeedInt i=0; i<vec->length; i++)
+  for (CeedSize i=0; i<vec->length; i++)
     fprintf(stream, fmt, x[i]);
 
   ierr = CeedVectorRestoreArrayRead(vec, &x); CeedChk(ierr);
@@ -558,7 +582,7 @@ int CeedVectorView(CeedVector vec, const char *fpfmt, FILE *stream) {
 
   @ref User
 **/
-int CeedVectorGetLength(CeedVector vec, CeedInt *length) {
+int CeedVectorGetLength(CeedVector vec, CeedSize *length) {
   *length = vec->length;
   return 0;
 }
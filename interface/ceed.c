@@ -587,6 +587,95 @@ int CeedSetData(Ceed ceed, void *data) {
   return 0;
 }
 
+/**
+  @brief Get the root of a resource, dropping any options. Resource options
+           follow a '?' and are separated by ':', as in
+           "/cpu/self/opt/blocked?blksize=16".
+
+  @param ceed               Ceed context, for error handling
+  @param resource           Full resource
+  @param[out] resourceroot  Variable to store the resource root, such as
+                              "/cpu/self/opt/blocked"; free with CeedFree()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetResourceRoot(Ceed ceed, const char *resource, char **resourceroot) {
+  int ierr;
+  const char *options = strchr(resource, '?');
+  size_t len = options ? (size_t)(options - resource) : strlen(resource);
+  ierr = CeedCalloc(len+1, resourceroot); CeedChk(ierr);
+  memcpy(*resourceroot, resource, len);
+  return 0;
+}
+
+/**
+  @brief Get the value of an option of a resource, as in "blksize" for
+           "/cpu/self/opt/blocked?blksize=16"
+
+  @param ceed        Ceed context, for error handling
+  @param resource    Full resource
+  @param key         Option name
+  @param[out] value  Variable to store a copy of the option value, or NULL if
+                       the resource does not set the option; free with
+                       CeedFree()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetResourceOption(Ceed ceed, const char *resource, const char *key,
+                          char **value) {
+  int ierr;
+  const size_t keylen = strlen(key);
+  *value = NULL;
+  for (const char *option = strchr(resource, '?'); option;
+       option = strchr(option, ':')) {
+    option++;
+    const char *end = strchr(option, ':');
+    size_t len = end ? (size_t)(end - option) : strlen(option);
+    if (len > keylen && !strncmp(option, key, keylen) && option[keylen] == '=') {
+      ierr = CeedCalloc(len - keylen, value); CeedChk(ierr);
+      memcpy(*value, option + keylen + 1, len - keylen - 1);
+      return 0;
+    }
+  }
+  return 0;
+}
+
+/**
+  @brief Initialize a delegate Ceed context, passing on the options of the
+           parent resource. With parent resource "/cpu/self?blksize=16",
+           the delegate resource "/cpu/self/opt/blocked" is initialized as
+           "/cpu/self/opt/blocked?blksize=16".
+
+  @param resource        Delegate resource root
+  @param parentresource  Full resource of the parent Ceed context
+  @param[out] ceed       The address of the variable where the newly created
+                           Ceed context will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedInitDelegate(const char *resource, const char *parentresource,
+                     Ceed *ceed) {
+  int ierr;
+  const char *options = strchr(parentresource, '?');
+  if (!options)
+    return CeedInit(resource, ceed);
+
+  size_t len = strlen(resource), optlen = strlen(options);
+  char *delegateresource;
+  ierr = CeedCalloc(len + optlen + 1, &delegateresource); CeedChk(ierr);
+  memcpy(delegateresource, resource, len);
+  memcpy(delegateresource + len, options, optlen);
+  ierr = CeedInit(delegateresource, ceed); CeedChk(ierr);
+  ierr = CeedFree(&delegateresource); CeedChk(ierr);
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -656,8 +745,11 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(Ceed, VectorCreate),
     CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreate),
     CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateBlocked),
+    CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreate64),
+    CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateBlocked64),
     CEED_FTABLE_ENTRY(Ceed, BasisCreateTensorH1),
     CEED_FTABLE_ENTRY(Ceed, BasisCreateH1),
+    CEED_FTABLE_ENTRY(Ceed, BasisCreateCollapsed),
     CEED_FTABLE_ENTRY(Ceed, TensorContractCreate),
     CEED_FTABLE_ENTRY(Ceed, QFunctionCreate),
     CEED_FTABLE_ENTRY(Ceed, QFunctionContextCreate),
@@ -672,12 +764,19 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(CeedVector, RestoreArrayRead),
     CEED_FTABLE_ENTRY(CeedVector, Norm),
     CEED_FTABLE_ENTRY(CeedVector, Reciprocal),
+    CEED_FTABLE_ENTRY(CeedVector, GetMemoryUsage),
     CEED_FTABLE_ENTRY(CeedVector, Destroy),
     CEED_FTABLE_ENTRY(CeedElemRestriction, Apply),
     CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyBlock),
     CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets),
+    CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets64),
+    CEED_FTABLE_ENTRY(CeedElemRestriction, GetColoring),
+    CEED_FTABLE_ENTRY(CeedElemRestriction, GetMultiplicity),
+    CEED_FTABLE_ENTRY(CeedElemRestriction, GetMemoryUsage),
     CEED_FTABLE_ENTRY(CeedElemRestriction, Destroy),
     CEED_FTABLE_ENTRY(CeedBasis, Apply),
+    CEED_FTABLE_ENTRY(CeedBasis, ApplyInterpGrad),
+    CEED_FTABLE_ENTRY(CeedBasis, GetMemoryUsage),
     CEED_FTABLE_ENTRY(CeedBasis, Destroy),
     CEED_FTABLE_ENTRY(CeedTensorContract, Apply),
     CEED_FTABLE_ENTRY(CeedTensorContract, Destroy),
@@ -694,12 +793,22 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleAddDiagonal),
     CEED_FTABLE_ENTRY(CeedOperator, LinearAssemblePointBlockDiagonal),
     CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleAddPointBlockDiagonal),
+    CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleSymbolic),
+    CEED_FTABLE_ENTRY(CeedOperator, LinearAssemble),
+    CEED_FTABLE_ENTRY(CeedOperator, AssembleElementMatrices),
     CEED_FTABLE_ENTRY(CeedOperator, CreateFDMElementInverse),
+    CEED_FTABLE_ENTRY(CeedOperator, CreateElementBlockJacobiInverse),
+    CEED_FTABLE_ENTRY(CeedOperator, Setup),
     CEED_FTABLE_ENTRY(CeedOperator, Apply),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyComposite),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyAdd),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyAddComposite),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyJacobian),
+    CEED_FTABLE_ENTRY(CeedOperator, ApplyChebyshevStep),
+    CEED_FTABLE_ENTRY(CeedOperator, GetMemoryUsage),
+    CEED_FTABLE_ENTRY(CeedOperator, WorkspaceCreate),
+    CEED_FTABLE_ENTRY(CeedOperator, WorkspaceApplyAdd),
+    CEED_FTABLE_ENTRY(CeedOperator, WorkspaceDestroy),
     CEED_FTABLE_ENTRY(CeedOperator, Destroy),
     {NULL, 0} // End of lookup table - used in SetBackendFunction loop
   };
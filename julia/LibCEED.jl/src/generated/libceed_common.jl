@@ -8,6 +8,7 @@ const FILE = Cvoid
 # Skipping MacroDefinition: CeedError ( ceed , ecode , ... ) ( CeedErrorImpl ( ( ceed ) , __FILE__ , __LINE__ , __func__ , ( ecode ) , __VA_ARGS__ ) ? : ( ecode ) )
 
 const CeedInt = Int32
+const CeedSize = Cptrdiff_t
 const CeedScalar = Cdouble
 const Ceed_private = Cvoid
 const Ceed = Ptr{Ceed_private}
@@ -117,7 +117,7 @@ impl ElemRestriction {
             i32::try_from(elemsize).unwrap(),
             i32::try_from(ncomp).unwrap(),
             i32::try_from(compstride).unwrap(),
-            i32::try_from(lsize).unwrap(),
+            bind_ceed::CeedSize::try_from(lsize).unwrap(),
             mtype as bind_ceed::CeedMemType,
         );
         unsafe {
@@ -150,7 +150,7 @@ impl ElemRestriction {
             i32::try_from(nelem).unwrap(),
             i32::try_from(elemsize).unwrap(),
             i32::try_from(ncomp).unwrap(),
-            i32::try_from(lsize).unwrap(),
+            bind_ceed::CeedSize::try_from(lsize).unwrap(),
         );
         unsafe {
             bind_ceed::CeedElemRestrictionCreateStrided(
@@ -116,7 +116,7 @@ impl fmt::Display for Vector {
 impl Vector {
     // Constructors
     pub fn create(ceed: &crate::Ceed, n: usize) -> Self {
-        let n = i32::try_from(n).unwrap();
+        let n = bind_ceed::CeedSize::try_from(n).unwrap();
         let mut ptr = std::ptr::null_mut();
         unsafe { bind_ceed::CeedVectorCreate(ceed.ptr, n, &mut ptr) };
         Self { ptr: ptr }
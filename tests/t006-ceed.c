@@ -0,0 +1,45 @@
+/// @file
+/// Test parsing of CEED resource options
+/// \test Test parsing of CEED resource options
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const char *resource = "/cpu/self/opt/blocked?blksize=16:mode=fast";
+  char *root, *value;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedGetResourceRoot(ceed, resource, &root);
+  if (strcmp(root, "/cpu/self/opt/blocked"))
+    // LCOV_EXCL_START
+    printf("Incorrect resource root: %s\n", root);
+  // LCOV_EXCL_STOP
+  free(root);
+
+  CeedGetResourceOption(ceed, resource, "blksize", &value);
+  if (!value || strcmp(value, "16"))
+    // LCOV_EXCL_START
+    printf("Incorrect blksize option: %s\n", value ? value : "(null)");
+  // LCOV_EXCL_STOP
+  free(value);
+
+  CeedGetResourceOption(ceed, resource, "mode", &value);
+  if (!value || strcmp(value, "fast"))
+    // LCOV_EXCL_START
+    printf("Incorrect mode option: %s\n", value ? value : "(null)");
+  // LCOV_EXCL_STOP
+  free(value);
+
+  CeedGetResourceOption(ceed, resource, "blk", &value);
+  if (value)
+    // LCOV_EXCL_START
+    printf("Unexpected blk option: %s\n", value);
+  // LCOV_EXCL_STOP
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,29 @@
+!-----------------------------------------------------------------------
+      program test
+      implicit none
+      include 'ceedf.h'
+
+      integer ceed,err
+      integer x
+      integer*8 n
+      character arg*32
+
+      call getarg(1,arg)
+
+      call ceedinit(trim(arg)//char(0),ceed,err)
+
+! Vector storage is only allocated on first access
+      n=2147483657_8
+
+      call ceedvectorcreate64(ceed,n,x,err)
+      if (err/=0) then
+! LCOV_EXCL_START
+        write(*,*) 'Error creating vector of length ',n
+! LCOV_EXCL_STOP
+      endif
+
+      call ceedvectordestroy(x,err)
+      call ceeddestroy(ceed,err)
+
+      end
+!-----------------------------------------------------------------------
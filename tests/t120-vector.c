@@ -0,0 +1,142 @@
+/// @file
+/// Test CeedVector and CeedElemRestriction sizes beyond the range of CeedInt
+/// \test Test CeedVector and CeedElemRestriction sizes beyond the range of CeedInt
+#define _DEFAULT_SOURCE
+#include <ceed.h>
+#include <stdint.h>
+#include <sys/mman.h>
+
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y;
+  CeedElemRestriction r;
+  CeedSize n = (CeedSize)INT32_MAX + 10, len, lsize;
+  CeedInt ind[2] = {0, INT32_MAX}, indcomp[2] = {0, 1},
+          strides[3] = {1, 2, INT32_MAX};
+  const CeedSize last = (CeedSize)INT32_MAX + 1, ind64[2] = {1, last};
+  const CeedScalar *yy;
+  CeedScalar *xx;
+
+  CeedInit(argv[1], &ceed);
+
+  // Vector storage is only allocated on first access
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorGetLength(x, &len);
+  if (len != n)
+    // LCOV_EXCL_START
+    printf("Incorrect vector length %ld != %ld\n", (long)len, (long)n);
+  // LCOV_EXCL_STOP
+  CeedVectorDestroy(&x);
+
+  // Offset restrictions refuse components reaching past the L-vector
+  CeedSetErrorHandler(ceed, CeedErrorStore);
+  if (!CeedElemRestrictionCreate(ceed, 1, 2, 2, 11, n, CEED_MEM_HOST,
+                                 CEED_USE_POINTER, ind, &r))
+    // LCOV_EXCL_START
+    printf("Offset restriction accepted entries past L-vector size %ld\n",
+           (long)n);
+  // LCOV_EXCL_STOP
+  if (!CeedElemRestrictionCreateBlocked(ceed, 1, 2, 4, 2, 11, n, CEED_MEM_HOST,
+                                        CEED_USE_POINTER, ind, &r))
+    // LCOV_EXCL_START
+    printf("Blocked offset restriction accepted entries past L-vector size "
+           "%ld\n", (long)n);
+  // LCOV_EXCL_STOP
+  const char *errmsg;
+  CeedResetErrorMessage(ceed, &errmsg);
+  CeedSetErrorHandler(ceed, CeedErrorAbort);
+
+  // Only the pages around the two elements are ever touched
+  xx = mmap(NULL, n*sizeof(CeedScalar), PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (xx == MAP_FAILED)
+    // LCOV_EXCL_START
+    return 0;
+  // LCOV_EXCL_STOP
+  for (CeedInt i=0; i<2; i++) {
+    xx[i] = 1 + i;
+    xx[last-1+i] = 3 + i;
+  }
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, xx);
+  CeedVectorCreate(ceed, 4, &y);
+
+  // The second element straddles index 2^31
+  CeedElemRestrictionCreateStrided(ceed, 2, 2, 1, n, strides, &r);
+  CeedElemRestrictionGetLVectorSize(r, &lsize);
+  if (lsize != n)
+    // LCOV_EXCL_START
+    printf("Incorrect L-vector size %ld != %ld\n", (long)lsize, (long)n);
+  // LCOV_EXCL_STOP
+
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yy);
+  for (CeedInt i=0; i<4; i++)
+    if (yy[i] != 1 + i)
+      // LCOV_EXCL_START
+      printf("Error in restricted array y[%d] = %f\n", i, (double)yy[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(y, &yy);
+
+  // The transpose adds the element values back into the L-vector
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, y, x, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArray(x, CEED_MEM_HOST, &xx);
+  for (CeedInt i=0; i<2; i++)
+    if (xx[i] != 2*(1 + i) || xx[last-1+i] != 2*(3 + i))
+      // LCOV_EXCL_START
+      printf("Error in transpose at node %d: %f, %f\n", i, (double)xx[i],
+             (double)xx[last-1+i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArray(x, &xx);
+  CeedElemRestrictionDestroy(&r);
+
+  // 32-bit offsets reach past 2^31 through the component stride
+  CeedElemRestrictionCreate(ceed, 1, 2, 2, INT32_MAX, n, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indcomp, &r);
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yy);
+  for (CeedInt i=0; i<4; i++)
+    if (yy[i] != 2*(1 + i))
+      // LCOV_EXCL_START
+      printf("Error in offset restricted array y[%d] = %f\n", i,
+             (double)yy[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(y, &yy);
+  CeedElemRestrictionDestroy(&r);
+
+  // 64-bit offsets address nodes past 2^31 directly
+  CeedVectorDestroy(&y);
+  CeedVectorCreate(ceed, 2, &y);
+  CeedElemRestrictionCreate64(ceed, 1, 2, 1, 1, n, CEED_MEM_HOST,
+                              CEED_USE_POINTER, ind64, &r);
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yy);
+  for (CeedInt i=0; i<2; i++)
+    if (yy[i] != 4*(1 + i))
+      // LCOV_EXCL_START
+      printf("Error in 64-bit restricted array y[%d] = %f\n", i,
+             (double)yy[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(y, &yy);
+
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, y, x, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArray(x, CEED_MEM_HOST, &xx);
+  if (xx[1] != 8 || xx[last] != 16)
+    // LCOV_EXCL_START
+    printf("Error in 64-bit transpose: %f, %f\n", (double)xx[1],
+           (double)xx[last]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArray(x, &xx);
+
+  CeedVectorTakeArray(x, CEED_MEM_HOST, &xx);
+  munmap(xx, n*sizeof(CeedScalar));
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedElemRestrictionDestroy(&r);
+  CeedDestroy(&ceed);
+  return 0;
+}
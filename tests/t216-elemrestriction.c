@@ -0,0 +1,76 @@
+/// @file
+/// Test element restriction coloring
+/// \test Test element restriction coloring
+#include <ceed-backend.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+static void CheckColoring(CeedElemRestriction r, CeedInt ne, CeedInt elemsize,
+                          CeedInt blksize, const CeedInt *ind) {
+  CeedInt numcolors, nblk = (ne + blksize - 1) / blksize;
+  const CeedInt *coloroffsets, *colorblks;
+  bool seen[nblk];
+
+  CeedElemRestrictionGetColoring(r, &numcolors, &coloroffsets, &colorblks);
+  if (numcolors < 2 || coloroffsets[0] != 0 || coloroffsets[numcolors] != nblk)
+    // LCOV_EXCL_START
+    printf("Invalid coloring with %d colors\n", numcolors);
+  // LCOV_EXCL_STOP
+
+  for (CeedInt b=0; b<nblk; b++)
+    seen[b] = false;
+  for (CeedInt c=0; c<numcolors; c++)
+    for (CeedInt i=coloroffsets[c]; i<coloroffsets[c+1]; i++) {
+      CeedInt b1 = colorblks[i];
+      if (seen[b1])
+        // LCOV_EXCL_START
+        printf("Block %d listed twice\n", b1);
+      // LCOV_EXCL_STOP
+      seen[b1] = true;
+      // No two blocks of one color may share a node
+      for (CeedInt j=coloroffsets[c]; j<i; j++) {
+        CeedInt b2 = colorblks[j];
+        for (CeedInt e1=b1*blksize; e1<ne && e1<(b1+1)*blksize; e1++)
+          for (CeedInt e2=b2*blksize; e2<ne && e2<(b2+1)*blksize; e2++)
+            for (CeedInt k1=0; k1<elemsize; k1++)
+              for (CeedInt k2=0; k2<elemsize; k2++)
+                if (ind[e1*elemsize+k1] == ind[e2*elemsize+k2])
+                  // LCOV_EXCL_START
+                  printf("Blocks %d and %d share node %d in color %d\n",
+                         b1, b2, ind[e1*elemsize+k1], c);
+              // LCOV_EXCL_STOP
+      }
+    }
+  for (CeedInt b=0; b<nblk; b++)
+    if (!seen[b])
+      // LCOV_EXCL_START
+      printf("Block %d missing from coloring\n", b);
+  // LCOV_EXCL_STOP
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedInt ne = 10, elemsize = 3, blksize = 3;
+  CeedInt ind[elemsize*ne];
+  CeedElemRestriction r, rblk;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<ne; i++)
+    for (CeedInt k=0; k<elemsize; k++)
+      ind[elemsize*i+k] = i*(elemsize-1) + k;
+  CeedElemRestrictionCreate(ceed, ne, elemsize, 2, ne*(elemsize-1)+1,
+                            2*(ne*(elemsize-1)+1), CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind, &r);
+  CeedElemRestrictionCreateBlocked(ceed, ne, elemsize, blksize, 1, 1,
+                                   ne*(elemsize-1)+1, CEED_MEM_HOST,
+                                   CEED_USE_POINTER, ind, &rblk);
+
+  CheckColoring(r, ne, elemsize, 1, ind);
+  CheckColoring(rblk, ne, elemsize, blksize, ind);
+
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&rblk);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,55 @@
+/// @file
+/// Test interpolation and gradient of many elements in one call
+/// \test Test interpolation and gradient of many elements in one call
+#include <ceed.h>
+#include <math.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector U, Uq, Gq;
+  CeedBasis b;
+  const CeedInt dim = 3, ncomp = 2, P = 5, Q = 7, nelem = 1024;
+  const CeedInt lsize = nelem*ncomp*CeedIntPow(P, dim),
+                qsize = nelem*ncomp*CeedIntPow(Q, dim);
+  const CeedScalar *uq, *gq;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, lsize, &U);
+  CeedVectorSetValue(U, 1.0);
+  CeedVectorCreate(ceed, qsize, &Uq);
+  CeedVectorCreate(ceed, dim*qsize, &Gq);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, P, Q, CEED_GAUSS, &b);
+
+  // Large batches must not be limited by the stack size
+  CeedBasisApply(b, nelem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, Uq);
+  CeedBasisApply(b, nelem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U, Gq);
+
+  CeedVectorGetArrayRead(Uq, CEED_MEM_HOST, &uq);
+  for (CeedInt i=0; i<qsize; i++)
+    if (fabs(uq[i] - 1.0) > 1e-12) {
+      // LCOV_EXCL_START
+      printf("Interpolated value %f != 1.0 at %d\n", uq[i], i);
+      break;
+      // LCOV_EXCL_STOP
+    }
+  CeedVectorRestoreArrayRead(Uq, &uq);
+
+  CeedVectorGetArrayRead(Gq, CEED_MEM_HOST, &gq);
+  for (CeedInt i=0; i<dim*qsize; i++)
+    if (fabs(gq[i]) > 1e-11) {
+      // LCOV_EXCL_START
+      printf("Gradient value %f != 0.0 at %d\n", gq[i], i);
+      break;
+      // LCOV_EXCL_STOP
+    }
+  CeedVectorRestoreArrayRead(Gq, &gq);
+
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&Uq);
+  CeedVectorDestroy(&Gq);
+  CeedBasisDestroy(&b);
+  CeedDestroy(&ceed);
+  return 0;
+}
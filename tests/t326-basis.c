@@ -0,0 +1,103 @@
+/// @file
+/// Test interp and grad with large non-tensor H1 bases against the reference
+/// \test Test interp and grad with large non-tensor H1 bases against the reference
+#include <ceed.h>
+#include <math.h>
+
+// Apply a basis in both directions and for both evaluation modes, storing the
+//   concatenated results in out
+static void apply_basis(Ceed ceed, CeedInt P, CeedInt Q, CeedInt ncomp,
+                        CeedInt nelem, CeedScalar *out) {
+  const CeedInt dim = 3, lsize = nelem*ncomp*P, qsize = nelem*ncomp*Q;
+  CeedScalar interp[P*Q], grad[dim*P*Q], qref[dim*Q], qweight[Q];
+  CeedBasis b;
+  CeedVector U, Uq, G;
+  const CeedScalar *v;
+
+  for (CeedInt i=0; i<P*Q; i++)
+    interp[i] = sin(i);
+  for (CeedInt i=0; i<dim*P*Q; i++)
+    grad[i] = cos(i);
+  for (CeedInt i=0; i<dim*Q; i++)
+    qref[i] = 0.0;
+  for (CeedInt i=0; i<Q; i++)
+    qweight[i] = 1.0;
+  CeedBasisCreateH1(ceed, CEED_TET, ncomp, P, Q, interp, grad, qref, qweight,
+                    &b);
+
+  CeedVectorCreate(ceed, lsize, &U);
+  CeedVectorCreate(ceed, qsize, &Uq);
+  CeedVectorCreate(ceed, dim*qsize, &G);
+  CeedScalar *u;
+  CeedVectorGetArray(U, CEED_MEM_HOST, &u);
+  for (CeedInt i=0; i<lsize; i++)
+    u[i] = 1.0 + sin(3*i);
+  CeedVectorRestoreArray(U, &u);
+
+  CeedBasisApply(b, nelem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, Uq);
+  CeedVectorGetArrayRead(Uq, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<qsize; i++)
+    out[i] = v[i];
+  CeedVectorRestoreArrayRead(Uq, &v);
+  out += qsize;
+
+  CeedBasisApply(b, nelem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U, G);
+  CeedVectorGetArrayRead(G, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<dim*qsize; i++)
+    out[i] = v[i];
+  CeedVectorRestoreArrayRead(G, &v);
+  out += dim*qsize;
+
+  CeedBasisApply(b, nelem, CEED_TRANSPOSE, CEED_EVAL_INTERP, Uq, U);
+  CeedVectorGetArrayRead(U, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<lsize; i++)
+    out[i] = v[i];
+  CeedVectorRestoreArrayRead(U, &v);
+  out += lsize;
+
+  CeedBasisApply(b, nelem, CEED_TRANSPOSE, CEED_EVAL_GRAD, G, U);
+  CeedVectorGetArrayRead(U, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<lsize; i++)
+    out[i] = v[i];
+  CeedVectorRestoreArrayRead(U, &v);
+
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&Uq);
+  CeedVectorDestroy(&G);
+  CeedBasisDestroy(&b);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed, ceedref;
+  // Shapes with and without remainders in both matrix dimensions, for a
+  //   single element and for blocks of elements
+  const CeedInt ncases = 6;
+  const CeedInt shapes[6][4] = {{20, 24, 1, 1}, {35, 45, 3, 1}, {10, 11, 1, 1},
+    {20, 24, 1, 8}, {35, 45, 2, 16}, {17, 19, 1, 8}
+  };
+
+  CeedInit(argv[1], &ceed);
+  CeedInit("/cpu/self/ref/serial", &ceedref);
+
+  for (CeedInt k=0; k<ncases; k++) {
+    const CeedInt P = shapes[k][0], Q = shapes[k][1], ncomp = shapes[k][2],
+                  nelem = shapes[k][3];
+    const CeedInt size = nelem*ncomp*(4*Q + 2*P);
+    CeedScalar out[size], outref[size];
+
+    apply_basis(ceed, P, Q, ncomp, nelem, out);
+    apply_basis(ceedref, P, Q, ncomp, nelem, outref);
+    for (CeedInt i=0; i<size; i++)
+      if (fabs(out[i] - outref[i]) > 1e-10*(1.0 + fabs(outref[i]))) {
+        // LCOV_EXCL_START
+        printf("P=%d Q=%d ncomp=%d nelem=%d [%d] %f != %f\n", P, Q, ncomp,
+               nelem, i, out[i], outref[i]);
+        break;
+        // LCOV_EXCL_STOP
+      }
+  }
+
+  CeedDestroy(&ceed);
+  CeedDestroy(&ceedref);
+  return 0;
+}
@@ -0,0 +1,156 @@
+/// @file
+/// Test orthonormality and gradients of collapsed coordinate simplex bases
+/// \test Test orthonormality and gradients of collapsed simplex bases
+#include <ceed.h>
+#include <math.h>
+
+static CeedScalar Eval(CeedInt c, const CeedScalar *x, CeedInt dim) {
+  const CeedScalar z = dim == 3 ? x[2] : 0.;
+  return c ? 1. - 2.*x[0]*x[1] + z*z : x[0]*x[1]*x[1] + x[0]*x[0] - x[1]*z;
+}
+
+static void EvalGrad(CeedInt c, const CeedScalar *x, CeedInt dim,
+                     CeedScalar *grad) {
+  const CeedScalar z = dim == 3 ? x[2] : 0.;
+  if (c) {
+    grad[0] = -2.*x[1]; grad[1] = -2.*x[0]; grad[2] = 2.*z;
+  } else {
+    grad[0] = x[1]*x[1] + 2.*x[0]; grad[1] = 2.*x[0]*x[1] - z;
+    grad[2] = -x[1];
+  }
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedElemTopology topos[2] = {CEED_TRIANGLE, CEED_TET};
+  const CeedInt degree = 3, Q1d = degree + 2, ncomp = 2;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt t=0; t<2; t++) {
+    const CeedInt dim = t + 2;
+    CeedBasis b, bmass;
+    CeedVector U, Uq, W, Gq;
+    CeedInt P, Q;
+    const CeedScalar *qref, *u, *w, *gq;
+    CeedScalar *uq, *gqw;
+
+    // Orthonormality, applying the mass matrix to a batch of unit vectors
+    CeedBasisCreateSimplex(ceed, topos[t], 1, degree, Q1d, &bmass);
+    CeedBasisGetNumNodes(bmass, &P);
+    CeedBasisGetNumQuadraturePoints(bmass, &Q);
+    CeedVectorCreate(ceed, P*P, &U);
+    CeedVectorCreate(ceed, Q*P, &Uq);
+    CeedVectorCreate(ceed, Q*P, &W);
+    CeedVectorSetValue(U, 0.0);
+    CeedVectorGetArray(U, CEED_MEM_HOST, &uq);
+    for (CeedInt n=0; n<P; n++)
+      uq[n*P+n] = 1.0;
+    CeedVectorRestoreArray(U, &uq);
+    CeedBasisApply(bmass, P, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, Uq);
+    CeedBasisApply(bmass, P, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
+                   CEED_VECTOR_NONE, W);
+    CeedVectorGetArray(Uq, CEED_MEM_HOST, &uq);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &w);
+    for (CeedInt i=0; i<Q*P; i++)
+      uq[i] *= w[i];
+    CeedVectorRestoreArrayRead(W, &w);
+    CeedVectorRestoreArray(Uq, &uq);
+    CeedBasisApply(bmass, P, CEED_TRANSPOSE, CEED_EVAL_INTERP, Uq, U);
+    CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u);
+    for (CeedInt m=0; m<P; m++)
+      for (CeedInt n=0; n<P; n++)
+        if (fabs(u[m*P+n] - (m == n)) > 1e-12)
+          // LCOV_EXCL_START
+          printf("%dD mass matrix entry [%d, %d] = %f\n", dim, m, n, u[m*P+n]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(U, &u);
+    CeedVectorDestroy(&U);
+    CeedVectorDestroy(&Uq);
+    CeedVectorDestroy(&W);
+    CeedBasisDestroy(&bmass);
+
+    // L2 projection of polynomials of the basis degree is exact, as are their
+    //   gradients
+    CeedBasisCreateSimplex(ceed, topos[t], ncomp, degree, Q1d, &b);
+    CeedBasisGetQRef(b, &qref);
+    CeedVectorCreate(ceed, ncomp*P, &U);
+    CeedVectorCreate(ceed, ncomp*Q, &Uq);
+    CeedVectorCreate(ceed, Q, &W);
+    CeedVectorCreate(ceed, dim*ncomp*Q, &Gq);
+    CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE,
+                   W);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &w);
+    CeedVectorGetArray(Uq, CEED_MEM_HOST, &uq);
+    for (CeedInt c=0; c<ncomp; c++)
+      for (CeedInt q=0; q<Q; q++) {
+        CeedScalar x[3];
+        for (CeedInt d=0; d<dim; d++)
+          x[d] = qref[d*Q+q];
+        uq[c*Q+q] = w[q]*Eval(c, x, dim);
+      }
+    CeedVectorRestoreArray(Uq, &uq);
+    CeedVectorRestoreArrayRead(W, &w);
+    CeedBasisApply(b, 1, CEED_TRANSPOSE, CEED_EVAL_INTERP, Uq, U);
+    CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, Uq);
+    CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U, Gq);
+    CeedVectorGetArray(Uq, CEED_MEM_HOST, &uq);
+    CeedVectorGetArrayRead(Gq, CEED_MEM_HOST, &gq);
+    for (CeedInt c=0; c<ncomp; c++)
+      for (CeedInt q=0; q<Q; q++) {
+        CeedScalar x[3], grad[3];
+        for (CeedInt d=0; d<dim; d++)
+          x[d] = qref[d*Q+q];
+        if (fabs(uq[c*Q+q] - Eval(c, x, dim)) > 1e-12)
+          // LCOV_EXCL_START
+          printf("%dD value %f != %f\n", dim, uq[c*Q+q], Eval(c, x, dim));
+        // LCOV_EXCL_STOP
+        EvalGrad(c, x, dim, grad);
+        for (CeedInt d=0; d<dim; d++)
+          if (fabs(gq[(d*ncomp+c)*Q+q] - grad[d]) > 1e-11)
+            // LCOV_EXCL_START
+            printf("%dD derivative %d %f != %f\n", dim, d,
+                   gq[(d*ncomp+c)*Q+q], grad[d]);
+        // LCOV_EXCL_STOP
+      }
+    CeedVectorRestoreArrayRead(Gq, &gq);
+    CeedVectorRestoreArray(Uq, &uq);
+
+    // The transpose gradient is the adjoint of the gradient
+    CeedScalar ugq = 0., gtu = 0.;
+    CeedVectorGetArray(Gq, CEED_MEM_HOST, &gqw);
+    for (CeedInt i=0; i<dim*ncomp*Q; i++)
+      gqw[i] = sin(i + 1.);
+    CeedVectorRestoreArray(Gq, &gqw);
+    CeedVectorCreate(ceed, ncomp*P, &W);
+    CeedBasisApply(b, 1, CEED_TRANSPOSE, CEED_EVAL_GRAD, Gq, W);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &w);
+    CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u);
+    for (CeedInt i=0; i<ncomp*P; i++)
+      gtu += u[i]*w[i];
+    CeedVectorRestoreArrayRead(U, &u);
+    CeedVectorRestoreArrayRead(W, &w);
+    CeedVectorDestroy(&W);
+    CeedVectorCreate(ceed, dim*ncomp*Q, &W);
+    CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U, W);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &w);
+    CeedVectorGetArrayRead(Gq, CEED_MEM_HOST, &gq);
+    for (CeedInt i=0; i<dim*ncomp*Q; i++)
+      ugq += w[i]*gq[i];
+    CeedVectorRestoreArrayRead(Gq, &gq);
+    CeedVectorRestoreArrayRead(W, &w);
+    if (fabs(ugq - gtu) > 1e-10*fabs(ugq))
+      // LCOV_EXCL_START
+      printf("%dD gradient transpose %f != %f\n", dim, gtu, ugq);
+    // LCOV_EXCL_STOP
+
+    CeedVectorDestroy(&U);
+    CeedVectorDestroy(&Uq);
+    CeedVectorDestroy(&W);
+    CeedVectorDestroy(&Gq);
+    CeedBasisDestroy(&b);
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
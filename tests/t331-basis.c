@@ -0,0 +1,98 @@
+/// @file
+/// Test fused interpolation and gradient basis evaluation
+/// \test Test fused interpolation and gradient basis evaluation
+#include <ceed.h>
+#include <math.h>
+
+// Compare fused evaluation against separate interpolation and gradient
+static void CheckFused(Ceed ceed, CeedBasis b, CeedInt nelem) {
+  CeedInt dim, ncomp, P, Q;
+  CeedVector U, Vi, Vg, Vf;
+  const CeedScalar *vi, *vg, *vf;
+  CeedScalar *u;
+
+  CeedBasisGetDimension(b, &dim);
+  CeedBasisGetNumComponents(b, &ncomp);
+  CeedBasisGetNumNodes(b, &P);
+  CeedBasisGetNumQuadraturePoints(b, &Q);
+  CeedVectorCreate(ceed, nelem*ncomp*P, &U);
+  CeedVectorCreate(ceed, nelem*ncomp*Q, &Vi);
+  CeedVectorCreate(ceed, nelem*dim*ncomp*Q, &Vg);
+  CeedVectorCreate(ceed, nelem*(dim+1)*ncomp*Q, &Vf);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &u);
+  for (CeedInt i=0; i<nelem*ncomp*P; i++)
+    u[i] = sin(1.3*i + 0.2);
+  CeedVectorRestoreArray(U, &u);
+
+  CeedBasisApply(b, nelem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, Vi);
+  CeedBasisApply(b, nelem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U, Vg);
+  CeedBasisApply(b, nelem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP | CEED_EVAL_GRAD,
+                 U, Vf);
+
+  CeedVectorGetArrayRead(Vi, CEED_MEM_HOST, &vi);
+  CeedVectorGetArrayRead(Vg, CEED_MEM_HOST, &vg);
+  CeedVectorGetArrayRead(Vf, CEED_MEM_HOST, &vf);
+  for (CeedInt i=0; i<nelem*ncomp*Q; i++)
+    if (fabs(vf[i] - vi[i]) > 1e-12) {
+      // LCOV_EXCL_START
+      printf("[%d] Fused interp %f != %f\n", i, vf[i], vi[i]);
+      // LCOV_EXCL_STOP
+    }
+  for (CeedInt i=0; i<nelem*dim*ncomp*Q; i++)
+    if (fabs(vf[nelem*ncomp*Q + i] - vg[i]) > 1e-12) {
+      // LCOV_EXCL_START
+      printf("[%d] Fused grad %f != %f\n", i, vf[nelem*ncomp*Q + i], vg[i]);
+      // LCOV_EXCL_STOP
+    }
+  CeedVectorRestoreArrayRead(Vi, &vi);
+  CeedVectorRestoreArrayRead(Vg, &vg);
+  CeedVectorRestoreArrayRead(Vf, &vf);
+
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&Vi);
+  CeedVectorDestroy(&Vg);
+  CeedVectorDestroy(&Vf);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedBasis b;
+  const CeedInt ncomp = 2, nelem = 3;
+  // Collocated gradient, collocated interpolation, and underintegration
+  const CeedInt P[3] = {3, 4, 5}, Q[3] = {5, 4, 3};
+  const CeedQuadMode qmode[3] = {CEED_GAUSS, CEED_GAUSS_LOBATTO, CEED_GAUSS};
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt dim=1; dim<=3; dim++)
+    for (CeedInt t=0; t<3; t++) {
+      CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, P[t], Q[t], qmode[t],
+                                      &b);
+      CheckFused(ceed, b, nelem);
+      CeedBasisDestroy(&b);
+    }
+
+  // Non-tensor basis
+  const CeedInt Pn = 3, Qn = 4, dimn = 2;
+  CeedScalar interp[Qn*Pn], grad[dimn*Qn*Pn], qref[dimn*Qn], qweight[Qn];
+  for (CeedInt i=0; i<Qn*Pn; i++)
+    interp[i] = cos(0.7*i);
+  for (CeedInt i=0; i<dimn*Qn*Pn; i++)
+    grad[i] = sin(0.9*i + 0.1);
+  for (CeedInt i=0; i<dimn*Qn; i++)
+    qref[i] = 0.1*i;
+  for (CeedInt i=0; i<Qn; i++)
+    qweight[i] = 0.25;
+  CeedBasisCreateH1(ceed, CEED_TRIANGLE, ncomp, Pn, Qn, interp, grad, qref,
+                    qweight, &b);
+  CheckFused(ceed, b, nelem);
+  CeedBasisDestroy(&b);
+
+  // Collapsed simplex basis
+  CeedBasisCreateSimplex(ceed, CEED_TET, ncomp, 2, 3, &b);
+  CheckFused(ceed, b, nelem);
+  CeedBasisDestroy(&b);
+
+  CeedDestroy(&ceed);
+  return 0;
+}
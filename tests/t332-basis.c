@@ -0,0 +1,79 @@
+/// @file
+/// Test applying tensor bases of several shapes concurrently
+/// \test Test applying tensor bases of several shapes concurrently
+#include <ceed.h>
+#include <math.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt nb = 8, nthreads = 4, nelem = 8, ncomp = 2;
+  CeedBasis b[nb];
+  CeedVector U[nthreads][nb], V[nthreads][nb], Vref[nb];
+  CeedInt dim[nb], qsize[nb];
+
+  CeedInit(argv[1], &ceed);
+
+  // Bases of different contraction shapes
+  for (CeedInt k=0; k<nb; k++) {
+    const CeedInt P = 2 + k/2, Q = P + 1 + k%2;
+    dim[k] = 2 + k%2;
+    CeedBasisCreateTensorH1Lagrange(ceed, dim[k], ncomp, P, Q, CEED_GAUSS,
+                                    &b[k]);
+    const CeedInt lsize = nelem*ncomp*CeedIntPow(P, dim[k]);
+    qsize[k] = nelem*ncomp*CeedIntPow(Q, dim[k]);
+    for (CeedInt t=0; t<nthreads; t++) {
+      CeedScalar *u;
+      CeedVectorCreate(ceed, lsize, &U[t][k]);
+      CeedVectorGetArray(U[t][k], CEED_MEM_HOST, &u);
+      for (CeedInt i=0; i<lsize; i++)
+        u[i] = sin(i + k);
+      CeedVectorRestoreArray(U[t][k], &u);
+      CeedVectorCreate(ceed, dim[k]*qsize[k], &V[t][k]);
+    }
+    CeedVectorCreate(ceed, dim[k]*qsize[k], &Vref[k]);
+  }
+
+  // Each thread applies every basis, starting from a different one, so new
+  //   contraction shapes are requested by several threads at once
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static, 1) num_threads(nthreads)
+  #endif
+  for (CeedInt t=0; t<nthreads; t++)
+    for (CeedInt j=0; j<nb; j++) {
+      const CeedInt k = (j + t*nb/nthreads) % nb;
+      CeedBasisApply(b[k], nelem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U[t][k],
+                     V[t][k]);
+    }
+
+  // Check against applying each basis alone
+  for (CeedInt k=0; k<nb; k++) {
+    const CeedScalar *vref, *v;
+    CeedBasisApply(b[k], nelem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U[0][k],
+                   Vref[k]);
+    CeedVectorGetArrayRead(Vref[k], CEED_MEM_HOST, &vref);
+    for (CeedInt t=0; t<nthreads; t++) {
+      CeedVectorGetArrayRead(V[t][k], CEED_MEM_HOST, &v);
+      for (CeedInt i=0; i<dim[k]*qsize[k]; i++)
+        if (fabs(v[i] - vref[i]) > 1e-12) {
+          // LCOV_EXCL_START
+          printf("Basis %d thread %d: %f != %f at %d\n", k, t, v[i], vref[i],
+                 i);
+          break;
+          // LCOV_EXCL_STOP
+        }
+      CeedVectorRestoreArrayRead(V[t][k], &v);
+    }
+    CeedVectorRestoreArrayRead(Vref[k], &vref);
+  }
+
+  for (CeedInt k=0; k<nb; k++) {
+    for (CeedInt t=0; t<nthreads; t++) {
+      CeedVectorDestroy(&U[t][k]);
+      CeedVectorDestroy(&V[t][k]);
+    }
+    CeedVectorDestroy(&Vref[k]);
+    CeedBasisDestroy(&b[k]);
+  }
+  CeedDestroy(&ceed);
+  return 0;
+}
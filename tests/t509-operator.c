@@ -0,0 +1,104 @@
+/// @file
+/// Test operator with interpolated values and gradients of the same field
+/// \test Test operator with interpolated values and gradients of the same field
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t509-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictu, Erestrictdu;
+  CeedBasis bu;
+  CeedQFunction qf_advect;
+  CeedOperator op_fused, op_split;
+  CeedVector U, V, Vsplit;
+  const CeedScalar *hv, *hvsplit;
+  CeedScalar *hu;
+  const CeedInt dim = 2, ncomp = 2, nx = 3, ny = 2, P = 3, Q = 4;
+  const CeedInt nelem = nx*ny, ndofsx = nx*(P-1)+1, ndofsy = ny*(P-1)+1;
+  const CeedInt ndofs = ndofsx*ndofsy;
+  CeedInt indu[nelem*P*P];
+
+  CeedInit(argv[1], &ceed);
+
+  // Restrictions
+  for (CeedInt i=0; i<nelem; i++) {
+    const CeedInt col = i % nx, row = i / nx;
+    const CeedInt offset = col*(P-1) + row*ndofsx*(P-1);
+    for (CeedInt j=0; j<P; j++)
+      for (CeedInt k=0; k<P; k++)
+        indu[P*(P*i+k)+j] = offset + k*ndofsx + j;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, P*P, ncomp, ndofs, ncomp*ndofs,
+                            CEED_MEM_HOST, CEED_USE_POINTER, indu,
+                            &Erestrictu);
+  // A distinct restriction with the same offsets, evaluated separately
+  CeedElemRestrictionCreate(ceed, nelem, P*P, ncomp, ndofs, ncomp*ndofs,
+                            CEED_MEM_HOST, CEED_USE_POINTER, indu,
+                            &Erestrictdu);
+
+  // Basis
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, P, Q, CEED_GAUSS, &bu);
+
+  // QFunction, with the gradient listed before the interpolated values
+  CeedQFunctionCreateInterior(ceed, 1, advect, advect_loc, &qf_advect);
+  CeedQFunctionAddInput(qf_advect, "du", ncomp*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_advect, "u", ncomp, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_advect, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_advect, "v", ncomp, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_advect, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_fused);
+  CeedOperatorSetField(op_fused, "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_fused, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_fused, "weight", CEED_ELEMRESTRICTION_NONE, bu,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_fused, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_advect, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_split);
+  CeedOperatorSetField(op_split, "du", Erestrictdu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_split, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_split, "weight", CEED_ELEMRESTRICTION_NONE, bu,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_split, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  // Apply
+  CeedVectorCreate(ceed, ncomp*ndofs, &U);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &hu);
+  for (CeedInt i=0; i<ncomp*ndofs; i++)
+    hu[i] = sin(0.37*i + 0.5);
+  CeedVectorRestoreArray(U, &hu);
+  CeedVectorCreate(ceed, ncomp*ndofs, &V);
+  CeedVectorCreate(ceed, ncomp*ndofs, &Vsplit);
+
+  CeedOperatorApply(op_fused, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_split, U, Vsplit, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+  CeedVectorGetArrayRead(Vsplit, CEED_MEM_HOST, &hvsplit);
+  for (CeedInt i=0; i<ncomp*ndofs; i++)
+    if (fabs(hv[i] - hvsplit[i]) > 1e-12)
+      // LCOV_EXCL_START
+      printf("[%d] v %f != %f\n", i, hv[i], hvsplit[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &hv);
+  CeedVectorRestoreArrayRead(Vsplit, &hvsplit);
+
+  // Cleanup
+  CeedQFunctionDestroy(&qf_advect);
+  CeedOperatorDestroy(&op_fused);
+  CeedOperatorDestroy(&op_split);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictdu);
+  CeedBasisDestroy(&bu);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&Vsplit);
+  CeedDestroy(&ceed);
+  return 0;
+}
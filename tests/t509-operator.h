@@ -0,0 +1,29 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+CEED_QFUNCTION(advect)(void *ctx, const CeedInt Q,
+                       const CeedScalar *const *in, CeedScalar *const *out) {
+  // in[0] is gradients of u, shape [2, ncomp=2, Q]
+  // in[1] is u, shape [ncomp=2, Q]
+  // in[2] is quadrature weights, size (Q)
+  const CeedScalar *du = in[0], *u = in[1], *w = in[2];
+  CeedScalar *v = out[0];
+  for (CeedInt i=0; i<Q; i++) {
+    v[i+Q*0] = w[i] * (u[i+Q*0] + 2.*du[i+Q*0] - du[i+Q*3]);
+    v[i+Q*1] = w[i] * (u[i+Q*0]*u[i+Q*1] + du[i+Q*1] + 3.*du[i+Q*2]);
+  }
+  return 0;
+}
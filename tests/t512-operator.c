@@ -0,0 +1,117 @@
+/// @file
+/// Test single precision operator action
+/// \test Test single precision operator action
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t512-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt ncomp = 2, nelem = 5;
+  // Collocated gradient, collocated interpolation, and underintegration
+  const CeedInt P[3] = {3, 4, 5}, Q[3] = {5, 4, 3};
+  const CeedQuadMode qmode[3] = {CEED_GAUSS, CEED_GAUSS_LOBATTO, CEED_GAUSS};
+
+  CeedInit(argv[1], &ceed);
+
+  // Strided restrictions, and offset restrictions sharing nodes between
+  //   elements
+  for (CeedInt dim=1; dim<=3; dim++)
+    for (CeedInt t=0; t<6; t++) {
+      CeedElemRestriction Erestrictu;
+      CeedBasis bu;
+      CeedQFunction qf_scale;
+      CeedQFunctionContext ctx;
+      CeedOperator op[2];
+      CeedVector U, V[2];
+      const CeedScalar *hv[2];
+      CeedScalar *hu;
+      CeedInt size[2] = {ncomp, dim};
+      const CeedInt elemsize = CeedIntPow(P[t%3], dim);
+      const CeedInt nnodes = t < 3 ? nelem*elemsize : nelem*(elemsize-1) + 1;
+      const CeedInt ndofs = ncomp*nnodes;
+
+      if (t < 3) {
+        // Each element owns its nodes
+        CeedInt strides[3] = {1, elemsize, ncomp*elemsize};
+        CeedElemRestrictionCreateStrided(ceed, nelem, elemsize, ncomp, ndofs,
+                                         strides, &Erestrictu);
+      } else {
+        // Consecutive elements share a node
+        CeedInt ind[nelem*elemsize];
+        for (CeedInt e=0; e<nelem; e++)
+          for (CeedInt n=0; n<elemsize; n++)
+            ind[e*elemsize + n] = e*(elemsize-1) + n;
+        CeedElemRestrictionCreate(ceed, nelem, elemsize, ncomp, nnodes, ndofs,
+                                  CEED_MEM_HOST, CEED_COPY_VALUES, ind,
+                                  &Erestrictu);
+      }
+      CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, P[t%3], Q[t%3],
+                                      qmode[t%3], &bu);
+
+      CeedQFunctionCreateInterior(ceed, 1, scale, scale_loc, &qf_scale);
+      CeedQFunctionAddInput(qf_scale, "u", ncomp, CEED_EVAL_INTERP);
+      CeedQFunctionAddInput(qf_scale, "du", ncomp*dim, CEED_EVAL_GRAD);
+      CeedQFunctionAddInput(qf_scale, "weight", 1, CEED_EVAL_WEIGHT);
+      CeedQFunctionAddOutput(qf_scale, "v", ncomp, CEED_EVAL_INTERP);
+      CeedQFunctionAddOutput(qf_scale, "dv", ncomp*dim, CEED_EVAL_GRAD);
+      CeedQFunctionContextCreate(ceed, &ctx);
+      CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_USE_POINTER,
+                                  sizeof(size), size);
+      CeedQFunctionSetContext(qf_scale, ctx);
+
+      // Double and single precision operators
+      for (CeedInt k=0; k<2; k++) {
+        CeedOperatorCreate(ceed, qf_scale, CEED_QFUNCTION_NONE,
+                           CEED_QFUNCTION_NONE, &op[k]);
+        CeedOperatorSetField(op[k], "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+        CeedOperatorSetField(op[k], "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+        CeedOperatorSetField(op[k], "weight", CEED_ELEMRESTRICTION_NONE, bu,
+                             CEED_VECTOR_NONE);
+        CeedOperatorSetField(op[k], "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+        CeedOperatorSetField(op[k], "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+        CeedVectorCreate(ceed, ndofs, &V[k]);
+      }
+      CeedOperatorSetPrecision(op[1], CEED_SCALAR_FP32);
+
+      // Apply
+      CeedVectorCreate(ceed, ndofs, &U);
+      CeedVectorGetArray(U, CEED_MEM_HOST, &hu);
+      for (CeedInt i=0; i<ndofs; i++)
+        hu[i] = sin(0.37*i + 0.5);
+      CeedVectorRestoreArray(U, &hu);
+      for (CeedInt k=0; k<2; k++)
+        CeedOperatorApply(op[k], U, V[k], CEED_REQUEST_IMMEDIATE);
+
+      // Check output against single precision accuracy
+      CeedVectorGetArrayRead(V[0], CEED_MEM_HOST, &hv[0]);
+      CeedVectorGetArrayRead(V[1], CEED_MEM_HOST, &hv[1]);
+      CeedScalar vmax = 0.;
+      for (CeedInt i=0; i<ndofs; i++)
+        vmax = fmax(vmax, fabs(hv[0][i]));
+      for (CeedInt i=0; i<ndofs; i++)
+        if (fabs(hv[1][i] - hv[0][i]) > 1e-5*vmax)
+          // LCOV_EXCL_START
+          printf("dim %d, P %d, Q %d: [%d] v %f != %f\n", dim, P[t%3],
+                 Q[t%3], i, hv[1][i], hv[0][i]);
+      // LCOV_EXCL_STOP
+      CeedVectorRestoreArrayRead(V[0], &hv[0]);
+      CeedVectorRestoreArrayRead(V[1], &hv[1]);
+
+      // Cleanup
+      for (CeedInt k=0; k<2; k++) {
+        CeedOperatorDestroy(&op[k]);
+        CeedVectorDestroy(&V[k]);
+      }
+      CeedQFunctionContextDestroy(&ctx);
+      CeedQFunctionDestroy(&qf_scale);
+      CeedElemRestrictionDestroy(&Erestrictu);
+      CeedBasisDestroy(&bu);
+      CeedVectorDestroy(&U);
+    }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
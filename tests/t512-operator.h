@@ -0,0 +1,33 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+
+CEED_QFUNCTION(scale)(void *ctx, const CeedInt Q,
+                      const CeedScalar *const *in, CeedScalar *const *out) {
+  // in[0] is u, shape [ncomp, Q]
+  // in[1] is gradients of u, shape [dim, ncomp, Q]
+  // in[2] is quadrature weights, size (Q)
+  const CeedInt *size = (const CeedInt *)ctx, ncomp = size[0], dim = size[1];
+  const CeedScalar *u = in[0], *du = in[1], *w = in[2];
+  CeedScalar *v = out[0], *dv = out[1];
+  for (CeedInt i=0; i<Q; i++) {
+    for (CeedInt c=0; c<ncomp; c++)
+      v[i+Q*c] = w[i] * u[i+Q*c];
+    for (CeedInt c=0; c<dim*ncomp; c++)
+      dv[i+Q*c] = w[i] * (du[i+Q*c] + 0.5*u[i+Q*(c%ncomp)]);
+  }
+  return 0;
+}
@@ -0,0 +1,157 @@
+/// @file
+/// Test reduced precision storage of passive operator inputs
+/// \test Test reduced precision storage of passive operator inputs
+#include <ceed.h>
+#include <math.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictqi;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_diff;
+  CeedOperator op_setup, op_diff[3];
+  CeedVector qdata, X, U, V[3], A[3];
+  CeedElemRestriction Erestricta;
+  CeedInt nelem = 6, P = 3, Q = 4, dim = 2;
+  CeedInt nx = 3, ny = 2;
+  CeedInt ndofs = (nx*2+1)*(ny*2+1), nqpts = nelem*Q*Q;
+  CeedInt indx[nelem*P*P];
+  CeedScalar x[dim*ndofs], u[ndofs];
+  CeedScalarType prec[3] = {CEED_SCALAR_FP64, CEED_SCALAR_FP32,
+                            CEED_SCALAR_BF16
+                           };
+  // bfloat16 keeps 8 significant bits
+  CeedScalar tol[3] = {0., 1e-6, 1e-2};
+
+  CeedInit(argv[1], &ceed);
+
+  // DoF Coordinates, on a distorted mesh
+  for (CeedInt i=0; i<nx*2+1; i++)
+    for (CeedInt j=0; j<ny*2+1; j++) {
+      CeedScalar xi = (CeedScalar) i / (2*nx), eta = (CeedScalar) j / (2*ny);
+      x[i+j*(nx*2+1)+0*ndofs] = xi + 0.05*sin(3.*xi)*sin(3.*eta);
+      x[i+j*(nx*2+1)+1*ndofs] = eta + 0.1*xi*eta;
+      u[i+j*(nx*2+1)] = cos(2.*xi) + xi*eta*eta;
+    }
+  CeedVectorCreate(ceed, dim*ndofs, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, ndofs, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, nqpts*dim*(dim+1)/2, &qdata);
+
+  // Element Setup
+  for (CeedInt i=0; i<nelem; i++) {
+    CeedInt col, row, offset;
+    col = i % nx;
+    row = i / nx;
+    offset = col*(P-1) + row*(nx*2+1)*(P-1);
+    for (CeedInt j=0; j<P; j++)
+      for (CeedInt k=0; k<P; k++)
+        indx[P*(P*i+k)+j] = offset + k*(nx*2+1) + j;
+  }
+
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, P*P, dim, ndofs, dim*ndofs,
+                            CEED_MEM_HOST, CEED_USE_POINTER, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P*P, 1, 1, ndofs, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictu);
+  CeedInt stridesqd[3] = {1, Q*Q, Q*Q*dim*(dim+1)/2};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q, dim*(dim+1)/2,
+                                   dim*(dim+1)/2*nqpts, stridesqd,
+                                   &Erestrictqi);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, P, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &bu);
+
+  // Setup
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson2DBuild", &qf_setup);
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", Erestrictqi, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Diffusion operators, storing qdata in each precision
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson2DApply", &qf_diff);
+  for (CeedInt p=0; p<3; p++) {
+    CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_diff[p]);
+    CeedOperatorSetField(op_diff[p], "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_diff[p], "qdata", Erestrictqi,
+                         CEED_BASIS_COLLOCATED, qdata);
+    CeedOperatorSetField(op_diff[p], "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetPassivePrecision(op_diff[p], prec[p]);
+    CeedVectorCreate(ceed, ndofs, &V[p]);
+  }
+
+  // Apply, then apply again after the passive input changes
+  for (CeedInt pass=0; pass<2; pass++) {
+    if (pass) {
+      CeedScalar *q;
+      CeedVectorGetArray(qdata, CEED_MEM_HOST, &q);
+      for (CeedInt i=0; i<nqpts*dim*(dim+1)/2; i++)
+        q[i] *= 2.;
+      CeedVectorRestoreArray(qdata, &q);
+    }
+    for (CeedInt p=0; p<3; p++) {
+      CeedOperatorApply(op_diff[p], U, V[p], CEED_REQUEST_IMMEDIATE);
+      CeedOperatorLinearAssembleQFunction(op_diff[p], &A[p], &Erestricta,
+                                          CEED_REQUEST_IMMEDIATE);
+      CeedElemRestrictionDestroy(&Erestricta);
+    }
+
+    const CeedScalar *v[3], *a[3];
+    CeedScalar vmax = 0., amax = 0.;
+    for (CeedInt p=0; p<3; p++) {
+      CeedVectorGetArrayRead(V[p], CEED_MEM_HOST, &v[p]);
+      CeedVectorGetArrayRead(A[p], CEED_MEM_HOST, &a[p]);
+    }
+    for (CeedInt i=0; i<ndofs; i++)
+      vmax = fmax(vmax, fabs(v[0][i]));
+    for (CeedInt i=0; i<nqpts*dim*dim; i++)
+      amax = fmax(amax, fabs(a[0][i]));
+    for (CeedInt p=1; p<3; p++) {
+      for (CeedInt i=0; i<ndofs; i++)
+        if (fabs(v[p][i] - v[0][i]) > tol[p]*vmax)
+          // LCOV_EXCL_START
+          printf("[%d] %s v %f != %f\n", i, CeedScalarTypes[prec[p]],
+                 v[p][i], v[0][i]);
+      // LCOV_EXCL_STOP
+      for (CeedInt i=0; i<nqpts*dim*dim; i++)
+        if (fabs(a[p][i] - a[0][i]) > tol[p]*amax)
+          // LCOV_EXCL_START
+          printf("[%d] %s assembled %f != %f\n", i, CeedScalarTypes[prec[p]],
+                 a[p][i], a[0][i]);
+      // LCOV_EXCL_STOP
+    }
+    for (CeedInt p=0; p<3; p++) {
+      CeedVectorRestoreArrayRead(V[p], &v[p]);
+      CeedVectorRestoreArrayRead(A[p], &a[p]);
+      CeedVectorDestroy(&A[p]);
+    }
+  }
+
+  // Cleanup
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_diff);
+  CeedOperatorDestroy(&op_setup);
+  for (CeedInt p=0; p<3; p++) {
+    CeedOperatorDestroy(&op_diff[p]);
+    CeedVectorDestroy(&V[p]);
+  }
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictqi);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
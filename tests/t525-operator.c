@@ -0,0 +1,123 @@
+/// @file
+/// Test composite mass matrix operator with suboperators on disjoint meshes
+/// \test Test composite mass matrix operator with suboperators on disjoint meshes
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx[2], Erestrictu[2], Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup[2], op_mass[2], op_composite;
+  CeedVector qdata[2], X, U, V;
+  const CeedScalar *hv;
+  CeedInt nelem = 6, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[2][nelem*2], indu[2][nelem*P];
+  CeedScalar x[2*Nx], sum;
+
+  CeedInit(argv[1], &ceed);
+
+  // Two unit interval meshes sharing no nodes
+  for (CeedInt m=0; m<2; m++) {
+    for (CeedInt i=0; i<Nx; i++)
+      x[m*Nx+i] = (CeedScalar) i / (Nx - 1);
+    for (CeedInt i=0; i<nelem; i++) {
+      indx[m][2*i+0] = m*Nx + i;
+      indx[m][2*i+1] = m*Nx + i+1;
+      for (CeedInt j=0; j<P; j++)
+        indu[m][P*i+j] = m*Nu + i*(P-1) + j;
+    }
+    CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, 2*Nx, CEED_MEM_HOST,
+                              CEED_USE_POINTER, indx[m], &Erestrictx[m]);
+    CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, 2*Nu, CEED_MEM_HOST,
+                              CEED_USE_POINTER, indu[m], &Erestrictu[m]);
+  }
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, 2*Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  for (CeedInt m=0; m<2; m++) {
+    CeedVectorCreate(ceed, nelem*Q, &qdata[m]);
+
+    CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_setup[m]);
+    CeedOperatorSetField(op_setup[m], "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                         CEED_VECTOR_NONE);
+    CeedOperatorSetField(op_setup[m], "dx", Erestrictx[m], bx,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_setup[m], "rho", Erestrictui,
+                         CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+    CeedOperatorApply(op_setup[m], X, qdata[m], CEED_REQUEST_IMMEDIATE);
+
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_mass[m]);
+    CeedOperatorSetField(op_mass[m], "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                         qdata[m]);
+    CeedOperatorSetField(op_mass[m], "u", Erestrictu[m], bu,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass[m], "v", Erestrictu[m], bu,
+                         CEED_VECTOR_ACTIVE);
+    CeedCompositeOperatorAddSub(op_composite, op_mass[m]);
+  }
+
+  CeedVectorCreate(ceed, 2*Nu, &U);
+  CeedVectorSetValue(U, 1.0);
+  CeedVectorCreate(ceed, 2*Nu, &V);
+
+  // Apply twice to check that the output is reset
+  for (CeedInt k=0; k<2; k++) {
+    CeedOperatorApply(op_composite, U, V, CEED_REQUEST_IMMEDIATE);
+
+    // Each mesh has unit length
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+    for (CeedInt m=0; m<2; m++) {
+      sum = 0.;
+      for (CeedInt i=0; i<Nu; i++)
+        sum += hv[m*Nu+i];
+      if (fabs(sum-1.)>1e-10)
+        printf("Mesh %d Computed Area: %f != True Area: 1.0\n", m, sum);
+    }
+    CeedVectorRestoreArrayRead(V, &hv);
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  for (CeedInt m=0; m<2; m++) {
+    CeedOperatorDestroy(&op_setup[m]);
+    CeedOperatorDestroy(&op_mass[m]);
+    CeedElemRestrictionDestroy(&Erestrictx[m]);
+    CeedElemRestrictionDestroy(&Erestrictu[m]);
+    CeedVectorDestroy(&qdata[m]);
+  }
+  CeedOperatorDestroy(&op_composite);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedDestroy(&ceed);
+  return 0;
+}
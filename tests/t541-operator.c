@@ -0,0 +1,150 @@
+/// @file
+/// Test assembly of element matrices of a multi-component mass operator
+/// \test Test assembly of element matrices of a multi-component mass operator
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t537-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu,
+                      Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass;
+  CeedVector qdata, X, A, U, V;
+  CeedInt nelem = 9, P = 3, Q = 4, dim = 2, ncomp = 2;
+  CeedInt nx = 3, ny = 3;
+  CeedInt ndofs = (nx*2+1)*(ny*2+1), nqpts = nelem*Q*Q;
+  CeedInt esize = ncomp*P*P, nudofs = nelem*esize;
+  CeedInt indx[nelem*P*P];
+  CeedScalar x[dim*ndofs];
+  CeedScalar *u;
+  const CeedScalar *a, *v;
+  CeedSize length;
+
+  CeedInit(argv[1], &ceed);
+
+  // DoF Coordinates
+  for (CeedInt i=0; i<nx*2+1; i++)
+    for (CeedInt j=0; j<ny*2+1; j++) {
+      x[i+j*(nx*2+1)+0*ndofs] = (CeedScalar) i / (2*nx);
+      x[i+j*(nx*2+1)+1*ndofs] = (CeedScalar) j / (2*ny);
+    }
+  CeedVectorCreate(ceed, dim*ndofs, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  // Qdata Vector
+  CeedVectorCreate(ceed, nqpts, &qdata);
+
+  // Element Setup
+  for (CeedInt i=0; i<nelem; i++) {
+    CeedInt col, row, offset;
+    col = i % nx;
+    row = i / nx;
+    offset = col*(P-1) + row*(nx*2+1)*(P-1);
+    for (CeedInt j=0; j<P; j++)
+      for (CeedInt k=0; k<P; k++)
+        indx[P*(P*i+k)+j] = offset + k*(nx*2+1) + j;
+  }
+
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, P*P, dim, ndofs, dim*ndofs,
+                            CEED_MEM_HOST, CEED_USE_POINTER, indx, &Erestrictx);
+  // Discontinuous solution space, so each element matrix is a diagonal block
+  //   of the global matrix
+  CeedElemRestrictionCreateStrided(ceed, nelem, P*P, ncomp, nudofs,
+                                   CEED_STRIDES_BACKEND, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q*Q, Q*Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q, 1, nqpts, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, P, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, P, Q, CEED_GAUSS, &bu);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", ncomp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", ncomp, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Assemble element matrices
+  CeedOperatorAssembleElementMatrices(op_mass, &A, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetLength(A, &length);
+  if (length != nelem*esize*esize)
+    // LCOV_EXCL_START
+    printf("Incorrect length %ld != %d\n", (long)length, nelem*esize*esize);
+  // LCOV_EXCL_STOP
+
+  // Compare columns with operator action on unit vectors
+  CeedVectorCreate(ceed, nudofs, &U);
+  CeedVectorSetValue(U, 0.0);
+  CeedVectorCreate(ceed, nudofs, &V);
+  CeedVectorGetArrayRead(A, CEED_MEM_HOST, &a);
+  for (CeedInt j=0; j<nudofs; j++) {
+    CeedVectorGetArray(U, CEED_MEM_HOST, &u);
+    u[j] = 1.0;
+    if (j)
+      u[j-1] = 0.0;
+    CeedVectorRestoreArray(U, &u);
+
+    CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+    CeedInt e = j / esize, jj = j % esize;
+    for (CeedInt ii=0; ii<esize; ii++) {
+      CeedScalar aij = a[(e*esize + ii)*esize + jj];
+      if (fabs(aij - v[e*esize + ii]) > 1e-14)
+        // LCOV_EXCL_START
+        printf("[%d, %d, %d] Error in assembly: %f != %f\n", e, ii, jj, aij,
+               v[e*esize + ii]);
+      // LCOV_EXCL_STOP
+    }
+    CeedVectorRestoreArrayRead(V, &v);
+  }
+  CeedVectorRestoreArrayRead(A, &a);
+
+  // Cleanup
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&A);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,146 @@
+/// @file
+/// Test Chebyshev-Jacobi smoothing of a mass operator
+/// \test Test Chebyshev-Jacobi smoothing of a mass operator
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t500-operator.h"
+
+// Smooth the mass matrix system napply times from a constant initial guess
+static void smooth_mass(Ceed ceed, CeedInt napply, CeedScalar *yout) {
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass;
+  CeedOperatorSmoother smoother;
+  CeedVector qdata, X, U, B, Y;
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx], lmin, lmax;
+  CeedScalar *u;
+  const CeedScalar *y;
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  for (CeedInt i=0; i<nelem; i++)
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = i*(P-1) + j;
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Right hand side from a known solution
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorCreate(ceed, Nu, &B);
+  CeedVectorCreate(ceed, Nu, &Y);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &u);
+  for (CeedInt i=0; i<Nu; i++)
+    u[i] = sin(i);
+  CeedVectorRestoreArray(U, &u);
+  CeedOperatorApply(op_mass, U, B, CEED_REQUEST_IMMEDIATE);
+
+  // Smoother with the diagonal assembled internally
+  CeedOperatorSmootherCreateChebyshev(op_mass, NULL, 3, &smoother);
+  CeedOperatorSmootherGetEigenvalueBounds(smoother, &lmin, &lmax);
+  if (lmax <= 0 || fabs(lmin - lmax/11) > 1e-14*lmax)
+    // LCOV_EXCL_START
+    printf("Invalid eigenvalue bounds [%f, %f]\n", lmin, lmax);
+  // LCOV_EXCL_STOP
+
+  CeedVectorSetValue(Y, 1.0);
+  for (CeedInt k=0; k<napply; k++)
+    CeedOperatorSmootherApply(smoother, B, Y, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(Y, CEED_MEM_HOST, &y);
+  for (CeedInt i=0; i<Nu; i++)
+    yout[i] = y[i];
+  CeedVectorRestoreArrayRead(Y, &y);
+
+  CeedOperatorSmootherDestroy(&smoother);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&B);
+  CeedVectorDestroy(&Y);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed, ceedref;
+  const CeedInt nelem = 15, P = 5, Nu = nelem*(P-1)+1;
+  CeedScalar y[Nu], yref[Nu];
+
+  CeedInit(argv[1], &ceed);
+  CeedInit("/cpu/self/ref/serial", &ceedref);
+
+  // One application matches the reference backend
+  smooth_mass(ceed, 1, y);
+  smooth_mass(ceedref, 1, yref);
+  for (CeedInt i=0; i<Nu; i++)
+    if (fabs(y[i] - yref[i]) > 1e-12)
+      // LCOV_EXCL_START
+      printf("[%d] Smoothed solution %f != reference %f\n", i, y[i], yref[i]);
+  // LCOV_EXCL_STOP
+
+  // Repeated smoothing converges to the solution
+  smooth_mass(ceed, 20, y);
+  for (CeedInt i=0; i<Nu; i++)
+    if (fabs(y[i] - sin(i)) > 1e-10)
+      // LCOV_EXCL_START
+      printf("[%d] Error in smoothed solution: %f != %f\n", i, y[i], sin(i));
+  // LCOV_EXCL_STOP
+
+  CeedDestroy(&ceed);
+  CeedDestroy(&ceedref);
+  return 0;
+}
@@ -0,0 +1,242 @@
+/// @file
+/// Test p-multigrid hierarchy for single and composite operators
+/// \test Test p-multigrid hierarchy for single and composite operators
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t510-operator.h"
+
+// Check the degrees, coarse sizes, and Galerkin property of every level
+static void CheckHierarchy(Ceed ceed, CeedMultigridHierarchy hierarchy,
+                           CeedInt nx, CeedInt ny, CeedScalar total,
+                           CeedInt numlevels, const CeedInt *degrees) {
+  CeedInt numl;
+
+  CeedMultigridHierarchyGetNumLevels(hierarchy, &numl);
+  if (numl != numlevels)
+    // LCOV_EXCL_START
+    printf("Incorrect number of levels %d != %d\n", numl, numlevels);
+  // LCOV_EXCL_STOP
+
+  for (CeedInt l=0; l<numl; l++) {
+    CeedInt p;
+    CeedOperator op, opProlong, opRestrict;
+    CeedVector diag, mult;
+    CeedSize len;
+    const CeedScalar *m;
+
+    CeedMultigridHierarchyGetLevel(hierarchy, l, &p, &op, &opProlong,
+                                   &opRestrict, &diag, &mult);
+    if (p != degrees[l])
+      // LCOV_EXCL_START
+      printf("Level %d: incorrect degree %d != %d\n", l, p, degrees[l]);
+    // LCOV_EXCL_STOP
+
+    // Coarse nodes shared between elements are numbered once
+    CeedVectorGetLength(mult, &len);
+    if (len != (nx*p+1)*(ny*p+1))
+      // LCOV_EXCL_START
+      printf("Level %d: incorrect size %ld != %d\n", l, (long)len,
+             (nx*p+1)*(ny*p+1));
+    // LCOV_EXCL_STOP
+    CeedScalar sum = 0;
+    CeedVectorGetArrayRead(mult, CEED_MEM_HOST, &m);
+    for (CeedInt i=0; i<len; i++)
+      sum += m[i];
+    CeedVectorRestoreArrayRead(mult, &m);
+    if (fabs(sum - nx*ny*(p+1)*(p+1)) > 1e-12)
+      // LCOV_EXCL_START
+      printf("Level %d: incorrect multiplicity sum %f\n", l, sum);
+    // LCOV_EXCL_STOP
+
+    // Diagonal of the mass matrix sums to less than the sum of all entries
+    const CeedScalar *d;
+    sum = 0;
+    CeedVectorGetArrayRead(diag, CEED_MEM_HOST, &d);
+    for (CeedInt i=0; i<len; i++)
+      sum += d[i];
+    CeedVectorRestoreArrayRead(diag, &d);
+    if (sum <= 0 || sum > total + 1e-12)
+      // LCOV_EXCL_START
+      printf("Level %d: invalid diagonal sum %f\n", l, sum);
+    // LCOV_EXCL_STOP
+
+    // Coarse operator is the Galerkin product R A P of the finer operator
+    if (l > 0) {
+      CeedOperator opCoarse;
+      CeedVector multCoarse, Uc, Vc, Wc, Uf, Vf;
+      CeedSize lenc;
+      CeedScalar *u;
+      const CeedScalar *v, *w;
+
+      CeedMultigridHierarchyGetLevel(hierarchy, l-1, NULL, &opCoarse, NULL,
+                                     NULL, NULL, &multCoarse);
+      CeedVectorGetLength(multCoarse, &lenc);
+      CeedVectorCreate(ceed, lenc, &Uc);
+      CeedVectorCreate(ceed, lenc, &Vc);
+      CeedVectorCreate(ceed, lenc, &Wc);
+      CeedVectorCreate(ceed, len, &Uf);
+      CeedVectorCreate(ceed, len, &Vf);
+      CeedVectorGetArray(Uc, CEED_MEM_HOST, &u);
+      for (CeedInt i=0; i<lenc; i++)
+        u[i] = sin(i);
+      CeedVectorRestoreArray(Uc, &u);
+
+      CeedOperatorApply(opCoarse, Uc, Vc, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApply(opProlong, Uc, Uf, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApply(op, Uf, Vf, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApply(opRestrict, Vf, Wc, CEED_REQUEST_IMMEDIATE);
+
+      CeedVectorGetArrayRead(Vc, CEED_MEM_HOST, &v);
+      CeedVectorGetArrayRead(Wc, CEED_MEM_HOST, &w);
+      for (CeedInt i=0; i<lenc; i++)
+        if (fabs(v[i] - w[i]) > 1e-13)
+          // LCOV_EXCL_START
+          printf("Level %d: [%d] coarse operator %e != R A P %e\n", l, i,
+                 v[i], w[i]);
+      // LCOV_EXCL_STOP
+      CeedVectorRestoreArrayRead(Vc, &v);
+      CeedVectorRestoreArrayRead(Wc, &w);
+
+      CeedVectorDestroy(&Uc);
+      CeedVectorDestroy(&Vc);
+      CeedVectorDestroy(&Wc);
+      CeedVectorDestroy(&Uf);
+      CeedVectorDestroy(&Vf);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass, op_composite;
+  CeedMultigridHierarchy hierarchy;
+  CeedVector qdata, X;
+  CeedInt nelem = 6, P = 5, Q = 6, dim = 2;
+  CeedInt nx = 3, ny = 2;
+  CeedInt nxnodes = nx+1, nunodes = (nx*(P-1)+1)*(ny*(P-1)+1);
+  CeedInt nqpts = nelem*Q*Q;
+  CeedInt indx[nelem*2*2], indu[nelem*P*P];
+  CeedScalar x[dim*nxnodes*(ny+1)];
+  CeedSize bytessingle, bytescomposite;
+
+  CeedInit(argv[1], &ceed);
+
+  // Coordinates of element vertices
+  for (CeedInt i=0; i<nx+1; i++)
+    for (CeedInt j=0; j<ny+1; j++) {
+      x[i+j*nxnodes+0*nxnodes*(ny+1)] = (CeedScalar) i / nx;
+      x[i+j*nxnodes+1*nxnodes*(ny+1)] = (CeedScalar) j / ny;
+    }
+  CeedVectorCreate(ceed, dim*nxnodes*(ny+1), &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  // Restrictions
+  for (CeedInt e=0; e<nelem; e++) {
+    CeedInt col = e % nx, row = e / nx;
+    for (CeedInt j=0; j<2; j++)
+      for (CeedInt i=0; i<2; i++)
+        indx[4*e+2*j+i] = (col+i) + (row+j)*nxnodes;
+    for (CeedInt j=0; j<P; j++)
+      for (CeedInt i=0; i<P; i++)
+        indu[P*P*e+P*j+i] = col*(P-1)+i + (row*(P-1)+j)*(nx*(P-1)+1);
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2*2, dim, nxnodes*(ny+1),
+                            dim*nxnodes*(ny+1), CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P*P, 1, 1, nunodes, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q*Q, Q*Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q, 1, nqpts, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &bu);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedVectorCreate(ceed, nqpts, &qdata);
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  // Halving degree schedule, 4 -> 2 -> 1
+  const CeedInt halfdegrees[3] = {1, 2, 4};
+  CeedMultigridHierarchyCreate(op_mass, CEED_MULTIGRID_COARSEN_HALF, 0, NULL,
+                               &hierarchy);
+  CheckHierarchy(ceed, hierarchy, nx, ny, 1.0, 3, halfdegrees);
+  CeedMultigridHierarchyGetMemoryUsage(hierarchy, &bytessingle);
+  CeedMultigridHierarchyDestroy(&hierarchy);
+
+  // User degree schedule, 4 -> 3
+  const CeedInt userdegrees[2] = {3, 4}, coarse[1] = {3};
+  CeedMultigridHierarchyCreate(op_mass, CEED_MULTIGRID_COARSEN_USER, 1,
+                               coarse, &hierarchy);
+  CheckHierarchy(ceed, hierarchy, nx, ny, 1.0, 2, userdegrees);
+  CeedMultigridHierarchyDestroy(&hierarchy);
+
+  // Composite operator; twice the mass, with transfer operators and coarse
+  //   bases shared between the sub-operators
+  const CeedInt lineardegrees[2] = {1, 4};
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+  CeedMultigridHierarchyCreate(op_composite, CEED_MULTIGRID_COARSEN_LINEAR, 0,
+                               NULL, &hierarchy);
+  CheckHierarchy(ceed, hierarchy, nx, ny, 2.0, 2, lineardegrees);
+  CeedMultigridHierarchyDestroy(&hierarchy);
+  CeedMultigridHierarchyCreate(op_composite, CEED_MULTIGRID_COARSEN_HALF, 0,
+                               NULL, &hierarchy);
+  CheckHierarchy(ceed, hierarchy, nx, ny, 2.0, 3, halfdegrees);
+  // -- Only the coarse operators hold data for each sub-operator
+  CeedMultigridHierarchyGetMemoryUsage(hierarchy, &bytescomposite);
+  if (bytescomposite < bytessingle || bytescomposite >= 2*bytessingle)
+    // LCOV_EXCL_START
+    printf("Composite hierarchy memory %ld, single %ld\n",
+           (long)bytescomposite, (long)bytessingle);
+  // LCOV_EXCL_STOP
+  CeedMultigridHierarchyDestroy(&hierarchy);
+
+  // Cleanup
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_composite);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,20 @@
+/// @file
+/// Test that the OpenMP backends refuse a tuned element block size
+/// \test Test that the OpenMP backends refuse a tuned element block size
+#include <ceed.h>
+#include <string.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  // Only the OpenMP backends refuse the option
+  if (strncmp(argv[1], "/cpu/self/omp", 13))
+    return 0;
+
+  // Initialization fails with the default error handler
+  CeedInit(strstr(argv[1], "blocked") ? "/cpu/self/omp/blocked?blksize=auto"
+           : "/cpu/self/omp/serial?blksize=auto", &ceed);
+
+  CeedDestroy(&ceed);
+  return 0;
+}
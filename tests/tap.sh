@@ -133,6 +133,15 @@ for ((i=0;i<${#backends[@]};++i)); do
         continue
     fi
 
+    # grep to pass test t546 on error, OpenMP backends refuse blksize=auto
+    if grep -F -q -e 'cannot use blocksize' ${output}.err \
+            && [[ "$1" = "t546"* && "$backend" = *omp* ]] ; then
+        printf "ok $i0 PASS - expected failure $1 $backend\n"
+        printf "ok $i1 PASS - expected failure $1 $backend stdout\n"
+        printf "ok $i2 PASS - expected failure $1 $backend stderr\n"
+        continue
+    fi
+
     # grep to skip test if Device memory is not supported
     if grep -F -q -e 'Can only provide to HOST memory' \
             ${output}.err ; then
@@ -142,6 +151,15 @@ for ((i=0;i<${#backends[@]};++i)); do
         continue
     fi
 
+    # grep to skip t120 if vector lengths are limited to int by the backend
+    if grep -F -q -e 'exceeds the range supported' ${output}.err \
+            && [[ "$1" = t120* ]] ; then
+        printf "ok $i0 # SKIP - vector length not supported $1 $backend\n"
+        printf "ok $i1 # SKIP - vector length not supported $1 $backend stdout\n"
+        printf "ok $i2 # SKIP - vector length not supported $1 $backend stderr\n"
+        continue
+    fi
+
     # grep to skip t506 for MAGMA, range of basis kernels limited for now
     if [[ "$backend" = *magma* ]] \
             && [[ "$1" = t506* ]] ; then